@@ -7,10 +7,11 @@
 
 #include "cmd_parser.hpp"
 #include "finder.hpp"
+#include "tool.hpp"
 
 using namespace Tsepepe::AbstractClassFinder;
 
-int main(int argc, const char* argv[])
+int Tsepepe::AbstractClassFinder::run(int argc, const char** argv)
 {
     auto input_or_return_code{parse_cmd(argc, argv)};
     if (std::holds_alternative<ReturnCode>(input_or_return_code))
@@ -0,0 +1,497 @@
+/**
+ * @file	c_api.cpp
+ * @brief	Implements the C API of the tsepepe library, over the code actions.
+ */
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+#include <llvm/Support/Threading.h>
+
+#include "base_error.hpp"
+#include "cancellation_token.hpp"
+#include "code_formatter.hpp"
+#include "clangd_index.hpp"
+#include "code_generation_cache.hpp"
+#include "common_types.hpp"
+#include "generate_definitions_in_paired_source_code_action.hpp"
+#include "generate_function_definitions_code_action.hpp"
+#include "generate_missing_definitions_code_action.hpp"
+#include "implement_interface_code_action.hpp"
+#include "missing_overrides_code_action.hpp"
+#include "parsed_file_cache.hpp"
+#include "source_file_content.hpp"
+
+#include "tsepepe.h"
+
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+struct tsepepe_result
+{
+    tsepepe_status status{TSEPEPE_STATUS_OK};
+    std::string error_message;
+    std::vector<std::string> file_paths;
+    std::vector<std::string> file_contents;
+    std::string text;
+};
+
+struct tsepepe_cancellation_token
+{
+    Tsepepe::CancellationToken token;
+};
+
+struct tsepepe_session
+{
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+    //! Kept for the lifetime of the session; backed by the file under the cache directory, if given.
+    std::shared_ptr<Tsepepe::CodeGenerationCache> code_generation_cache;
+    //! The ASTs of the recently parsed files, e.g. parsed ahead with tsepepe_warm_up().
+    std::shared_ptr<Tsepepe::ParsedFileCache> parsed_file_cache;
+    //! Keeps the read shards, so that only the ones changed meanwhile are read again; null if not given.
+    std::shared_ptr<Tsepepe::ClangdIndex> clangd_index;
+    fs::path root_directory;
+    fs::path cache_directory;
+    std::optional<Tsepepe::CodeFormattingOptions> code_formatting;
+};
+
+namespace
+{
+
+//! Thrown on a malformed request; reported with TSEPEPE_STATUS_INVALID_ARGUMENT.
+struct InvalidArgument : Tsepepe::BaseError
+{
+    using Tsepepe::BaseError::BaseError;
+};
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static constexpr char code_generation_cache_file_name[]{"code_generation_cache.json"};
+static constexpr char parsed_files_directory_name[]{"parsed_files"};
+
+//! Stores the caches under the cache directory, if any.
+static void store_caches(tsepepe_session&);
+
+//! Runs the request, turning its outcome, or the exception it throws, into a result; never throws.
+template<typename Request>
+static tsepepe_result* run_request(Request);
+
+/**
+ * @brief Runs the function on a worker thread of its own, at the background priority, which the threads it spawns
+ * inherit, and waits for it; the priority of the calling thread is left untouched. Rethrows what the function throws.
+ */
+template<typename Function>
+static void run_at_background_priority(Function);
+
+static tsepepe_result* make_result(Tsepepe::MultiFileEdit);
+static tsepepe_result* make_text_result(std::string);
+static tsepepe_result* make_error_result(tsepepe_status, std::string error_message);
+
+static void validate_not_null(const void*, const char* what);
+//! The options of the caller shall contain at least the ones, which the first version of the API has.
+static void validate_struct_size(const tsepepe_session_options&);
+//! Whether the options of the caller, compiled with an older header maybe, end past the option at the offset.
+static bool has_option(const tsepepe_session_options&, std::size_t option_offset, std::size_t option_size);
+static Tsepepe::SourceFileContent make_source_file_content(const tsepepe_source_file&);
+static Tsepepe::CancellationToken get_token(const tsepepe_cancellation_token*);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+unsigned tsepepe_api_version(void)
+{
+    return TSEPEPE_API_VERSION;
+}
+
+tsepepe_status tsepepe_result_status(const tsepepe_result* result)
+{
+    return result->status;
+}
+
+const char* tsepepe_result_error_message(const tsepepe_result* result)
+{
+    return result->error_message.c_str();
+}
+
+size_t tsepepe_result_file_edits_count(const tsepepe_result* result)
+{
+    return result->file_paths.size();
+}
+
+const char* tsepepe_result_file_path(const tsepepe_result* result, size_t index)
+{
+    return result->file_paths[index].c_str();
+}
+
+const char* tsepepe_result_file_content(const tsepepe_result* result, size_t index, size_t* size)
+{
+    const auto& content{result->file_contents[index]};
+    if (size != nullptr)
+        *size = content.size();
+    return content.c_str();
+}
+
+const char* tsepepe_result_text(const tsepepe_result* result, size_t* size)
+{
+    if (size != nullptr)
+        *size = result->text.size();
+    return result->text.c_str();
+}
+
+void tsepepe_result_free(tsepepe_result* result)
+{
+    delete result;
+}
+
+tsepepe_cancellation_token* tsepepe_cancellation_token_create(void)
+{
+    return new (std::nothrow) tsepepe_cancellation_token;
+}
+
+void tsepepe_cancellation_token_cancel(tsepepe_cancellation_token* token)
+{
+    token->token.cancel();
+}
+
+void tsepepe_cancellation_token_free(tsepepe_cancellation_token* token)
+{
+    delete token;
+}
+
+tsepepe_session* tsepepe_session_open(const tsepepe_session_options* options, tsepepe_result** result)
+{
+    std::unique_ptr<tsepepe_session> session;
+    auto open_result{run_request([&]() {
+        validate_not_null(options, "Session options");
+        validate_struct_size(*options);
+        validate_not_null(options->compilation_database_directory, "Compilation database directory");
+        validate_not_null(options->root_directory, "Root directory");
+
+        session = std::make_unique<tsepepe_session>();
+
+        std::string error_message;
+        session->compilation_database = clang::tooling::CompilationDatabase::loadFromDirectory(
+            options->compilation_database_directory, error_message);
+        if (session->compilation_database == nullptr)
+            throw Tsepepe::BaseError{"Failed to load the compilation database from: "
+                                     + std::string{options->compilation_database_directory} + ": " + error_message};
+
+        session->root_directory = options->root_directory;
+        if (options->cache_directory != nullptr)
+            session->cache_directory = options->cache_directory;
+        session->parsed_file_cache = std::make_shared<Tsepepe::ParsedFileCache>(
+            session->compilation_database,
+            session->root_directory,
+            Tsepepe::ParsedFileCache::default_capacity,
+            session->cache_directory.empty() ? fs::path{} : session->cache_directory / parsed_files_directory_name);
+        if (not session->cache_directory.empty())
+        {
+            session->code_generation_cache = std::make_shared<Tsepepe::CodeGenerationCache>(
+                session->cache_directory / code_generation_cache_file_name);
+        } else
+        {
+            session->code_generation_cache = std::make_shared<Tsepepe::CodeGenerationCache>();
+        }
+        if (options->format_style != nullptr)
+            session->code_formatting = Tsepepe::CodeFormattingOptions{.style = options->format_style};
+        if (has_option(*options,
+                       offsetof(tsepepe_session_options, clangd_index_directory),
+                       sizeof(options->clangd_index_directory))
+            and options->clangd_index_directory != nullptr)
+            session->clangd_index = std::make_shared<Tsepepe::ClangdIndex>(
+                session->compilation_database, session->root_directory, options->clangd_index_directory);
+        return Tsepepe::MultiFileEdit{};
+    })};
+
+    if (tsepepe_result_status(open_result) != TSEPEPE_STATUS_OK)
+        session.reset();
+
+    if (session != nullptr or result == nullptr)
+    {
+        tsepepe_result_free(open_result);
+        open_result = nullptr;
+    }
+    if (result != nullptr)
+        *result = open_result;
+    return session.release();
+}
+
+void tsepepe_session_close(tsepepe_session* session)
+{
+    if (session == nullptr)
+        return;
+
+    // The caches are stored to be shared with the others, e.g. with the tools, thus a failure is not fatal.
+    try
+    {
+        store_caches(*session);
+    } catch (const std::exception&)
+    {
+    }
+    delete session;
+}
+
+tsepepe_result* tsepepe_implement_interfaces(tsepepe_session* session,
+                                             const tsepepe_implement_interfaces_request* request,
+                                             const tsepepe_cancellation_token* token)
+{
+    return run_request([&]() {
+        validate_not_null(session, "Session");
+        validate_not_null(request, "Request");
+        validate_not_null(request->source_file.path, "Source file path");
+
+        std::vector<std::string> interface_names;
+        interface_names.reserve(request->interface_names_count);
+        for (size_t i{0}; i < request->interface_names_count; ++i)
+        {
+            validate_not_null(request->interface_names[i], "Interface name");
+            interface_names.emplace_back(request->interface_names[i]);
+        }
+
+        Tsepepe::ImplementIntefaceCodeActionLibclangBased code_action{session->compilation_database,
+                                                                      session->code_generation_cache,
+                                                                      session->parsed_file_cache,
+                                                                      session->clangd_index};
+        auto new_content{code_action.apply({.root_directory = session->root_directory,
+                                            .source_file_path = request->source_file.path,
+                                            .source_file_content = make_source_file_content(request->source_file),
+                                            .interface_names = std::move(interface_names),
+                                            .cursor_position_line = request->cursor_position_line,
+                                            .code_formatting = session->code_formatting,
+                                            .cancellation = get_token(token)})};
+        return Tsepepe::MultiFileEdit{{request->source_file.path, std::move(new_content)}};
+    });
+}
+
+tsepepe_result* tsepepe_add_missing_overrides(tsepepe_session* session,
+                                              const char* interface_name,
+                                              const tsepepe_cancellation_token* token)
+{
+    return run_request([&]() {
+        validate_not_null(session, "Session");
+        validate_not_null(interface_name, "Interface name");
+
+        Tsepepe::MissingOverridesCodeActionLibclangBased code_action{session->compilation_database};
+        return code_action.apply({.root_directory = session->root_directory,
+                                  .interface_name = interface_name,
+                                  .cache_directory = session->cache_directory,
+                                  .code_formatting = session->code_formatting,
+                                  .cancellation = get_token(token)});
+    });
+}
+
+tsepepe_result* tsepepe_generate_missing_definitions(tsepepe_session* session,
+                                                     const char* const* header_paths,
+                                                     size_t header_paths_count,
+                                                     const tsepepe_cancellation_token* token)
+{
+    return run_request([&]() {
+        validate_not_null(session, "Session");
+
+        std::vector<fs::path> paths;
+        paths.reserve(header_paths_count);
+        for (size_t i{0}; i < header_paths_count; ++i)
+        {
+            validate_not_null(header_paths[i], "Header path");
+            paths.emplace_back(header_paths[i]);
+        }
+
+        Tsepepe::GenerateMissingDefinitionsCodeActionLibclangBased code_action{session->compilation_database};
+        return code_action.apply({.root_directory = session->root_directory,
+                                  .header_paths = std::move(paths),
+                                  .code_formatting = session->code_formatting,
+                                  .cancellation = get_token(token)});
+    });
+}
+
+tsepepe_result* tsepepe_generate_definitions_in_paired_source(tsepepe_session* session,
+                                                              const tsepepe_selection_request* request,
+                                                              const tsepepe_cancellation_token* token)
+{
+    return run_request([&]() {
+        validate_not_null(session, "Session");
+        validate_not_null(request, "Request");
+        validate_not_null(request->file.path, "Header file path");
+
+        Tsepepe::GenerateDefinitionsInPairedSourceCodeActionLibclangBased code_action{
+            session->compilation_database, session->code_generation_cache, session->parsed_file_cache};
+        return code_action.apply({.root_directory = session->root_directory,
+                                  .header_file_path = request->file.path,
+                                  .header_file_content = make_source_file_content(request->file),
+                                  .selected_line_begin = request->selected_line_begin,
+                                  .selected_line_end = request->selected_line_end,
+                                  .code_formatting = session->code_formatting,
+                                  .cancellation = get_token(token)});
+    });
+}
+
+tsepepe_result* tsepepe_generate_function_definitions(tsepepe_session* session,
+                                                      const tsepepe_selection_request* request,
+                                                      const tsepepe_cancellation_token* token)
+{
+    return run_request([&]() {
+        validate_not_null(session, "Session");
+        validate_not_null(request, "Request");
+        validate_not_null(request->file.path, "Source file path");
+
+        Tsepepe::GenerateFunctionDefinitionsCodeActionLibclangBased code_action{
+            session->compilation_database, session->code_generation_cache, session->parsed_file_cache};
+        return code_action.apply({.source_file_path = request->file.path,
+                                  .source_file_content = make_source_file_content(request->file),
+                                  .selected_line_begin = request->selected_line_begin,
+                                  .selected_line_end = request->selected_line_end,
+                                  .cancellation = get_token(token)});
+    });
+}
+
+tsepepe_result* tsepepe_warm_up(tsepepe_session* session,
+                                const tsepepe_source_file* file,
+                                const tsepepe_cancellation_token* token)
+{
+    return run_request([&]() {
+        validate_not_null(session, "Session");
+        validate_not_null(file, "File");
+        validate_not_null(file->path, "File path");
+
+        std::optional<Tsepepe::SourceFileContent> content;
+        if (file->content != nullptr)
+            content = make_source_file_content(*file);
+        run_at_background_priority(
+            [&] { session->parsed_file_cache->warm_up(file->path, std::move(content), get_token(token)); });
+        return Tsepepe::MultiFileEdit{};
+    });
+}
+
+tsepepe_result* tsepepe_session_checkpoint(tsepepe_session* session)
+{
+    return run_request([&]() {
+        validate_not_null(session, "Session");
+        store_caches(*session);
+        return Tsepepe::MultiFileEdit{};
+    });
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+template<typename Request>
+static tsepepe_result* run_request(Request request)
+{
+    try
+    {
+        auto outcome{request()};
+        if constexpr (std::is_same_v<decltype(outcome), std::string>)
+            return make_text_result(std::move(outcome));
+        else
+            return make_result(std::move(outcome));
+    } catch (const Tsepepe::OperationCancelled& e)
+    {
+        return make_error_result(TSEPEPE_STATUS_CANCELLED, e.what());
+    } catch (const InvalidArgument& e)
+    {
+        return make_error_result(TSEPEPE_STATUS_INVALID_ARGUMENT, e.what());
+    } catch (const std::exception& e)
+    {
+        return make_error_result(TSEPEPE_STATUS_ERROR, e.what());
+    } catch (...)
+    {
+        return make_error_result(TSEPEPE_STATUS_ERROR, "Unknown error!");
+    }
+}
+
+template<typename Function>
+static void run_at_background_priority(Function function)
+{
+    std::exception_ptr exception;
+    std::jthread worker{[&] {
+        llvm::set_thread_priority(llvm::ThreadPriority::Background);
+        try
+        {
+            function();
+        } catch (...)
+        {
+            exception = std::current_exception();
+        }
+    }};
+    worker.join();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+static tsepepe_result* make_result(Tsepepe::MultiFileEdit edit)
+{
+    auto result{std::make_unique<tsepepe_result>()};
+    result->file_paths.reserve(edit.size());
+    result->file_contents.reserve(edit.size());
+    for (auto& [path, content] : edit)
+    {
+        result->file_paths.emplace_back(path.string());
+        result->file_contents.emplace_back(std::move(content));
+    }
+    return result.release();
+}
+
+static tsepepe_result* make_text_result(std::string text)
+{
+    auto result{std::make_unique<tsepepe_result>()};
+    result->text = std::move(text);
+    return result.release();
+}
+
+static tsepepe_result* make_error_result(tsepepe_status status, std::string error_message)
+{
+    auto result{std::make_unique<tsepepe_result>()};
+    result->status = status;
+    result->error_message = std::move(error_message);
+    return result.release();
+}
+
+static void validate_not_null(const void* pointer, const char* what)
+{
+    if (pointer == nullptr)
+        throw InvalidArgument{std::string{what} + " must not be NULL!"};
+}
+
+static void validate_struct_size(const tsepepe_session_options& options)
+{
+    if (not has_option(options, offsetof(tsepepe_session_options, format_style), sizeof(options.format_style)))
+        throw InvalidArgument{"The struct_size of the session options must be set to their sizeof!"};
+}
+
+static bool has_option(const tsepepe_session_options& options, std::size_t option_offset, std::size_t option_size)
+{
+    return options.struct_size >= option_offset + option_size;
+}
+
+static Tsepepe::SourceFileContent make_source_file_content(const tsepepe_source_file& file)
+{
+    if (file.content == nullptr)
+        return Tsepepe::SourceFileContent::from_file(file.path);
+    return std::string{file.content, file.content_size};
+}
+
+static Tsepepe::CancellationToken get_token(const tsepepe_cancellation_token* token)
+{
+    return token == nullptr ? Tsepepe::CancellationToken{} : token->token;
+}
+
+static void store_caches(tsepepe_session& session)
+{
+    if (session.cache_directory.empty())
+        return;
+    session.code_generation_cache->store();
+    session.parsed_file_cache->store_snapshot();
+}
@@ -0,0 +1,214 @@
+/**
+ * @file        tsepepe.h
+ * @brief       The C API of the tsepepe library, to run the code actions in-process, e.g. from an editor plugin.
+ *
+ * A session keeps the compilation database loaded, and the caches warm, for its lifetime, e.g. for the lifetime of the
+ * editor. Each code action is a request, run synchronously on the calling thread; many requests may run at once on the
+ * same session, from different threads. A request may be cancelled from another thread, with the cancellation token
+ * passed to it.
+ *
+ * The results are owned by the library: each one shall be released with tsepepe_result_free(), and the strings
+ * obtained from it are valid until then. No function throws; all the errors are reported with the results.
+ */
+#ifndef TSEPEPE_H
+#define TSEPEPE_H
+
+#include <stddef.h>
+
+#if defined(__GNUC__)
+#define TSEPEPE_API __attribute__((visibility("default")))
+#else
+#define TSEPEPE_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Bumped on each incompatible change of this API. */
+#define TSEPEPE_API_VERSION 1
+
+/** Returns the TSEPEPE_API_VERSION the library is built with; shall be checked against the one compiled with. */
+TSEPEPE_API unsigned tsepepe_api_version(void);
+
+typedef enum tsepepe_status
+{
+    TSEPEPE_STATUS_OK = 0,
+    /** The request has failed, e.g. no class is found under the cursor; see tsepepe_result_error_message(). */
+    TSEPEPE_STATUS_ERROR = 1,
+    /** The request is malformed, e.g. a mandatory argument is NULL; see tsepepe_result_error_message(). */
+    TSEPEPE_STATUS_INVALID_ARGUMENT = 2,
+    /** The request has been cancelled with its cancellation token. */
+    TSEPEPE_STATUS_CANCELLED = 3
+} tsepepe_status;
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+/* Results                                                                                                            */
+/* ------------------------------------------------------------------------------------------------------------------ */
+typedef struct tsepepe_result tsepepe_result;
+
+TSEPEPE_API tsepepe_status tsepepe_result_status(const tsepepe_result*);
+
+/** Returns an empty string, when the status is TSEPEPE_STATUS_OK. */
+TSEPEPE_API const char* tsepepe_result_error_message(const tsepepe_result*);
+
+/** The number of files edited, or created, by the code action. */
+TSEPEPE_API size_t tsepepe_result_file_edits_count(const tsepepe_result*);
+
+/** The path of the edited file; index must be lower than tsepepe_result_file_edits_count(). */
+TSEPEPE_API const char* tsepepe_result_file_path(const tsepepe_result*, size_t index);
+
+/** The new content of the edited file, null terminated; its size, without the terminator, is put to size, if given. */
+TSEPEPE_API const char* tsepepe_result_file_content(const tsepepe_result*, size_t index, size_t* size);
+
+/**
+ * The text produced by the code action, which does not edit any file, e.g. the generated function definitions; null
+ * terminated; its size, without the terminator, is put to size, if given. An empty string for the other code actions.
+ */
+TSEPEPE_API const char* tsepepe_result_text(const tsepepe_result*, size_t* size);
+
+/** Accepts NULL. */
+TSEPEPE_API void tsepepe_result_free(tsepepe_result*);
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+/* Cancellation                                                                                                       */
+/* ------------------------------------------------------------------------------------------------------------------ */
+typedef struct tsepepe_cancellation_token tsepepe_cancellation_token;
+
+TSEPEPE_API tsepepe_cancellation_token* tsepepe_cancellation_token_create(void);
+
+/**
+ * Makes the request, which the token is passed to, stop before its next parse, with TSEPEPE_STATUS_CANCELLED. May be
+ * called from any thread, also before the request is made.
+ */
+TSEPEPE_API void tsepepe_cancellation_token_cancel(tsepepe_cancellation_token*);
+
+/** Shall not be called before the request, which the token is passed to, returns. Accepts NULL. */
+TSEPEPE_API void tsepepe_cancellation_token_free(tsepepe_cancellation_token*);
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+/* Sessions                                                                                                           */
+/* ------------------------------------------------------------------------------------------------------------------ */
+typedef struct tsepepe_session tsepepe_session;
+
+/**
+ * New options are only ever appended, so that the callers compiled with an older header keep working: the options
+ * beyond the struct_size of the caller are treated as NULL.
+ */
+typedef struct tsepepe_session_options
+{
+    /** Shall be set to sizeof(tsepepe_session_options). */
+    size_t struct_size;
+    /** The directory containing the compile_commands.json. */
+    const char* compilation_database_directory;
+    /** The root directory of the project: the interfaces, and the paired files, are looked for under it. */
+    const char* root_directory;
+    /**
+     * Where the class index, and the snapshot of the parsed files, are kept, e.g. for the missing overrides; may be
+     * NULL, to always visit, and parse, all the files.
+     */
+    const char* cache_directory;
+    /** The clang-format style of the generated code, e.g. "file", or "LLVM"; NULL leaves the code unformatted. */
+    const char* format_style;
+    /**
+     * The directory of the clangd background index, e.g. "<ROOT>/.cache/clangd/index", which the interfaces are
+     * located with, as long as it is fresh, instead of grepping the project; NULL to always grep.
+     */
+    const char* clangd_index_directory;
+} tsepepe_session_options;
+
+/**
+ * Loads the compilation database. Returns NULL on failure; then, if result is not NULL, the reason is put there, which
+ * shall be released with tsepepe_result_free().
+ */
+TSEPEPE_API tsepepe_session* tsepepe_session_open(const tsepepe_session_options*, tsepepe_result** result);
+
+/**
+ * Stores the caches under the cache directory, as tsepepe_session_checkpoint() does, ignoring the failures. Shall not
+ * be called before all the requests made on the session return. Accepts NULL.
+ */
+TSEPEPE_API void tsepepe_session_close(tsepepe_session*);
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+/* Requests                                                                                                           */
+/* Each request returns a result, which is never NULL. The cancellation token may be NULL.                            */
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+/** The edited file, of which the current content may differ from the one on the disk. */
+typedef struct tsepepe_source_file
+{
+    const char* path;
+    /** The current content, which need not be null terminated; NULL to read the file from the disk. */
+    const char* content;
+    size_t content_size;
+} tsepepe_source_file;
+
+typedef struct tsepepe_implement_interfaces_request
+{
+    /** The file with the class, which shall implement the interfaces. */
+    tsepepe_source_file source_file;
+    /** The bare names of the interfaces, e.g. "Interface" for "Namespace::Interface". */
+    const char* const* interface_names;
+    size_t interface_names_count;
+    /** Any line within the class definition; the first line is 1. */
+    unsigned cursor_position_line;
+} tsepepe_implement_interfaces_request;
+
+/** Edits the source file. */
+TSEPEPE_API tsepepe_result* tsepepe_implement_interfaces(tsepepe_session*,
+                                                         const tsepepe_implement_interfaces_request*,
+                                                         const tsepepe_cancellation_token*);
+
+/** Edits each implementor of the interface, which lacks some overrides; interface_name is a bare name. */
+TSEPEPE_API tsepepe_result* tsepepe_add_missing_overrides(tsepepe_session*,
+                                                          const char* interface_name,
+                                                          const tsepepe_cancellation_token*);
+
+/** Edits, or creates, the paired source file of each header. */
+TSEPEPE_API tsepepe_result* tsepepe_generate_missing_definitions(tsepepe_session*,
+                                                                 const char* const* header_paths,
+                                                                 size_t header_paths_count,
+                                                                 const tsepepe_cancellation_token*);
+
+/** The lines selected within a file; the first line is 1, and the selection includes the last line. */
+typedef struct tsepepe_selection_request
+{
+    tsepepe_source_file file;
+    unsigned selected_line_begin;
+    unsigned selected_line_end;
+} tsepepe_selection_request;
+
+/** Edits, or creates, the paired source file of the header, with the definitions of the selected declarations. */
+TSEPEPE_API tsepepe_result* tsepepe_generate_definitions_in_paired_source(tsepepe_session*,
+                                                                          const tsepepe_selection_request*,
+                                                                          const tsepepe_cancellation_token*);
+
+/** Produces the text with the definitions of the selected declarations; no file is edited. */
+TSEPEPE_API tsepepe_result* tsepepe_generate_function_definitions(tsepepe_session*,
+                                                                  const tsepepe_selection_request*,
+                                                                  const tsepepe_cancellation_token*);
+
+/**
+ * Parses ahead the file, e.g. when it is opened within the editor, together with its paired files, and the interfaces
+ * it includes, so that the first request on the file is as fast as the next ones. The parsed files are kept by the
+ * session, for the implement interfaces, and both the generate definitions requests. Parses on a worker thread of the
+ * library, at the background priority, which is never set for the calling thread; meant to be called from a worker
+ * thread of the editor, and cancelled, once the file is closed.
+ */
+TSEPEPE_API tsepepe_result* tsepepe_warm_up(tsepepe_session*,
+                                            const tsepepe_source_file*,
+                                            const tsepepe_cancellation_token*);
+
+/**
+ * Stores the code generation cache, and the snapshot of the parsed files, under the cache directory, so that the next
+ * session, e.g. after a restart, need not parse the files again, as long as they are unchanged. Meant to be called
+ * periodically, since the session may not be closed cleanly; does nothing without the cache directory. The requests
+ * parsing the files wait meanwhile.
+ */
+TSEPEPE_API tsepepe_result* tsepepe_session_checkpoint(tsepepe_session*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TSEPEPE_H */
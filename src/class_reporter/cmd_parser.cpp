@@ -0,0 +1,74 @@
+/**
+ * @file	cmd_parser.cpp
+ * @brief	Implements command parsing for the class reporter.
+ */
+#include <filesystem>
+#include <iostream>
+
+#include "cmd_parser.hpp"
+#include "tool.hpp"
+
+#include "clang_ast_utils.hpp"
+#include "cmd_utils.hpp"
+#include "error.hpp"
+
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static fs::path parse_and_validate_temporary_file_path(const char*);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe::ClassReporter
+{
+
+std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
+{
+    if (Tsepepe::utils::cmd::is_command_help_requested(argc, argv))
+    {
+        print_usage(argc, argv);
+        return ReturnCode{0};
+    }
+
+    if (argc < 5)
+    {
+        std::cerr << "ERROR: Wrong number of arguments provided!\n" << std::endl;
+        print_usage(argc, argv);
+        return ReturnCode{1};
+    }
+
+    try
+    {
+        Input result;
+        result.compilation_database_ptr = Tsepepe::utils::clang_ast::parse_compilation_database(argv[1]);
+
+        auto& params{result.parameters};
+        params.source_file_path = parse_and_validate_temporary_file_path(argv[2]);
+        params.source_file_content = Tsepepe::utils::cmd::parse_source_file_content(argv[3]);
+        for (int i{4}; i < argc; ++i)
+            params.class_names.emplace_back(argv[i]);
+        return result;
+    } catch (const Tsepepe::Error& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return ReturnCode{1};
+    }
+}
+
+} // namespace Tsepepe::ClassReporter
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static fs::path parse_and_validate_temporary_file_path(const char* path_raw)
+{
+    fs::path path{path_raw};
+    fs::path parent_path{path.has_filename() ? path.parent_path() : path};
+    if (not fs::exists(parent_path))
+        throw Tsepepe::Error{"Parent path: " + parent_path.string() + " of the path: " + path.string()
+                             + " does not exist!"};
+    return path;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file        cmd_parser.hpp
+ * @brief       Command line parser for the class reporter.
+ */
+#ifndef CMD_PARSER_HPP
+#define CMD_PARSER_HPP
+
+#include <variant>
+
+#include "input.hpp"
+
+namespace Tsepepe::ClassReporter
+{
+
+using ReturnCode = int;
+std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv);
+
+} // namespace Tsepepe::ClassReporter
+
+#endif /* CMD_PARSER_HPP */
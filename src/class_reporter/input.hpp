@@ -0,0 +1,23 @@
+/**
+ * @file        input.hpp
+ * @brief       Input for the class reporter.
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <memory>
+
+#include "class_reporter.hpp"
+
+namespace Tsepepe::ClassReporter
+{
+
+struct Input
+{
+    std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
+    ClassReportParameters parameters;
+};
+
+} // namespace Tsepepe::ClassReporter
+
+#endif /* INPUT_HPP */
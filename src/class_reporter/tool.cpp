@@ -0,0 +1,67 @@
+/**
+ * @file	tool.cpp
+ * @brief	Main entry point for the class reporter.
+ */
+
+#include <iostream>
+
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "base_error.hpp"
+#include "cmd_parser.hpp"
+#include "input.hpp"
+#include "tool.hpp"
+
+#include "class_reporter.hpp"
+
+using namespace Tsepepe::ClassReporter;
+
+int Tsepepe::ClassReporter::run(int argc, const char** argv)
+{
+    auto input_or_return_code{parse_cmd(argc, argv)};
+    if (std::holds_alternative<ReturnCode>(input_or_return_code))
+        return std::get<ReturnCode>(input_or_return_code);
+
+    auto input{std::move(std::get<Input>(input_or_return_code))};
+
+    try
+    {
+        auto result{Tsepepe::ClassReporterLibclangBased{std::move(input.compilation_database_ptr)}.report(
+            std::move(input.parameters))};
+
+        if (result.empty())
+        {
+            std::cerr << "ERROR: No class found!\n" << std::endl;
+            return 1;
+        }
+
+        llvm::json::OStream json{llvm::outs(), 2};
+        json.object([&] {
+            for (const auto& [class_name, report] : result)
+                json.attributeObject(class_name, [&] {
+                    json.attribute("qualified_name", report.qualified_name);
+                    json.attribute("is_abstract", report.is_abstract);
+                    json.attributeArray("bases", [&] {
+                        for (const auto& base : report.bases)
+                            json.value(base);
+                    });
+                    json.attributeArray("pure_virtual_override_declarations", [&] {
+                        for (const auto& declaration : report.pure_virtual_override_declarations)
+                            json.value(declaration);
+                    });
+                    json.attributeObject("suitable_public_method_place", [&] {
+                        json.attribute("offset", report.suitable_public_method_place.offset);
+                        json.attribute("is_public_section_needed",
+                                       report.suitable_public_method_place.is_public_section_needed);
+                    });
+                });
+        });
+        llvm::outs() << '\n';
+        return 0;
+    } catch (const Tsepepe::BaseError& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
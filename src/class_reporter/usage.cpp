@@ -0,0 +1,36 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the class reporter.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::ClassReporter::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " SOURCE_FILE_PATH"
+                 " SOURCE_FILE_CONTENT"
+                 " CLASS_NAME..."
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tReports, for each class called CLASS_NAME, defined within the SOURCE_FILE_CONTENT: its full name,"
+                 "\n\twhether it is abstract, its direct base classes, its pure virtual functions as override"
+                 "\n\tdeclarations, and the suitable place (the offset within SOURCE_FILE_CONTENT) to put a new"
+                 "\n\tpublic method, together with the information whether a 'public:' section must be added there."
+                 "\n\tThe file is parsed only once, for all the classes."
+                 "\n\n\tThe path to the source file (SOURCE_FILE_PATH) is needed to properly resolve the includes."
+                 "\n\n\tThe SOURCE_FILE_CONTENT may be '-', to read the content from the standard input, or '@PATH', to"
+                 "\n\tread it from the file under the PATH, e.g. when the content is too long for the command line."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tThe output is a JSON object, which maps each class name to its report. The classes, which are"
+                 "\n\tnot found, are not present in the output."
+                 "\n\n"
+              << std::endl;
+}
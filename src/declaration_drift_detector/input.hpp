@@ -0,0 +1,23 @@
+/**
+ * @file        input.hpp
+ * @brief       Input for the declaration drift detector.
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <memory>
+
+#include "declaration_drift_detector.hpp"
+
+namespace Tsepepe::DeclarationDriftDetector
+{
+
+struct Input
+{
+    std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
+    DeclarationDriftDetectionParameters parameters;
+};
+
+} // namespace Tsepepe::DeclarationDriftDetector
+
+#endif /* INPUT_HPP */
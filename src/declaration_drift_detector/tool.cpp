@@ -0,0 +1,64 @@
+/**
+ * @file	tool.cpp
+ * @brief	Main entry point for the declaration drift detector.
+ */
+
+#include <iostream>
+
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "base_error.hpp"
+#include "cmd_parser.hpp"
+#include "input.hpp"
+#include "tool.hpp"
+
+#include "declaration_drift_detector.hpp"
+
+using namespace Tsepepe::DeclarationDriftDetector;
+
+int Tsepepe::DeclarationDriftDetector::run(int argc, const char** argv)
+{
+    auto input_or_return_code{parse_cmd(argc, argv)};
+    if (std::holds_alternative<ReturnCode>(input_or_return_code))
+        return std::get<ReturnCode>(input_or_return_code);
+
+    auto input{std::move(std::get<Input>(input_or_return_code))};
+
+    try
+    {
+        auto report{Tsepepe::DeclarationDriftDetectorLibclangBased{std::move(input.compilation_database_ptr)}.detect(
+            std::move(input.parameters))};
+
+        llvm::json::OStream json{llvm::outs(), 2};
+        json.object([&] {
+            json.attributeArray("undefined_declarations", [&] {
+                for (const auto& undefined : report.undefined_declarations)
+                    json.object([&] {
+                        json.attribute("expected_definition", undefined.expected_definition);
+                        json.attribute("declaration_file", undefined.declaration_location.file.string());
+                        json.attribute("declaration_line", undefined.declaration_location.line);
+                    });
+            });
+            json.attributeArray("signature_mismatches", [&] {
+                for (const auto& mismatch : report.signature_mismatches)
+                    json.object([&] {
+                        json.attribute("expected_definition", mismatch.expected_definition);
+                        json.attribute("declaration_file", mismatch.declaration_location.file.string());
+                        json.attribute("declaration_line", mismatch.declaration_location.line);
+                        json.attribute("actual_definition", mismatch.actual_definition);
+                        json.attribute("definition_file", mismatch.definition_location.file.string());
+                        json.attribute("definition_line", mismatch.definition_location.line);
+                    });
+            });
+        });
+        llvm::outs() << '\n';
+
+        bool is_drift_found{not report.undefined_declarations.empty() or not report.signature_mismatches.empty()};
+        return is_drift_found ? 2 : 0;
+    } catch (const Tsepepe::BaseError& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
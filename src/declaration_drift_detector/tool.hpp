@@ -0,0 +1,19 @@
+/**
+ * @file        tool.hpp
+ * @brief       Entry points of the declaration drift detector, dispatched to by the tsepepe multi-call binary.
+ */
+#ifndef DECLARATION_DRIFT_DETECTOR_TOOL_HPP
+#define DECLARATION_DRIFT_DETECTOR_TOOL_HPP
+
+namespace Tsepepe::DeclarationDriftDetector
+{
+
+//! Runs the tool with the given command line arguments, as if it were a standalone program; returns its exit code.
+int run(int argc, const char** argv);
+
+//! Depends on the standard library only, so that the usage is printed without loading the clang libraries.
+void print_usage(int argc, const char** argv);
+
+} // namespace Tsepepe::DeclarationDriftDetector
+
+#endif /* DECLARATION_DRIFT_DETECTOR_TOOL_HPP */
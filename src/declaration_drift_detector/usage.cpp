@@ -0,0 +1,51 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the declaration drift detector.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::DeclarationDriftDetector::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " ROOT_DIRECTORY"
+                 " [CACHE_DIRECTORY]"
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tScans all the translation units from the compilation database, in parallel, to find the"
+                 "\n\tfunction declarations, which have no definition within the project, or whose definition"
+                 "\n\tno longer matches the declaration. Declarations and definitions are paired across the"
+                 "\n\ttranslation units with their USRs. Only the files under ROOT_DIRECTORY are taken into account."
+                 "\n\n\tThe results of each translation unit are cached within CACHE_DIRECTORY, which defaults to"
+                 "\n\t'ROOT_DIRECTORY/.cache/tsepepe'. A translation unit is scanned again only when its compile"
+                 "\n\tcommand, or any of its files under ROOT_DIRECTORY, has changed."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tThe output is a JSON object with two arrays: 'undefined_declarations' and"
+                 "\n\t'signature_mismatches'. The return code is 2 when any drift is found, 0 otherwise."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving a header with 'int compute(int value);' declared, and a source file, which includes"
+                 "\n\tthe header, with 'int compute(long value) { return 0; }' defined, the output will be:"
+                 "\n\n\t\t{"
+                 "\n\t\t  \"undefined_declarations\": [],"
+                 "\n\t\t  \"signature_mismatches\": ["
+                 "\n\t\t    {"
+                 "\n\t\t      \"expected_definition\": \"int compute(int value)\","
+                 "\n\t\t      \"declaration_file\": \"<PROJECT_ROOT>/compute.hpp\","
+                 "\n\t\t      \"declaration_line\": 1,"
+                 "\n\t\t      \"actual_definition\": \"int compute(long value)\","
+                 "\n\t\t      \"definition_file\": \"<PROJECT_ROOT>/compute.cpp\","
+                 "\n\t\t      \"definition_line\": 3"
+                 "\n\t\t    }"
+                 "\n\t\t  ]"
+                 "\n\t\t}"
+                 "\n"
+              << std::endl;
+}
@@ -7,6 +7,7 @@
 #include <clang/ASTMatchers/ASTMatchers.h>
 #include <clang/Tooling/Tooling.h>
 
+#include <optional>
 #include <regex>
 
 #include "expander.hpp"
@@ -20,33 +21,40 @@ namespace ast = clang::ast_matchers;
 class ClassNameExpander : public ast::MatchFinder::MatchCallback
 {
   public:
+    ClassNameExpander(Tsepepe::FullClassNameExpander::FullClassNames& full_class_names,
+                      std::optional<std::string> queried_class_name) :
+        full_class_names{full_class_names}, queried_class_name{std::move(queried_class_name)}
+    {
+    }
+
     void run(const ast::MatchFinder::MatchResult& result) override
     {
         auto node{result.Nodes.getNodeAs<CXXRecordDecl>("class")};
         if (node == nullptr)
             return;
 
-        full_class_name = node->getQualifiedNameAsString();
-    }
-
-    const std::string& get_result()
-    {
-        return full_class_name;
+        auto full_class_name{node->getQualifiedNameAsString()};
+        auto key{queried_class_name ? *queried_class_name : full_class_name};
+        full_class_names.insert_or_assign(std::move(key), std::move(full_class_name));
     }
 
   private:
-    std::string full_class_name;
+    Tsepepe::FullClassNameExpander::FullClassNames& full_class_names;
+    std::optional<std::string> queried_class_name;
 };
 
-std::string Tsepepe::FullClassNameExpander::expand(const Input& input)
+Tsepepe::FullClassNameExpander::FullClassNames Tsepepe::FullClassNameExpander::expand(const Input& input)
 {
-    auto class_matcher{ast_matchers::cxxRecordDecl(ast_matchers::hasName(input.class_name),
-                                                   ast_matchers::unless(ast_matchers::isImplicit()))
-                           .bind("class")};
+    FullClassNames result;
 
     ast::MatchFinder finder;
-    ClassNameExpander expander;
-    finder.addMatcher(class_matcher, &expander);
+    auto expanders{Tsepepe::utils::clang_ast::add_class_matchers(
+        finder,
+        input.class_query,
+        ast_matchers::unless(ast_matchers::isImplicit()),
+        [&](std::optional<std::string> queried_class_name) {
+            return std::make_unique<ClassNameExpander>(result, std::move(queried_class_name));
+        })};
 
     ClangTool tool{*input.compilation_database_ptr, {input.header_file}};
 
@@ -55,5 +63,5 @@ std::string Tsepepe::FullClassNameExpander::expand(const Input& input)
 
     tool.run(newFrontendActionFactory(&finder).get());
 
-    return expander.get_result();
+    return result;
 }
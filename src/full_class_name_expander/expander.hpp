@@ -5,15 +5,19 @@
 #ifndef EXTRACTOR_HPP
 #define EXTRACTOR_HPP
 
+#include <map>
 #include <string>
-#include <vector>
 
 #include "input.hpp"
 
 namespace Tsepepe::FullClassNameExpander
 {
 
-std::string expand(const Input& input);
+//! Maps the queried class name (or the full class name, when all the classes are queried) to its full class name.
+using FullClassNames = std::map<std::string, std::string>;
+
+//! Finds all the queried classes within a single pass over the header; the classes not found are absent.
+FullClassNames expand(const Input& input);
 
 }
 
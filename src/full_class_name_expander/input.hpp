@@ -10,6 +10,8 @@
 
 #include <clang/Tooling/CompilationDatabase.h>
 
+#include "cmd_utils.hpp"
+
 namespace Tsepepe::FullClassNameExpander
 {
 
@@ -17,7 +19,7 @@ struct Input
 {
     std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
     std::filesystem::path header_file;
-    std::string class_name;
+    Tsepepe::utils::cmd::ClassQuery class_query;
 };
 
 } // namespace Tsepepe::FullClassNameExpander
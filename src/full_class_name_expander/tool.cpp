@@ -5,26 +5,41 @@
 
 #include <iostream>
 
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
 #include "cmd_parser.hpp"
 #include "expander.hpp"
 #include "input.hpp"
+#include "tool.hpp"
 
 using namespace Tsepepe::FullClassNameExpander;
 
-int main(int argc, const char* argv[])
+int Tsepepe::FullClassNameExpander::run(int argc, const char** argv)
 {
     auto input_or_return_code{parse_cmd(argc, argv)};
     if (std::holds_alternative<ReturnCode>(input_or_return_code))
         return std::get<ReturnCode>(input_or_return_code);
 
     const auto& input{std::get<Input>(input_or_return_code)};
-    auto full_class_name{expand(input)};
-    if (full_class_name.empty())
+    auto full_class_names{expand(input)};
+    if (full_class_names.empty())
     {
         std::cerr << "ERROR: Class name could not be expanded!" << std::endl;
         return 1;
     }
 
-    std::cout << full_class_name;
+    if (input.class_query.is_single_class())
+    {
+        std::cout << full_class_names.begin()->second;
+        return 0;
+    }
+
+    llvm::json::OStream json{llvm::outs(), 2};
+    json.object([&] {
+        for (const auto& [class_name, full_class_name] : full_class_names)
+            json.attribute(class_name, full_class_name);
+    });
+    llvm::outs() << '\n';
     return 0;
 }
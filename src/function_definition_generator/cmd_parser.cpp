@@ -2,10 +2,13 @@
  * @file	cmd_parser.cpp
  * @brief	Implements command parsing for the function definition generator.
  */
+#include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <string>
 
 #include "cmd_parser.hpp"
+#include "tool.hpp"
 
 #include "clang_ast_utils.hpp"
 #include "cmd_utils.hpp"
@@ -17,8 +20,9 @@ namespace fs = std::filesystem;
 // --------------------------------------------------------------------------------------------------------------------
 // Private declarations
 // --------------------------------------------------------------------------------------------------------------------
-static void print_usage(int argc, const char** argv);
 static fs::path parse_and_validate_temporary_file_path(const char*);
+static bool is_line_range_form(int argc, const char** argv);
+static Tsepepe::LineRange parse_and_validate_line_range(const char*);
 
 // --------------------------------------------------------------------------------------------------------------------
 // Public stuff
@@ -34,7 +38,8 @@ std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
         return ReturnCode{0};
     }
 
-    if (argc != 5 and argc != 6)
+    bool line_range_form{is_line_range_form(argc, argv)};
+    if (argc < 5 or (not line_range_form and argc > 6))
     {
         std::cerr << "ERROR: Wrong number of arguments provided!\n" << std::endl;
         print_usage(argc, argv);
@@ -48,14 +53,25 @@ std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
 
         GenerateFunctionDefinitionsCodeActionParameters params;
         params.source_file_path = parse_and_validate_temporary_file_path(argv[2]);
-        params.source_file_content = argv[3];
-        params.selected_line_begin = Tsepepe::utils::cmd::parse_and_validate_number(argv[4]);
-        if (argc == 6)
-            params.selected_line_end = Tsepepe::utils::cmd::parse_and_validate_number(argv[5]);
-        else
-            params.selected_line_end = params.selected_line_begin;
+        params.source_file_content = Tsepepe::utils::cmd::parse_source_file_content(argv[3]);
+        if (line_range_form)
+        {
+            auto [begin, end] = parse_and_validate_line_range(argv[4]);
+            params.selected_line_begin = begin;
+            params.selected_line_end = end;
+            for (int i{5}; i < argc; ++i)
+                params.additional_selected_line_ranges.push_back(parse_and_validate_line_range(argv[i]));
+        } else
+        {
+            params.selected_line_begin = Tsepepe::utils::cmd::parse_and_validate_number(argv[4]);
+            if (argc == 6)
+                params.selected_line_end = Tsepepe::utils::cmd::parse_and_validate_number(argv[5]);
+            else
+                params.selected_line_end = params.selected_line_begin;
+        }
 
         result.parameters = std::move(params);
+        result.print_per_range = line_range_form;
         return result;
     } catch (const Tsepepe::Error& e)
     {
@@ -69,31 +85,6 @@ std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
 // --------------------------------------------------------------------------------------------------------------------
 // Private definitions
 // --------------------------------------------------------------------------------------------------------------------
-static void print_usage(int argc, const char** argv)
-{
-    auto program_path{argv[0]};
-    std::cout << "USAGE:\n\t" << program_path
-              << " COMP_DB_DIR"
-                 " SOURCE_FILE_PATH"
-                 " SOURCE_FILE_CONTENT"
-                 " CURSOR_POSITION_LINE_BEGIN"
-                 " [CURSOR_POSITION_LINE_END]"
-                 " \n\n";
-    std::cout << "DESCRIPTION:"
-                 "\n\tTakes the entire source file (SOURCE_FILE_CONTENT) and generates function definitions"
-                 "\n\tfor each function declaration which can be found in the range of lines"
-                 "\n\t<CURSOR_POSITION_LINE_BEGIN; CURSOR_POSITION_LINE_END>. The CURSOR_POSITION_LINE_END is"
-                 "\n\toptional. When it is not set, then the definition for a declaration found at"
-                 "\n\tCURSOR_POSITION_LINE_BEGIN will only be generated."
-                 "\n\n\tThe path to the source file (SOURCE_FILE_PATH) is needed to properly resolve the includes,"
-                 "\n\tthat might be found within the source file. The content of the file must be supplied as is"
-                 "\n\twith the SOURCE_FILE_CONTENT parameter. Ideally, the newline separator should be '\\n 'character."
-                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
-                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
-                 "\n\n"
-              << std::endl;
-}
-
 static fs::path parse_and_validate_temporary_file_path(const char* path_raw)
 {
     fs::path path{path_raw};
@@ -103,3 +94,24 @@ static fs::path parse_and_validate_temporary_file_path(const char* path_raw)
                              + " does not exist!"};
     return path;
 }
+
+static bool is_line_range_form(int argc, const char** argv)
+{
+    for (int i{4}; i < argc; ++i)
+        if (std::strchr(argv[i], '-') != nullptr)
+            return true;
+    return false;
+}
+
+static Tsepepe::LineRange parse_and_validate_line_range(const char* range_raw)
+{
+    std::string range{range_raw};
+    auto separator_position{range.find('-')};
+    if (separator_position == std::string::npos)
+        throw Tsepepe::Error{"Line range: " + range + " is not in the form: LINE_BEGIN-LINE_END!"};
+
+    auto begin{range.substr(0, separator_position)};
+    auto end{range.substr(separator_position + 1)};
+    return {.begin = static_cast<unsigned>(Tsepepe::utils::cmd::parse_and_validate_number(begin.c_str())),
+            .end = static_cast<unsigned>(Tsepepe::utils::cmd::parse_and_validate_number(end.c_str()))};
+}
@@ -17,6 +17,8 @@ struct Input
 {
     std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
     GenerateFunctionDefinitionsCodeActionParameters parameters;
+    //! Set when the selection is given as line ranges; then the definitions are printed as a JSON array per range.
+    bool print_per_range{false};
 };
 
 } // namespace Tsepepe::FunctionDefinitionGenerator
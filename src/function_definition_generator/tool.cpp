@@ -4,7 +4,11 @@
  */
 #include <iostream>
 
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
 #include "cmd_parser.hpp"
+#include "tool.hpp"
 
 #include "base_error.hpp"
 #include "generate_function_definitions_code_action.hpp"
@@ -12,7 +16,7 @@
 using namespace Tsepepe;
 using namespace Tsepepe::FunctionDefinitionGenerator;
 
-int main(int argc, const char** argv)
+int Tsepepe::FunctionDefinitionGenerator::run(int argc, const char** argv)
 {
     auto input_or_return_code{parse_cmd(argc, argv)};
     if (std::holds_alternative<ReturnCode>(input_or_return_code))
@@ -22,6 +26,20 @@ int main(int argc, const char** argv)
 
     try
     {
+        if (input.print_per_range)
+        {
+            auto result{GenerateFunctionDefinitionsCodeActionLibclangBased{std::move(input.compilation_database_ptr)}
+                            .apply_per_range(std::move(input.parameters))};
+
+            llvm::json::OStream json{llvm::outs(), 2};
+            json.array([&] {
+                for (const auto& definitions : result)
+                    json.value(definitions);
+            });
+            llvm::outs() << '\n';
+            return 0;
+        }
+
         auto result{GenerateFunctionDefinitionsCodeActionLibclangBased{std::move(input.compilation_database_ptr)}.apply(
             std::move(input.parameters))};
 
@@ -0,0 +1,19 @@
+/**
+ * @file        tool.hpp
+ * @brief       Entry points of the function definition generator, dispatched to by the tsepepe multi-call binary.
+ */
+#ifndef FUNCTION_DEFINITION_GENERATOR_TOOL_HPP
+#define FUNCTION_DEFINITION_GENERATOR_TOOL_HPP
+
+namespace Tsepepe::FunctionDefinitionGenerator
+{
+
+//! Runs the tool with the given command line arguments, as if it were a standalone program; returns its exit code.
+int run(int argc, const char** argv);
+
+//! Depends on the standard library only, so that the usage is printed without loading the clang libraries.
+void print_usage(int argc, const char** argv);
+
+} // namespace Tsepepe::FunctionDefinitionGenerator
+
+#endif /* FUNCTION_DEFINITION_GENERATOR_TOOL_HPP */
@@ -0,0 +1,45 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the function definition generator.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::FunctionDefinitionGenerator::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " SOURCE_FILE_PATH"
+                 " SOURCE_FILE_CONTENT"
+                 " CURSOR_POSITION_LINE_BEGIN"
+                 " [CURSOR_POSITION_LINE_END]"
+                 " \n\t" << program_path
+              << " COMP_DB_DIR"
+                 " SOURCE_FILE_PATH"
+                 " SOURCE_FILE_CONTENT"
+                 " LINE_BEGIN-LINE_END..."
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tTakes the entire source file (SOURCE_FILE_CONTENT) and generates function definitions"
+                 "\n\tfor each function declaration which can be found in the range of lines"
+                 "\n\t<CURSOR_POSITION_LINE_BEGIN; CURSOR_POSITION_LINE_END>. The CURSOR_POSITION_LINE_END is"
+                 "\n\toptional. When it is not set, then the definition for a declaration found at"
+                 "\n\tCURSOR_POSITION_LINE_BEGIN will only be generated."
+                 "\n\n\tThe second form takes one or more disjoint ranges of lines, e.g. '3-5 10-12', which are all"
+                 "\n\tresolved against a single parse of the file. Then, the output is a JSON array with the"
+                 "\n\tdefinitions generated for each range, in the order of the ranges."
+                 "\n\n\tThe path to the source file (SOURCE_FILE_PATH) is needed to properly resolve the includes,"
+                 "\n\tthat might be found within the source file. The content of the file must be supplied as is"
+                 "\n\twith the SOURCE_FILE_CONTENT parameter. Ideally, the newline separator should be '\\n 'character."
+                 "\n\n\tThe SOURCE_FILE_CONTENT may be '-', to read the content from the standard input, or '@PATH', to"
+                 "\n\tread it from the file under the PATH, e.g. when the content is too long for the command line."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n"
+              << std::endl;
+}
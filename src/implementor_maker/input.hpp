@@ -17,6 +17,8 @@ struct Input
 {
     std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
     ImplementInterfaceCodeActionParameters parameters;
+    //! Empty if the generated code shall not be cached.
+    std::filesystem::path cache_directory;
 };
 
 } // namespace Tsepepe::ImplementorMaker
@@ -8,12 +8,14 @@
 #include "base_error.hpp"
 #include "cmd_parser.hpp"
 #include "input.hpp"
+#include "tool.hpp"
 
+#include "code_generation_cache.hpp"
 #include "implement_interface_code_action.hpp"
 
 using namespace Tsepepe::ImplementorMaker;
 
-int main(int argc, const char* argv[])
+int Tsepepe::ImplementorMaker::run(int argc, const char** argv)
 {
     auto input_or_return_code{parse_cmd(argc, argv)};
     if (std::holds_alternative<ReturnCode>(input_or_return_code))
@@ -23,8 +25,16 @@ int main(int argc, const char* argv[])
 
     try
     {
-        auto result{Tsepepe::ImplementIntefaceCodeActionLibclangBased{std::move(input.compilation_database_ptr)}.apply(
-            std::move(input.parameters))};
+        std::shared_ptr<Tsepepe::CodeGenerationCache> code_generation_cache;
+        if (not input.cache_directory.empty())
+            code_generation_cache = std::make_shared<Tsepepe::CodeGenerationCache>(input.cache_directory
+                                                                                   / "code_generation_cache.json");
+
+        auto result{Tsepepe::ImplementIntefaceCodeActionLibclangBased{std::move(input.compilation_database_ptr),
+                                                                      code_generation_cache}
+                        .apply(std::move(input.parameters))};
+        if (code_generation_cache)
+            code_generation_cache->store();
         std::cout << result;
         return 0;
     } catch (const Tsepepe::BaseError& e)
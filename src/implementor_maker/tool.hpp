@@ -0,0 +1,19 @@
+/**
+ * @file        tool.hpp
+ * @brief       Entry points of the implementor maker, dispatched to by the tsepepe multi-call binary.
+ */
+#ifndef IMPLEMENTOR_MAKER_TOOL_HPP
+#define IMPLEMENTOR_MAKER_TOOL_HPP
+
+namespace Tsepepe::ImplementorMaker
+{
+
+//! Runs the tool with the given command line arguments, as if it were a standalone program; returns its exit code.
+int run(int argc, const char** argv);
+
+//! Depends on the standard library only, so that the usage is printed without loading the clang libraries.
+void print_usage(int argc, const char** argv);
+
+} // namespace Tsepepe::ImplementorMaker
+
+#endif /* IMPLEMENTOR_MAKER_TOOL_HPP */
@@ -0,0 +1,77 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the implementor maker.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::ImplementorMaker::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " ROOT_DIRECTORY"
+                 " SOURCE_FILE_PATH"
+                 " SOURCE_FILE_CONTENT"
+                 " INTERFACE_NAMES"
+                 " CURSOR_POSITION_LINE"
+                 " [CACHE_DIRECTORY]"
+                 " [--format[=STYLE]]"
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tTakes the entire source file (SOURCE_FILE_CONTENT) with a class definition,"
+                 "\n\twhich can be found at line CURSOR_POSITION_LINE."
+                 "\n\n\tThe line number must be within the class (or struct) source range."
+                 "\n\n\tThe path to the source file (SOURCE_FILE_PATH) is needed to properly resolve the includes,"
+                 "\n\tthat might be found within the source file."
+                 "\n\n\tThe SOURCE_FILE_CONTENT may be '-', to read the content from the standard input, or '@PATH', to"
+                 "\n\tread it from the file under the PATH, e.g. when the content is too long for the command line."
+                 "\n\n\tThe ROOT_DIRECTORY is needed to find the INTERFACE_NAMES recursively,"
+                 "\n\twithin the project's C++ source files."
+                 "\n\n\tThe INTERFACE_NAMES is a comma-separated list of the interfaces to implement, e.g."
+                 "\n\t'Runnable,Printable'. All of them are implemented at once. When multiple interfaces declare"
+                 "\n\tthe same pure virtual function, it is overridden once."
+                 "\n\n\tEach interface name may be a raw name, thus, when it is a nested interface,"
+                 "\n\twithin another class or a namespace, then the bare name, without the parent scope,"
+                 "\n\tmust be specified (e.g. for 'Namespace::Interface' simply pass 'Interface')."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tWhen the CACHE_DIRECTORY is given, the generated overrides are cached there, so that the"
+                 "\n\tsame interface implemented again, within the same scope, and with its headers unchanged, skips"
+                 "\n\tthe code generation."
+                 "\n\n\tWith the --format option, the generated code is formatted with clang-format, in-process;"
+                 "\n\tthe rest of the file is left untouched. The STYLE is as the clang-format -style option, e.g."
+                 "\n\t'LLVM', or 'file' (the default), to look up the .clang-format file."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving a project under path <PROJECT_ROOT>, and an interface defined within a file "
+                 "'src/include/yolo_interface.hpp', with content:"
+                 "\n\n\t\tnamespace Tsepepe"
+                 "\n\t\t{"
+                 "\n\t\tstruct YoloInterface"
+                 "\n\t\t{"
+                 "\n\t\t    virtual void do_stuff() = 0;"
+                 "\n\t\t    virtual ~YoloInterface() = default;"
+                 "\n\t\t};"
+                 "\n\t\t} // namespace Tsepepe"
+                 "\n\t\t"
+                 "\n\n\tWhen the tool is called like that:"
+                 "\n\n\t\ttsepepe_implementor_maker"
+                 "\n\t\t\t<PROJECT_ROOT>/build               # The path to the directory with the compile_commands.json"
+                 "\n\t\t\t<PROJECT_ROOT>                     # The project root directory"
+                 "\n\t\t\t<PROJECT_ROOT>/src/implementor.hpp # Path to the file with the potential implementor"
+                 "\n\t\t\t'struct Implementor { };'          # The source file content"
+                 "\n\t\t\tYoloInterface                      # The inteface name."
+                 "\n\t\t\t1                                  # The first line contains the Implementor definition."
+                 "\n\n\tThe output will be:"
+                 "\n\n\t\t#include \"yolo_interface.hpp\""
+                 "\n\t\tstruct Implementor : Tsepepe::YoloInterface {"
+                 "\n\t\t    void do_stuff() override;"
+                 "\n\t\t};"
+                 "\n"
+              << std::endl;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file        bulk_file_reader.hpp
+ * @brief       Reads plenty of small files at once, e.g. all the project files, when building an index.
+ */
+#ifndef BULK_FILE_READER_HPP
+#define BULK_FILE_READER_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+#include <llvm/ADT/STLFunctionalExtras.h>
+#include <llvm/ADT/StringRef.h>
+
+namespace Tsepepe
+{
+
+/**
+ * @brief Takes the content of a read file, or nullopt, if the file cannot be read.
+ *
+ * The content is followed by a null character, e.g. for the clang::Lexer, and lives only until the consumer returns,
+ * since its buffer is reused for the next files; the consumer shall scan it, or hash it, right away.
+ */
+using FileContentConsumer = llvm::function_ref<void(std::size_t file_index, std::optional<llvm::StringRef> content)>;
+
+/**
+ * @brief Reads the files, passing the content of each to the consumer, in the order of completion.
+ *
+ * On Linux, when built with io_uring support (see TSEPEPE_ENABLE_IO_URING), the opens and the reads are batched
+ * through an io_uring, with at most max_in_flight files being read at once, so that the syscall latency is paid per
+ * batch, rather than per file. The files are read synchronously, one by one, when the io_uring is not available, e.g.
+ * is disabled by the kernel; a file, which the io_uring fails to read, is then read synchronously, too.
+ *
+ * The consumer is always called on the calling thread. When it throws, reading stops, and the exception is passed to
+ * the caller.
+ */
+void read_files_in_bulk(std::span<const std::filesystem::path>, FileContentConsumer, std::size_t max_in_flight = 64);
+
+} // namespace Tsepepe
+
+#endif /* BULK_FILE_READER_HPP */
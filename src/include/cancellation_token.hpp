@@ -0,0 +1,58 @@
+/**
+ * @file        cancellation_token.hpp
+ * @brief       Cancellation of the code actions, e.g. by an editor, which is no longer interested in the result.
+ */
+#ifndef CANCELLATION_TOKEN_HPP
+#define CANCELLATION_TOKEN_HPP
+
+#include <atomic>
+#include <memory>
+
+#include "base_error.hpp"
+
+namespace Tsepepe
+{
+
+//! Thrown by the code action, which has been cancelled.
+struct OperationCancelled : BaseError
+{
+    using BaseError::BaseError;
+};
+
+/**
+ * @brief Tells the code action to stop, from another thread.
+ *
+ * The copies of the token share the state, so the caller keeps a copy, and passes another one with the parameters of
+ * the code action. The code action checks the token before each parse, i.e. a parse, which has begun, is completed,
+ * but no further one is started; then OperationCancelled is thrown.
+ */
+class CancellationToken
+{
+  public:
+    CancellationToken() : cancelled{std::make_shared<std::atomic<bool>>(false)}
+    {
+    }
+
+    void cancel()
+    {
+        cancelled->store(true, std::memory_order_relaxed);
+    }
+
+    bool is_cancelled() const
+    {
+        return cancelled->load(std::memory_order_relaxed);
+    }
+
+    void throw_if_cancelled() const
+    {
+        if (is_cancelled())
+            throw OperationCancelled{"The operation has been cancelled!"};
+    }
+
+  private:
+    std::shared_ptr<std::atomic<bool>> cancelled;
+};
+
+} // namespace Tsepepe
+
+#endif /* CANCELLATION_TOKEN_HPP */
@@ -0,0 +1,80 @@
+/**
+ * @file        clangd_index.hpp
+ * @brief       Answers the class queries from the background index of clangd, when it is up to date.
+ */
+#ifndef CLANGD_INDEX_HPP
+#define CLANGD_INDEX_HPP
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "class_index.hpp"
+
+namespace Tsepepe
+{
+
+//! Where clangd keeps the background index of the project, i.e. ROOT_DIRECTORY/.cache/clangd/index.
+std::filesystem::path get_default_clangd_index_directory(const std::filesystem::path& root_directory);
+
+/**
+ * @brief Reads the shards of the clangd background index, so that the classes are found without scanning the project.
+ *
+ * The clangd background index keeps a shard per indexed file, with the symbols declared within that file, and their
+ * relations, e.g. the derived classes of a base. The shards are used only if they are fresh: the shard of each file is
+ * written after the file is last modified, each translation unit under the root directory, from the compilation
+ * database, has its shard, and all the shards are of a format version known to be read correctly. Otherwise, nothing
+ * is answered, and the callers fall back to scanning the project themselves.
+ *
+ * The index keeps the read shards, and reads again only the ones changed since, so it is meant to be long-lived, e.g.
+ * kept by an editor session. Thread safe.
+ */
+class ClangdIndex
+{
+  public:
+    //! The index directory defaults to get_default_clangd_index_directory().
+    ClangdIndex(std::shared_ptr<clang::tooling::CompilationDatabase>,
+                std::filesystem::path root_directory,
+                std::filesystem::path index_directory = {});
+
+    /**
+     * @brief Makes the class index out of the shards, or returns nullopt, if they are not fresh.
+     *
+     * The classes, and their bases, are taken from the symbols and the relations of the shards. The abstract classes
+     * are told by their pure virtual functions, found by the pure specifiers ending the canonical declarations of the
+     * functions, also the ones defined out of line, and by the pure virtual functions of the bases, which are not
+     * overridden. Nullopt is returned also when any declaration under the root directory is not lexed to its end, e.g.
+     * is expanded from a macro. The bases are not necessarily in the order of the base-clause.
+     */
+    std::optional<ClassIndex> get_class_index();
+
+    /**
+     * Finds the files under the root directory, defining the classes with the given bare names; returns nullopt if the
+     * shards are not fresh, or any of the names is not found, so that the files are looked for otherwise.
+     */
+    std::optional<std::vector<std::filesystem::path>> find_class_definition_files(const std::vector<std::string>&);
+
+  private:
+    struct Shard;
+
+    //! Reads the shards changed since the previous call; returns all the shards, or none, if they are not fresh.
+    std::optional<std::vector<std::shared_ptr<const Shard>>> read_fresh_shards();
+
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+    std::filesystem::path root_directory;
+    std::filesystem::path index_directory;
+
+    //! Keyed by the shard file path.
+    std::map<std::filesystem::path, std::shared_ptr<const Shard>> read_shards;
+    std::mutex read_shards_mutex;
+};
+
+} // namespace Tsepepe
+
+#endif /* CLANGD_INDEX_HPP */
@@ -0,0 +1,76 @@
+/**
+ * @file        class_index.hpp
+ * @brief       Indexes the classes defined within the project, together with their direct bases.
+ */
+#ifndef CLASS_INDEX_HPP
+#define CLASS_INDEX_HPP
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "common_types.hpp"
+
+namespace Tsepepe
+{
+
+struct IndexedClass
+{
+    std::string qualified_name;
+    SourceFileLocation location;
+    bool is_abstract;
+    //! The qualified names of the direct base classes, in the order of the base-clause.
+    std::vector<std::string> bases;
+
+    auto operator<=>(const IndexedClass&) const = default;
+};
+
+struct ClassIndex
+{
+    //! Sorted by the qualified name; a class visible from many translation units is present once.
+    std::vector<IndexedClass> classes;
+    //! The files under the root directory, which each translation unit, from the compilation database, consists of.
+    std::map<std::string, std::vector<std::filesystem::path>> translation_unit_files;
+};
+
+struct ClassIndexingParameters
+{
+    //! Only the classes defined within files under that directory are indexed.
+    std::filesystem::path root_directory;
+    //! Where the per translation unit results are kept between the scans; no caching when empty.
+    std::filesystem::path cache_directory;
+    //! When not empty, only the translation units under that directory are scanned; see ShardedClassIndex.
+    std::filesystem::path shard_directory;
+    //! The translation units under these directories are left out, e.g. to the shards nested within this one.
+    std::vector<std::filesystem::path> excluded_directories;
+};
+
+/**
+ * @brief Indexes all the class definitions from the project, with their direct bases.
+ *
+ * Each translation unit from the compilation database is scanned in parallel. The class templates are indexed as well,
+ * but their instantiations are not. The results of each translation unit are cached, the same way the declaration
+ * drift detector does, so that only the translation units affected by a change are scanned again.
+ *
+ * A shard of the index, i.e. the one restricted to the translation units of a subtree, is cached, and locked, apart
+ * from the other shards, so that each one is rebuilt independently. The headers included by the translation units of
+ * a shard are indexed with the shard, even if they are placed elsewhere within the root directory.
+ */
+class ClassIndexerLibclangBased
+{
+  public:
+    explicit ClassIndexerLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>);
+
+    ClassIndex index(ClassIndexingParameters);
+
+  private:
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+};
+
+} // namespace Tsepepe
+
+#endif /* CLASS_INDEX_HPP */
@@ -0,0 +1,72 @@
+/**
+ * @file        class_reporter.hpp
+ * @brief       Reports all the facts about classes, which the class-level code actions need, from a single parse.
+ */
+#ifndef CLASS_REPORTER_HPP
+#define CLASS_REPORTER_HPP
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "code_generation_cache.hpp"
+#include "source_file_content.hpp"
+
+#include "libclang_utils/pure_virtual_functions_extractor.hpp"
+#include "libclang_utils/suitable_place_in_class_finder.hpp"
+
+namespace Tsepepe
+{
+
+struct ClassReport
+{
+    std::string qualified_name;
+    bool is_abstract;
+    //! The qualified names of the direct base classes, in the order of the base-clause.
+    std::vector<std::string> bases;
+    //! As given by pure_virtual_functions_to_override_declarations(), for an implementor within the class scope.
+    OverrideDeclarations pure_virtual_override_declarations;
+    //! As given by find_suitable_place_in_class_for_public_method(); the offset is within the supplied content.
+    SuitablePublicMethodPlaceInCppFile suitable_public_method_place;
+
+    bool operator==(const ClassReport&) const = default;
+};
+
+//! Maps the queried class name to the report; the classes not found are absent.
+using ClassReports = std::map<std::string, ClassReport>;
+
+struct ClassReportParameters
+{
+    std::filesystem::path source_file_path;
+    SourceFileContent source_file_content;
+    std::vector<std::string> class_names;
+};
+
+/**
+ * @brief Answers, for each queried class defined within the file, everything what the abstract class finder, the full
+ * class name expander, the pure virtual functions extractor and the suitable place in class finder would answer.
+ *
+ * The file content is parsed once, and all the classes are found within a single MatchFinder run over that AST, with
+ * a matcher registered per queried class name.
+ */
+class ClassReporterLibclangBased
+{
+  public:
+    //! The generated code is taken from the cache, and put there, if the cache is given.
+    explicit ClassReporterLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>,
+                                        std::shared_ptr<CodeGenerationCache> = nullptr);
+
+    ClassReports report(ClassReportParameters);
+
+  private:
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+    std::shared_ptr<CodeGenerationCache> code_generation_cache;
+};
+
+} // namespace Tsepepe
+
+#endif /* CLASS_REPORTER_HPP */
@@ -0,0 +1,46 @@
+/**
+ * @file        code_formatter.hpp
+ * @brief       Formats the generated code in-process, with the clang-format library.
+ */
+#ifndef CODE_FORMATTER_HPP
+#define CODE_FORMATTER_HPP
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common_types.hpp"
+
+namespace Tsepepe
+{
+
+struct CodeFormattingOptions
+{
+    //! As the clang-format -style option: "file" looks up the .clang-format file; or e.g. "LLVM", "{IndentWidth: 4}".
+    std::string style{"file"};
+    //! Used with the "file" style, when no .clang-format file is found.
+    std::string fallback_style{"LLVM"};
+};
+
+/**
+ * @brief Formats the code within the ranges only; the rest of the code is left untouched, even if it is unformatted.
+ *
+ * The file path is used to look up the .clang-format file, and to tell the language; the file may not exist yet.
+ * Throws BaseError when the style is invalid.
+ */
+std::string format_code_ranges(std::string code,
+                               const std::filesystem::path& file_path,
+                               const std::vector<CodeRange>& ranges,
+                               const CodeFormattingOptions&);
+
+//! Applies the insertions; with the formatting options given, the inserted code is formatted then.
+std::string apply_and_format_insertions(std::string_view input,
+                                        std::vector<CodeInsertionByOffset> insertions,
+                                        const std::filesystem::path& file_path,
+                                        const std::optional<CodeFormattingOptions>&);
+
+} // namespace Tsepepe
+
+#endif /* CODE_FORMATTER_HPP */
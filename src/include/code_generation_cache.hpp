@@ -0,0 +1,107 @@
+/**
+ * @file        code_generation_cache.hpp
+ * @brief       Caches the generated override declarations and function definitions, across the code action requests.
+ */
+#ifndef CODE_GENERATION_CACHE_HPP
+#define CODE_GENERATION_CACHE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <clang/AST/DeclCXX.h>
+#include <clang/Basic/SourceManager.h>
+#include <llvm/ADT/StringMap.h>
+
+#include "libclang_utils/full_function_declaration_expander.hpp"
+#include "libclang_utils/pure_virtual_functions_extractor.hpp"
+
+namespace Tsepepe
+{
+
+//! Tells what a piece of the generated code depends on.
+struct CodeGenerationKey
+{
+    //! The USR of the interface, or of the function; a key with an empty USR is never cached.
+    std::string usr;
+    //! The hash of the content of the header(s), which declare the interface hierarchy, or the function, and the types
+    //! spelled within the signatures; independent of the order, in which the parsed translation unit includes them.
+    std::uint64_t content_hash{0};
+    //! The fully qualified name of the implementor; empty for the function definitions.
+    std::string implementor_scope;
+    //! The FullFunctionDeclarationExpanderOptions, packed.
+    unsigned expander_options{0};
+};
+
+/**
+ * @brief Keeps the generated code, so that the same interface implemented again, or the same function defined again,
+ * skips the code generation: the declaration expansion, the type printing, and the scope removal.
+ *
+ * The cache is thread safe. A single entry is kept per the USR, the implementor scope and the expander options; an
+ * entry generated from another content of the header is replaced, so the cache does not grow with the edits. The cache
+ * may be kept in memory only, e.g. by a resident process, or loaded from a file, and stored back, e.g. by a CLI tool.
+ */
+class CodeGenerationCache
+{
+  public:
+    //! An in-memory cache.
+    CodeGenerationCache() = default;
+    //! Loads the cache file; a missing, broken, or outdated one gives an empty cache.
+    explicit CodeGenerationCache(std::filesystem::path cache_file_path);
+
+    CodeGenerationCache(const CodeGenerationCache&) = delete;
+    CodeGenerationCache& operator=(const CodeGenerationCache&) = delete;
+
+    std::optional<std::vector<std::string>> find(const CodeGenerationKey&) const;
+    void insert(const CodeGenerationKey&, std::vector<std::string> code);
+
+    std::size_t size() const;
+
+    /**
+     * @brief Stores the entries inserted since the load to the cache file, if any, merging them with the entries stored
+     * meanwhile by the others. Throws BaseError on failure.
+     */
+    void store();
+
+  private:
+    struct Entry
+    {
+        std::uint64_t content_hash;
+        std::vector<std::string> code;
+    };
+
+    mutable std::mutex mutex;
+    llvm::StringMap<Entry> entries;
+    llvm::StringMap<Entry> inserted_entries;
+    std::filesystem::path cache_file_path;
+};
+
+//! Takes the key of the override declarations of the interface, generated for the implementor.
+CodeGenerationKey make_override_declarations_key(const clang::CXXRecordDecl* interface_node,
+                                                 std::string implementor_fully_qualified_name,
+                                                 const clang::SourceManager&);
+
+//! Takes the key of the function declaration, expanded with the options.
+CodeGenerationKey make_function_declaration_key(const clang::FunctionDecl*,
+                                                const clang::SourceManager&,
+                                                FullFunctionDeclarationExpanderOptions);
+
+//! Works like pure_virtual_functions_to_override_declarations(), but takes the result from the cache, if not null.
+OverrideDeclarations pure_virtual_functions_to_override_declarations(const clang::CXXRecordDecl* interface_node,
+                                                                     std::string implementor_fully_qualified_name,
+                                                                     const clang::SourceManager&,
+                                                                     CodeGenerationCache*);
+
+//! Works like fully_expand_function_declaration(), but takes the result from the cache, if not null.
+std::string fully_expand_function_declaration(const clang::FunctionDecl*,
+                                              const clang::SourceManager&,
+                                              FullFunctionDeclarationExpanderOptions,
+                                              CodeGenerationCache*,
+                                              AstPrintingMemo* = nullptr);
+
+} // namespace Tsepepe
+
+#endif /* CODE_GENERATION_CACHE_HPP */
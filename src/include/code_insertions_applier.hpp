@@ -6,6 +6,7 @@
 #define CODE_INSERTIONS_APPLIER_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "common_types.hpp"
@@ -13,7 +14,12 @@
 namespace Tsepepe
 {
 
-std::string apply_insertions(const std::string& input, std::vector<CodeInsertionByOffset> insertions);
+std::string apply_insertions(std::string_view input, std::vector<CodeInsertionByOffset> insertions);
+
+//! Works like apply_insertions(), but also tells the ranges of the inserted code, within the result, in order.
+std::string apply_insertions(std::string_view input,
+                             std::vector<CodeInsertionByOffset> insertions,
+                             std::vector<CodeRange>& inserted_ranges);
 
 }
 
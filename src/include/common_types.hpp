@@ -6,6 +6,8 @@
 #define COMMON_TYPES_HPP
 
 #include <filesystem>
+#include <map>
+#include <string>
 
 #include <NamedType/named_type.hpp>
 
@@ -16,6 +18,11 @@ using RustRegexPattern = fluent::NamedType<std::string, struct RustRegexPatternT
 using EcmaScriptPattern = fluent::NamedType<std::string, struct EcmaScriptPatternTag>;
 using RootDirectory = fluent::NamedType<std::filesystem::path, struct RootDirectoryTag>;
 
+using NewFileContent = std::string;
+
+//! The new content of each file touched by a code action, which edits multiple files at once.
+using MultiFileEdit = std::map<std::filesystem::path, NewFileContent>;
+
 struct CodeInsertionByOffset
 {
     std::string code;
@@ -24,6 +31,23 @@ struct CodeInsertionByOffset
     auto operator<=>(const CodeInsertionByOffset&) const = default;
 };
 
+//! A range of the code, e.g. of the inserted one, within the new content of the file.
+struct CodeRange
+{
+    unsigned offset;
+    unsigned length;
+
+    auto operator<=>(const CodeRange&) const = default;
+};
+
+struct SourceFileLocation
+{
+    std::filesystem::path file;
+    unsigned line;
+
+    auto operator<=>(const SourceFileLocation&) const = default;
+};
+
 } // namespace Tsepepe
 
 #endif /* COMMON_TYPES_HPP */
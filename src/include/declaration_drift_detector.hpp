@@ -0,0 +1,83 @@
+/**
+ * @file        declaration_drift_detector.hpp
+ * @brief       Detects the drift between the function declarations and their definitions, across the whole project.
+ */
+#ifndef DECLARATION_DRIFT_DETECTOR_HPP
+#define DECLARATION_DRIFT_DETECTOR_HPP
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "common_types.hpp"
+
+namespace Tsepepe
+{
+
+//! A function, which is declared, but defined nowhere within the project.
+struct UndefinedDeclaration
+{
+    //! The definition the declaration expects, as generated by fully_expand_function_declaration().
+    std::string expected_definition;
+    SourceFileLocation declaration_location;
+
+    auto operator<=>(const UndefinedDeclaration&) const = default;
+};
+
+//! A function, which is defined with the same name as an undefined declaration, but with another signature.
+struct SignatureMismatch
+{
+    std::string expected_definition;
+    SourceFileLocation declaration_location;
+    std::string actual_definition;
+    SourceFileLocation definition_location;
+
+    auto operator<=>(const SignatureMismatch&) const = default;
+};
+
+struct DeclarationDriftReport
+{
+    //! Sorted by the declaration location.
+    std::vector<UndefinedDeclaration> undefined_declarations;
+    //! Sorted by the declaration location.
+    std::vector<SignatureMismatch> signature_mismatches;
+};
+
+struct DeclarationDriftDetectionParameters
+{
+    //! Only the functions declared, or defined, within files under that directory are taken into account.
+    std::filesystem::path root_directory;
+    //! Where the per translation unit results are kept between the scans; no caching when empty.
+    std::filesystem::path cache_directory;
+};
+
+/**
+ * @brief Finds the function declarations, which have no definition within the project, or whose definition no longer
+ * matches the declaration.
+ *
+ * Each translation unit from the compilation database is scanned in parallel. The declarations and the definitions are
+ * paired with their USRs (Unified Symbol Resolution), across the translation units, so a declaration from a header is
+ * considered defined when any translation unit defines it. Only the declarations, which may be defined out-of-line, are
+ * taken into account. A declaration without a definition, for which a definition with the same qualified name but a
+ * different USR exists, is reported as a signature mismatch; otherwise it is reported as undefined.
+ *
+ * The results of each translation unit are cached. A translation unit is scanned again only if its compile command, or
+ * the content of any of its files under the root directory, has changed since the last scan.
+ */
+class DeclarationDriftDetectorLibclangBased
+{
+  public:
+    explicit DeclarationDriftDetectorLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>);
+
+    DeclarationDriftReport detect(DeclarationDriftDetectionParameters);
+
+  private:
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+};
+
+} // namespace Tsepepe
+
+#endif /* DECLARATION_DRIFT_DETECTOR_HPP */
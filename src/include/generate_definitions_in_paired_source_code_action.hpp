@@ -0,0 +1,74 @@
+/**
+ * @file        generate_definitions_in_paired_source_code_action.hpp
+ * @brief       Code action which generates function definitions from selected lines, straight into the paired source.
+ */
+#ifndef GENERATE_DEFINITIONS_IN_PAIRED_SOURCE_CODE_ACTION_HPP
+#define GENERATE_DEFINITIONS_IN_PAIRED_SOURCE_CODE_ACTION_HPP
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "cancellation_token.hpp"
+#include "code_formatter.hpp"
+#include "code_generation_cache.hpp"
+#include "common_types.hpp"
+#include "parsed_file_cache.hpp"
+#include "source_file_content.hpp"
+
+namespace Tsepepe
+{
+
+struct GenerateDefinitionsInPairedSourceCodeActionParameters
+{
+    //! The paired source file is looked for under that directory.
+    std::filesystem::path root_directory;
+    std::filesystem::path header_file_path;
+    //! The current content of the header, which may differ from the one on the disk.
+    SourceFileContent header_file_content;
+    unsigned selected_line_begin;
+    unsigned selected_line_end;
+    //! When given, the generated code is formatted in-process; the rest of the file is left untouched.
+    std::optional<CodeFormattingOptions> code_formatting;
+    //! Checked before each parse; see CancellationToken.
+    CancellationToken cancellation;
+};
+
+/**
+ * @brief Generates the definitions of the functions declared within the selected lines of a header, and places them
+ * within the paired source file.
+ *
+ * The paired source file is found with find_paired_cpp_files(), and it is parsed in parallel with the header. The
+ * definitions are generated with the same rules as in GenerateFunctionDefinitionsCodeActionLibclangBased. Functions,
+ * which are defined within the source already, are skipped.
+ *
+ * Each definition is placed right after the definition of the closest function declared before it within the header,
+ * which the source defines already. If there is none, it is placed before the definition of the closest function
+ * declared after it. Otherwise, the definition is appended to the source. The declarations and the definitions are
+ * paired with their USRs (Unified Symbol Resolution). When no paired source file exists, a new one is created next to
+ * the header, with the same stem, which includes the header.
+ */
+class GenerateDefinitionsInPairedSourceCodeActionLibclangBased
+{
+  public:
+    //! The generated code, and the parsed files, are taken from the caches, and put there, if the caches are given.
+    explicit GenerateDefinitionsInPairedSourceCodeActionLibclangBased(
+        std::shared_ptr<clang::tooling::CompilationDatabase>,
+        std::shared_ptr<CodeGenerationCache> = nullptr,
+        std::shared_ptr<ParsedFileCache> = nullptr);
+
+    //! Returns the new content of the paired source file; empty if no definition has been generated.
+    MultiFileEdit apply(GenerateDefinitionsInPairedSourceCodeActionParameters);
+
+  private:
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+    std::shared_ptr<CodeGenerationCache> code_generation_cache;
+    std::shared_ptr<ParsedFileCache> parsed_file_cache;
+};
+
+} // namespace Tsepepe
+
+#endif /* GENERATE_DEFINITIONS_IN_PAIRED_SOURCE_CODE_ACTION_HPP */
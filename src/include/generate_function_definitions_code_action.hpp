@@ -6,39 +6,66 @@
 #define GENERATE_FUNCTION_DEFINITIONS_CODE_ACTION_HPP
 
 #include <filesystem>
+#include <string>
+#include <vector>
 
 #include <clang/Tooling/CompilationDatabase.h>
 
-#include "directory_tree.hpp"
+#include "cancellation_token.hpp"
+#include "code_generation_cache.hpp"
+#include "parsed_file_cache.hpp"
+#include "source_file_content.hpp"
 
 namespace Tsepepe
 {
 
+//! Closed range of lines: <begin; end>.
+struct LineRange
+{
+    unsigned begin;
+    unsigned end;
+
+    auto operator<=>(const LineRange&) const = default;
+};
+
 struct GenerateFunctionDefinitionsCodeActionParameters
 {
     std::filesystem::path source_file_path;
-    std::string source_file_content;
+    SourceFileContent source_file_content;
     unsigned selected_line_begin;
     unsigned selected_line_end;
+    //! Further selected ranges, e.g. from multiple cursors; all the ranges must be disjoint.
+    std::vector<LineRange> additional_selected_line_ranges;
+    //! Checked before each parse; see CancellationToken.
+    CancellationToken cancellation;
 };
 
 class GenerateFunctionDefinitionsCodeActionLibclangBased
 {
   public:
-    explicit GenerateFunctionDefinitionsCodeActionLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>);
+    //! The generated code, and the parsed file, are taken from the caches, and put there, if the caches are given.
+    explicit GenerateFunctionDefinitionsCodeActionLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>,
+                                                                std::shared_ptr<CodeGenerationCache> = nullptr,
+                                                                std::shared_ptr<ParsedFileCache> = nullptr);
 
+    //! Returns the definitions generated for all the selected ranges, a group per range, separated with an empty line.
     std::string apply(GenerateFunctionDefinitionsCodeActionParameters);
 
-  private:
-    void validate_selected_range(const GenerateFunctionDefinitionsCodeActionParameters&) const;
+    /**
+     * @brief Returns the definitions generated for each selected range; the first one is for the range of
+     * selected_line_begin and selected_line_end, the rest follow the order of additional_selected_line_ranges.
+     *
+     * The file is parsed once for all the ranges. The range of each declaration is found with a binary search over the
+     * sorted ranges. The result for a range without any declaration is an empty string.
+     */
+    std::vector<std::string> apply_per_range(GenerateFunctionDefinitionsCodeActionParameters);
 
-    std::filesystem::path make_temporary_source_file(const std::filesystem::path& path,
-                                                     const std::string& file_content);
+  private:
+    std::vector<LineRange> validate_selected_ranges(const GenerateFunctionDefinitionsCodeActionParameters&) const;
 
     std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
-
-    DirectoryTree tsepepe_temp_directory_tree;
-    DirectoryTree this_code_action_directory_tree;
+    std::shared_ptr<CodeGenerationCache> code_generation_cache;
+    std::shared_ptr<ParsedFileCache> parsed_file_cache;
 };
 
 } // namespace Tsepepe
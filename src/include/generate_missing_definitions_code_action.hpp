@@ -0,0 +1,61 @@
+/**
+ * @file        generate_missing_definitions_code_action.hpp
+ * @brief       Code action which generates the definitions of all the undefined functions from a set of headers.
+ */
+#ifndef GENERATE_MISSING_DEFINITIONS_CODE_ACTION_HPP
+#define GENERATE_MISSING_DEFINITIONS_CODE_ACTION_HPP
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "cancellation_token.hpp"
+#include "code_formatter.hpp"
+#include "common_types.hpp"
+
+namespace Tsepepe
+{
+
+struct GenerateMissingDefinitionsCodeActionParameters
+{
+    //! The paired source files are looked for under that directory.
+    std::filesystem::path root_directory;
+    std::vector<std::filesystem::path> header_paths;
+    //! When given, the generated code is formatted in-process; the rest of the file is left untouched.
+    std::optional<CodeFormattingOptions> code_formatting;
+    //! Checked before each parse; see CancellationToken.
+    CancellationToken cancellation;
+};
+
+/**
+ * @brief Generates the definitions of all the functions, which are declared but not defined yet, within the headers.
+ *
+ * The headers are processed in parallel. For each header its paired source file is found, and parsed, so that the
+ * functions defined there already are skipped. When the paired source does not exist, or it does not include the
+ * header, then the header is parsed alone. The definitions are generated with the same rules as in
+ * GenerateFunctionDefinitionsCodeActionLibclangBased, and are appended to the paired source file, as a single group per
+ * header, in the declaration order. When no paired source file exists, a new one is created next to the header, with
+ * the same stem. The source, which does not include the header yet, gets the include prepended; the headers sharing
+ * the source, e.g. foo.h and foo.hpp, have their includes merged there.
+ *
+ * Functions which cannot be defined out-of-line within a source file are skipped: templates, members of class
+ * templates, inline and constexpr functions, deleted, defaulted and pure virtual functions, and friend declarations.
+ */
+class GenerateMissingDefinitionsCodeActionLibclangBased
+{
+  public:
+    explicit GenerateMissingDefinitionsCodeActionLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>);
+
+    //! Returns the new content of each source file with definitions added, including the ones to be created.
+    MultiFileEdit apply(GenerateMissingDefinitionsCodeActionParameters);
+
+  private:
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+};
+
+} // namespace Tsepepe
+
+#endif /* GENERATE_MISSING_DEFINITIONS_CODE_ACTION_HPP */
@@ -6,33 +6,57 @@
 #define IMPLEMENT_INTERFACE_CODE_ACTION_HPP
 
 #include <filesystem>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <clang/Tooling/CompilationDatabase.h>
 
+#include "cancellation_token.hpp"
+#include "clangd_index.hpp"
+#include "code_formatter.hpp"
+#include "code_generation_cache.hpp"
+#include "common_types.hpp"
+#include "parsed_file_cache.hpp"
+#include "source_file_content.hpp"
+
 namespace Tsepepe
 {
 
-using NewFileContent = std::string;
-
 struct ImplementInterfaceCodeActionParameters
 {
     std::filesystem::path root_directory;
     std::filesystem::path source_file_path;
-    std::string source_file_content;
-    std::string inteface_name;
+    SourceFileContent source_file_content;
+    //! Bare names of the interfaces to implement; all of them are implemented at once.
+    std::vector<std::string> interface_names;
     unsigned cursor_position_line;
+    //! When given, the generated code is formatted in-process; the rest of the file is left untouched.
+    std::optional<CodeFormattingOptions> code_formatting;
+    //! Checked before each parse; see CancellationToken.
+    CancellationToken cancellation;
 };
 
 class ImplementIntefaceCodeActionLibclangBased
 {
   public:
-    explicit ImplementIntefaceCodeActionLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>);
+    /**
+     * The generated code, and the parsed files, are taken from the caches, and put there, if the caches are given. The
+     * interfaces are located with the clangd index, if given, and fresh, rather than by grepping the project; each
+     * located file is then parsed, and the project is grepped after all, if any interface is not found there.
+     */
+    explicit ImplementIntefaceCodeActionLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>,
+                                                      std::shared_ptr<CodeGenerationCache> = nullptr,
+                                                      std::shared_ptr<ParsedFileCache> = nullptr,
+                                                      std::shared_ptr<ClangdIndex> = nullptr);
 
     NewFileContent apply(ImplementInterfaceCodeActionParameters);
 
   private:
     std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+    std::shared_ptr<CodeGenerationCache> code_generation_cache;
+    std::shared_ptr<ParsedFileCache> parsed_file_cache;
+    std::shared_ptr<ClangdIndex> clangd_index;
 };
 
 }; // namespace Tsepepe
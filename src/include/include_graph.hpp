@@ -0,0 +1,87 @@
+/**
+ * @file        include_graph.hpp
+ * @brief       The include graph of the project files, telling which files include which, directly or not.
+ */
+#ifndef INCLUDE_GRAPH_HPP
+#define INCLUDE_GRAPH_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+namespace Tsepepe
+{
+
+/**
+ * @brief An immutable, compact include graph, where the files are the nodes.
+ *
+ * The paths are interned: each file is identified by its position within the sorted path table, and the edges are
+ * kept within a flat adjacency array (offsets + targets). The graph may have cycles, e.g. when the include guards
+ * break a circular inclusion.
+ */
+class IncludeGraph
+{
+  public:
+    using FileId = std::uint32_t;
+    //! The includer, and the included file.
+    using Edge = std::pair<std::filesystem::path, std::filesystem::path>;
+
+    IncludeGraph() = default;
+    explicit IncludeGraph(const std::vector<Edge>&);
+
+    std::size_t size() const;
+
+    const std::filesystem::path& get_path(FileId) const;
+    std::optional<FileId> find(const std::filesystem::path&) const;
+
+    std::span<const FileId> get_direct_includes(FileId) const;
+
+    //! Tells whether the includer includes the header, directly or not. A file does not include itself.
+    bool is_included(const std::filesystem::path& header, const std::filesystem::path& includer) const;
+
+  private:
+    //! Sorted; the position is the FileId.
+    std::vector<std::filesystem::path> paths;
+    std::vector<std::uint32_t> include_offsets;
+    std::vector<FileId> includes;
+};
+
+struct IncludeGraphParameters
+{
+    //! Only the files under that directory are the nodes of the graph.
+    std::filesystem::path root_directory;
+    //! Where the include directives of each file are kept between the builds; no caching when empty.
+    std::filesystem::path cache_directory;
+};
+
+/**
+ * @brief Builds the include graph of the project, without parsing any file.
+ *
+ * Each translation unit, from the compilation database, is walked in parallel, starting from its main file. The
+ * include directives of each file are found by lexing it, and are resolved with the header search directories from
+ * the compile command of the translation unit. The files outside the root directory are not walked. The include
+ * directives of each file are cached, keyed with the file content hash, so that only the changed files are lexed again.
+ *
+ * Since the conditional compilation is not evaluated, the graph may have more edges than any of the builds has.
+ */
+class IncludeGraphBuilderLibclangBased
+{
+  public:
+    explicit IncludeGraphBuilderLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>);
+
+    IncludeGraph build(IncludeGraphParameters);
+
+  private:
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+};
+
+} // namespace Tsepepe
+
+#endif /* INCLUDE_GRAPH_HPP */
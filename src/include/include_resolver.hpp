@@ -0,0 +1,76 @@
+/**
+ * @file        include_resolver.hpp
+ * @brief       Resolves the include directives, and spells the include paths, the way the preprocessor looks them up.
+ */
+#ifndef INCLUDE_RESOLVER_HPP
+#define INCLUDE_RESOLVER_HPP
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+#include <llvm/ADT/StringRef.h>
+
+namespace Tsepepe
+{
+
+struct IncludeDirective
+{
+    //! The path between the delimiters, e.g. 'gui/drawable.hpp'.
+    std::string spelling;
+    //! Whether it is spelled with the angle brackets, rather than with the quotes.
+    bool is_angled;
+
+    auto operator<=>(const IncludeDirective&) const = default;
+};
+
+//! The header search directories of a translation unit, each kind in the order of the lookup.
+struct IncludeSearchPaths
+{
+    //! From the '-iquote' options; searched for the quoted includes only.
+    std::vector<std::filesystem::path> quote_directories;
+    //! From the '-I' options.
+    std::vector<std::filesystem::path> angled_directories;
+    //! From the '-isystem' and '-idirafter' options.
+    std::vector<std::filesystem::path> system_directories;
+};
+
+//! Collects the header search directories from the command line; the relative ones are made absolute.
+IncludeSearchPaths parse_include_search_paths(const clang::tooling::CompileCommand&);
+
+/**
+ * @brief Finds the include directives within the source code, without preprocessing it.
+ *
+ * The code is only lexed, so the comments and the string literals are skipped, but the conditional compilation is
+ * not evaluated: the directives from all the branches are found. The includes of a macro are skipped. The source code
+ * must be followed by a null character, as the one from a std::string, or from an llvm::MemoryBuffer is.
+ */
+std::vector<IncludeDirective> scan_include_directives(llvm::StringRef source_code);
+
+/**
+ * @brief Finds the file, which the directive, found within the includer, includes.
+ *
+ * The quoted includes are looked up within the includer's directory, then within the quote directories; both are
+ * looked up within the angled and the system directories then. Returns the canonical path, or nullopt if not found.
+ */
+std::optional<std::filesystem::path> resolve_include(const IncludeDirective&,
+                                                     const std::filesystem::path& includer,
+                                                     const IncludeSearchPaths&);
+
+/**
+ * @brief Spells the shortest include path, which makes the includer include the header.
+ *
+ * Each of the search directories containing the header gives a candidate, which is verified to resolve to the header
+ * indeed, i.e. not to a file of the same name found earlier. The header is spelled with the quotes, unless found
+ * within a system directory only. Returns the include path with its delimiters, e.g. '"gui/drawable.hpp"', or nullopt
+ * if none of the directories contains the header.
+ */
+std::optional<std::string> spell_include(const std::filesystem::path& header,
+                                         const std::filesystem::path& includer,
+                                         const IncludeSearchPaths&);
+
+} // namespace Tsepepe
+
+#endif /* INCLUDE_RESOLVER_HPP */
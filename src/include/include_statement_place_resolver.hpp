@@ -5,7 +5,7 @@
 #ifndef INCLUDE_STATEMENT_PLACE_RESOLVER_HPP
 #define INCLUDE_STATEMENT_PLACE_RESOLVER_HPP
 
-#include <string>
+#include <string_view>
 
 namespace Tsepepe
 {
@@ -18,7 +18,7 @@ struct IncludeStatementPlace
     constexpr auto operator<=>(const IncludeStatementPlace&) const = default;
 };
 
-IncludeStatementPlace resolve_include_statement_place(const std::string& cpp_file_content);
+IncludeStatementPlace resolve_include_statement_place(std::string_view cpp_file_content);
 
 } // namespace Tsepepe
 
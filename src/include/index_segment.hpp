@@ -0,0 +1,85 @@
+/**
+ * @file        index_segment.hpp
+ * @brief       Immutable, memory mapped index files, shared by many tool processes at once.
+ */
+#ifndef INDEX_SEGMENT_HPP
+#define INDEX_SEGMENT_HPP
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+namespace Tsepepe
+{
+
+/**
+ * @brief Replaces the file content at once, creating the directories on the way.
+ *
+ * The content, made of the parts put one after another, is written aside to a file of its own, which is then renamed
+ * over the file, so a concurrent reader sees either the old content, or the new one, and the concurrent writers never
+ * garble the file; the last one to rename wins. Throws BaseError on failure.
+ */
+void replace_file_atomically(const std::filesystem::path& file_path, llvm::ArrayRef<llvm::StringRef> content_parts);
+
+//! Tells the kind of the index kept within a segment, e.g. {'T', 'S', 'I', 'T'} for the interface symbol table.
+using IndexSegmentMagic = std::array<char, 4>;
+
+/**
+ * @brief An index file, which is never modified once published, and is mapped read-only by its readers.
+ *
+ * The file consists of a fixed header, with the magic, the format version, and the payload size, followed by the
+ * payload, which is laid out by the index itself, so that it is queried straight from the mapped memory. A new version
+ * of the index is written aside, and then renamed over the segment file, so the readers never lock, nor see a partially
+ * written segment: a reader keeps the segment it has mapped, even when a newer one gets published meanwhile. All the
+ * processes mapping the same segment share its pages within the page cache. The segments are local caches: they are
+ * stored with the native byte order.
+ */
+class IndexSegment
+{
+  public:
+    //! Publishes the payload, made of the parts put one after another, as the new segment; replaces it atomically.
+    static void publish(const std::filesystem::path& segment_file_path,
+                        IndexSegmentMagic,
+                        std::uint32_t format_version,
+                        llvm::ArrayRef<llvm::StringRef> payload_parts);
+
+    //! Maps the segment; throws BaseError if it cannot be read, is broken, or is of another kind, or version.
+    IndexSegment(const std::filesystem::path& segment_file_path, IndexSegmentMagic, std::uint32_t format_version);
+
+    //! Points to the mapped memory, which lives as long as the segment does. Aligned to 8 bytes.
+    llvm::StringRef get_payload() const;
+
+  private:
+    std::unique_ptr<llvm::MemoryBuffer> buffer;
+    llvm::StringRef payload;
+};
+
+/**
+ * @brief Makes the calling process the single writer of an index, until destroyed.
+ *
+ * Blocks while another process holds the lock. It is advisory: only the writers take it, so that they do not build the
+ * same index at once; the readers never wait for it. Each index shall have a lock file of its own, since the lock is
+ * held per process: a second lock of the same file, taken by the same process, is not exclusive.
+ */
+class IndexWriterLock
+{
+  public:
+    //! Creates the lock file, and the directories on the way, if missing; throws BaseError on failure.
+    explicit IndexWriterLock(const std::filesystem::path& lock_file_path);
+    ~IndexWriterLock();
+
+    IndexWriterLock(const IndexWriterLock&) = delete;
+    IndexWriterLock& operator=(const IndexWriterLock&) = delete;
+
+  private:
+    int file_descriptor;
+};
+
+} // namespace Tsepepe
+
+#endif /* INDEX_SEGMENT_HPP */
@@ -0,0 +1,94 @@
+/**
+ * @file        inheritance_graph.hpp
+ * @brief       The inheritance graph of the project classes, answering the "implementors" and "interfaces" queries.
+ */
+#ifndef INHERITANCE_GRAPH_HPP
+#define INHERITANCE_GRAPH_HPP
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "class_index.hpp"
+
+namespace Tsepepe
+{
+
+enum class ClassFilter
+{
+    all,
+    abstract_only,
+    concrete_only
+};
+
+/**
+ * @brief An immutable, compact inheritance graph, built from the class index.
+ *
+ * The qualified names are interned: each class is a node identified by its position within the sorted name table, and
+ * the edges, in both directions, are kept within flat adjacency arrays (offsets + targets), so that the queries touch
+ * contiguous memory only. The classes sharing the qualified name (e.g. defined within anonymous namespaces of
+ * different files) are a single node. The bases defined outside the root directory are nodes as well, but they are
+ * known only by name, thus never considered abstract.
+ *
+ * Building the graph takes just a few sorts of the index, so it is rebuilt from the (cached) class index, rather than
+ * persisted on its own.
+ */
+class InheritanceGraph
+{
+  public:
+    using ClassId = std::uint32_t;
+
+    explicit InheritanceGraph(const std::vector<IndexedClass>&);
+
+    std::size_t size() const;
+
+    std::string_view get_qualified_name(ClassId) const;
+    bool is_abstract(ClassId) const;
+
+    /**
+     * @brief Finds the classes with the given name.
+     *
+     * The name may be bare, e.g. 'Interface', or qualified partially, e.g. 'Namespace::Interface', then all the classes
+     * ending with it are found. A name starting with '::' is matched exactly.
+     */
+    std::vector<ClassId> find(std::string_view name) const;
+
+    std::span<const ClassId> get_direct_bases(ClassId) const;
+    std::span<const ClassId> get_direct_derived_classes(ClassId) const;
+
+    //! All the classes, which derive from the class, directly or not; each once, ordered by the qualified name.
+    std::vector<ClassId> find_derived_classes(ClassId, ClassFilter = ClassFilter::all) const;
+    //! All the bases of the class, direct or not; each once, ordered by the qualified name.
+    std::vector<ClassId> find_bases(ClassId, ClassFilter = ClassFilter::all) const;
+
+    //! The non-abstract classes, which derive from the class.
+    std::vector<ClassId> find_implementors(ClassId) const;
+    //! The abstract bases of the class.
+    std::vector<ClassId> find_interfaces(ClassId) const;
+    //! All the abstract classes, whose bare, or qualified, name starts with the prefix; ordered by the qualified name.
+    std::vector<ClassId> find_abstract_classes(std::string_view prefix = {}) const;
+
+  private:
+    using Offsets = std::vector<std::uint32_t>;
+
+    ClassId intern(std::string_view qualified_name) const;
+    std::vector<ClassId> traverse(ClassId, const Offsets&, const std::vector<ClassId>& targets, ClassFilter) const;
+    bool matches(ClassId, ClassFilter) const;
+
+    //! Sorted; the position is the ClassId.
+    std::vector<std::string> qualified_names;
+    //! The ClassIds, sorted by the bare name, for the lookups by a partially qualified name.
+    std::vector<ClassId> ids_by_bare_name;
+    std::vector<bool> abstract_flags;
+
+    Offsets base_offsets;
+    std::vector<ClassId> bases;
+    Offsets derived_class_offsets;
+    std::vector<ClassId> derived_classes;
+};
+
+} // namespace Tsepepe
+
+#endif /* INHERITANCE_GRAPH_HPP */
@@ -0,0 +1,96 @@
+/**
+ * @file        interface_symbol_table.hpp
+ * @brief       A compact, memory mapped table of the interface names, for the interface name completion.
+ */
+#ifndef INTERFACE_SYMBOL_TABLE_HPP
+#define INTERFACE_SYMBOL_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "class_index.hpp"
+#include "common_types.hpp"
+#include "index_segment.hpp"
+
+namespace Tsepepe
+{
+
+enum class CompletionMode
+{
+    //! The bare name starts with the pattern; case sensitive.
+    prefix,
+    //! The pattern characters appear within the bare name, in order; case insensitive. When the pattern contains '::'
+    //! the qualified name is matched instead.
+    fuzzy
+};
+
+struct InterfaceCompletionParameters
+{
+    std::string pattern;
+    CompletionMode mode;
+    //! The file being edited; the interfaces defined closer to it are ranked higher.
+    std::filesystem::path current_file;
+    std::size_t max_results{50};
+};
+
+struct InterfaceCandidate
+{
+    std::string qualified_name;
+    SourceFileLocation location;
+
+    auto operator<=>(const InterfaceCandidate&) const = default;
+};
+
+/**
+ * @brief The names of all the abstract classes from the class index, kept within a single index segment, which is
+ * mapped read-only, so that opening the table costs no parsing, and no allocation per symbol.
+ *
+ * The segment payload consists of the counts, the fixed-size entries sorted by the bare name, and an arena with all
+ * the strings; the entries refer to the arena with offsets, and the file paths are stored once per file. The prefix
+ * queries are answered with a binary search; the fuzzy ones with a single linear pass over the entries. The candidates
+ * are ranked by the proximity of their file to the current file (the number of the leading directories in common)
+ * first, then by the match quality, then by the name.
+ */
+class InterfaceSymbolTable
+{
+  public:
+    //! Publishes the table as a new segment; see IndexSegment::publish().
+    static void write(const ClassIndex&, const std::filesystem::path& table_file_path);
+
+    //! Maps the table file; throws BaseError if it cannot be read, or is not a valid table.
+    explicit InterfaceSymbolTable(const std::filesystem::path& table_file_path);
+
+    std::size_t size() const;
+
+    std::vector<InterfaceCandidate> complete(const InterfaceCompletionParameters&) const;
+
+  private:
+    struct Entry
+    {
+        std::uint32_t qualified_name_offset;
+        std::uint32_t qualified_name_size;
+        //! The position of the bare name within the qualified name.
+        std::uint32_t bare_name_position;
+        std::uint32_t file_offset;
+        std::uint32_t file_size;
+        std::uint32_t line;
+    };
+
+    Entry get_entry(std::size_t index) const;
+    std::string_view get_qualified_name(const Entry&) const;
+    std::string_view get_bare_name(const Entry&) const;
+    std::string_view get_file(const Entry&) const;
+
+    IndexSegment segment;
+    std::size_t entries_count;
+    const char* entries;
+    std::string_view arena;
+};
+
+} // namespace Tsepepe
+
+#endif /* INTERFACE_SYMBOL_TABLE_HPP */
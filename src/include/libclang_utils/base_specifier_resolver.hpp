@@ -5,6 +5,9 @@
 #ifndef BASE_SPECIFIER_RESOLVER_HPP
 #define BASE_SPECIFIER_RESOLVER_HPP
 
+#include <string_view>
+#include <vector>
+
 #include <clang/AST/DeclCXX.h>
 
 #include "ast_record.hpp"
@@ -13,9 +16,19 @@
 namespace Tsepepe
 {
 
-CodeInsertionByOffset resolve_base_specifier(const std::string& cpp_file_content,
+CodeInsertionByOffset resolve_base_specifier(std::string_view cpp_file_content,
                                              ClangClassRecord deriving_class,
                                              const clang::CXXRecordDecl* base_class);
+
+/** @brief Resolves a single base-clause insertion which makes the deriving class derive from all the base classes.
+ *
+ * The base classes from which the deriving class already derives are skipped, as well as the duplicated ones. The
+ * remaining ones are put one after another, in the order as specified. Returns an empty insertion when there is
+ * nothing to add.
+ */
+CodeInsertionByOffset resolve_base_specifiers(std::string_view cpp_file_content,
+                                              ClangClassRecord deriving_class,
+                                              const std::vector<const clang::CXXRecordDecl*>& base_classes);
 }
 
 #endif /* BASE_SPECIFIER_RESOLVER_HPP */
@@ -5,8 +5,16 @@
 #ifndef FULL_FUNCTION_DECLARATION_EXPANDER_HPP
 #define FULL_FUNCTION_DECLARATION_EXPANDER_HPP
 
+#include <string>
+#include <string_view>
+
 #include <clang/AST/DeclCXX.h>
+#include <clang/AST/Type.h>
 #include <clang/Basic/SourceManager.h>
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/STLFunctionalExtras.h>
+#include <llvm/Support/Allocator.h>
+#include <llvm/Support/StringSaver.h>
 
 namespace Tsepepe
 {
@@ -22,10 +30,46 @@ struct FullFunctionDeclarationExpanderOptions
     unsigned remove_scope_from_parameters : 1 {0};
 };
 
+/**
+ * @brief Memoizes the printed types, and the qualified names of the declarations, within a single AST.
+ *
+ * The types are keyed as written, together with their sugar, since e.g. a type alias is printed as is, rather than
+ * desugared; the declarations are keyed with the canonical declaration. Thus the memo is valid only as long as the AST
+ * is alive. It may be shared by all the declarations expanded from the AST, but not between threads.
+ *
+ * The strings are kept in an arena, so the returned views stay valid as long as the memo is alive, and the lookups
+ * do not allocate.
+ */
+class AstPrintingMemo
+{
+  public:
+    AstPrintingMemo() = default;
+    AstPrintingMemo(const AstPrintingMemo&) = delete;
+    AstPrintingMemo& operator=(const AstPrintingMemo&) = delete;
+
+    //! Returns the memoized string of the type; on the first call for the type, it is printed with the printer.
+    std::string_view get_type_string(clang::QualType, llvm::function_ref<std::string(clang::QualType)> printer);
+
+    std::string_view get_qualified_name(const clang::NamedDecl*);
+
+  private:
+    llvm::BumpPtrAllocator arena;
+    llvm::StringSaver string_saver{arena};
+    llvm::DenseMap<void*, std::string_view> type_strings;
+    llvm::DenseMap<const clang::Decl*, std::string_view> qualified_names;
+};
+
+/**
+ * @brief Expands the declaration, with all the types fully qualified.
+ *
+ * The memo, if given, is shared with the other expansions from the same AST, so that the types, e.g. the template
+ * specializations, which repeat across the declarations, are printed once.
+ */
 std::string fully_expand_function_declaration(
     const clang::FunctionDecl*,
     const clang::SourceManager&,
-    FullFunctionDeclarationExpanderOptions options = FullFunctionDeclarationExpanderOptions{});
+    FullFunctionDeclarationExpanderOptions options = FullFunctionDeclarationExpanderOptions{},
+    AstPrintingMemo* memo = nullptr);
 
 } // namespace Tsepepe
 
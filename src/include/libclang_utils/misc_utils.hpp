@@ -5,9 +5,16 @@
 #ifndef MISC_UTILS_HPP
 #define MISC_UTILS_HPP
 
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <clang/AST/Decl.h>
 #include <clang/Basic/LangOptions.h>
 #include <clang/Basic/SourceLocation.h>
 #include <clang/Lex/Token.h>
+#include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Tooling/Tooling.h>
 
 namespace Tsepepe
 {
@@ -19,6 +26,30 @@ source_range_content_to_string(const clang::SourceRange&, const clang::SourceMan
 
 void dump_token(const clang::Token&);
 
+//! Returns the absolute path of the file, which contains the location; empty path if the location is not in a file.
+std::filesystem::path get_absolute_file_path(clang::SourceLocation, const clang::SourceManager&);
+
+/**
+ * @brief Tells whether the function may be defined out-of-line, within a source file.
+ *
+ * It may not, when the function is a template, a member of a class template, inline, constexpr, implicit, deleted,
+ * defaulted, pure virtual, or it is a friend declaration. The answer does not depend on whether it is defined already.
+ */
+bool is_definable_out_of_line(const clang::FunctionDecl*);
+
+//! Returns the USR (Unified Symbol Resolution) of the declaration; empty string if the declaration has none.
+std::string generate_usr(const clang::Decl*);
+
+/**
+ * @brief Makes the tool on a file system of its own, so that many tools may be run at once.
+ *
+ * The tool changes the working directory of its file system to the one of the compile command. The default, real file
+ * system shares the working directory of the whole process, so the tools run at once would resolve the relative paths
+ * against the directories of each other.
+ */
+clang::tooling::ClangTool make_clang_tool(const clang::tooling::CompilationDatabase&,
+                                          const std::vector<std::string>& source_paths);
+
 }; // namespace Tsepepe
 
 #endif /* MISC_UTILS_HPP */
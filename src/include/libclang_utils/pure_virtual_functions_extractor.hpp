@@ -10,19 +10,29 @@
 
 #include <clang/AST/DeclCXX.h>
 #include <clang/Basic/SourceManager.h>
+#include <llvm/ADT/DenseMap.h>
 
 namespace Tsepepe
 {
 
 using OverrideDeclarations = std::vector<std::string>;
 
+/**
+ * @brief Memoizes the expanded declarations of the pure virtual functions, with the interface scope removed already.
+ *
+ * Keyed by the canonical declaration of the pure virtual function, thus valid only as long as the AST is alive.
+ */
+using PureVirtualFunctionExpansionCache = llvm::DenseMap<const clang::CXXMethodDecl*, std::string>;
+
 /** @brief Extract all pure virtual functions from interface_node and turn then into override declarations.
  *
- * This will iterate over each method within the interface (pointed by the interface_node) and all its base classes
- * (and their base classes, and all their base classes, and so on ...) to look for a pure virtual functions. For each of
- * them the 'virtual' keyword, and the pure-specifier ("= 0"), will be deleted, and 'override' will be appended. All the
- * types (return types, types in parameters, nested templated types, ...) will be fully qualified, except those which
- * are defined within the interface (or which landed within it because of inheritance from its base classes), or share
+ * This will look at the final overriders of all the virtual functions of the interface (pointed by the interface_node),
+ * including the ones inherited from all its base classes (and their base classes, and so on ...), to look for the pure
+ * virtual functions. A function which is overridden by an intermediate base is skipped, and a function which is
+ * reachable through many inheritance paths (e.g. in a diamond hierarchy) is emitted once. For each of them the
+ * 'virtual' keyword, and the pure-specifier ("= 0"), will be deleted, and 'override' will be appended. All the types
+ * (return types, types in parameters, nested templated types, ...) will be fully qualified, except those which are
+ * defined within the interface (or which landed within it because of inheritance from its base classes), or share
  * common scope nesting with the implementor. The scope nesting of the implementor can be supplied with the
  * implementor_fully_qualified_name parameter.
  *
@@ -40,6 +50,40 @@ OverrideDeclarations pure_virtual_functions_to_override_declarations(
     std::string implementor_fully_qualified_name, // FIXME: use FullyQualifiedName type
     const clang::SourceManager&);
 
+/** @brief Extract the pure virtual functions from interface_node, which the implementor does not override yet.
+ *
+ * Works like pure_virtual_functions_to_override_declarations(), but skips the functions, which already have a non-pure
+ * overrider within the implementor, or within any class the implementor derives from. The implementor scope nesting is
+ * taken from the implementor_node itself. Both of the nodes must belong to the same AST.
+ *
+ * @param interface_node Pointer to the definition of the interface, which is a base class of the implementor.
+ * @param implementor_node Pointer to the definition of a class deriving from the interface.
+ * @param cache Optional cache, which may be shared by the calls for many implementors from the same AST.
+ * @returns The override declarations, which are missing within the implementor.
+ */
+OverrideDeclarations missing_override_declarations(const clang::CXXRecordDecl* interface_node,
+                                                   const clang::CXXRecordDecl* implementor_node,
+                                                   const clang::SourceManager&,
+                                                   PureVirtualFunctionExpansionCache* cache = nullptr);
+
+/**
+ * @brief Tells whether the record leaves unimplemented any pure virtual function, which is not one of the interface.
+ *
+ * Such a record is abstract regardless of the interface, e.g. it extends the interface with pure virtual functions of
+ * its own, or it derives from such an extending interface. Both of the nodes must belong to the same AST.
+ */
+bool has_pure_virtual_functions_beyond_interface(const clang::CXXRecordDecl* interface_node,
+                                                 const clang::CXXRecordDecl* record_node);
+
+/**
+ * @brief Tells whether the derived class implements any pure virtual function, which the base leaves unimplemented.
+ *
+ * If so, the base is left abstract on purpose, to be completed by its derived classes. Both of the nodes must belong to
+ * the same AST.
+ */
+bool implements_pure_virtual_functions_of(const clang::CXXRecordDecl* base_node,
+                                          const clang::CXXRecordDecl* derived_node);
+
 } // namespace Tsepepe
 
 #endif /* PURE_VIRTUAL_FUNCTIONS_EXTRACTOR_HPP */
@@ -6,6 +6,7 @@
 #define FINDER_HPP
 
 #include <string>
+#include <string_view>
 
 #include <clang/AST/DeclCXX.h>
 #include <clang/Basic/SourceManager.h>
@@ -32,7 +33,7 @@ struct SuitablePublicMethodPlaceInCppFile
  * SuitablePublicMethodPlaceInCppFile::is_public_section_needed will be set to true. This indicates that the class needs
  * to have 'public:' section added, just below the SuitablePublicMethodPlaceInCppFile::line number.
  */
-SuitablePublicMethodPlaceInCppFile find_suitable_place_in_class_for_public_method(const std::string& cpp_file_content,
+SuitablePublicMethodPlaceInCppFile find_suitable_place_in_class_for_public_method(std::string_view cpp_file_content,
                                                                                   const clang::CXXRecordDecl*,
                                                                                   const clang::SourceManager&);
 
@@ -0,0 +1,64 @@
+/**
+ * @file        missing_overrides_code_action.hpp
+ * @brief       Code Action which adds the missing overrides to all the implementors of an interface.
+ */
+#ifndef MISSING_OVERRIDES_CODE_ACTION_HPP
+#define MISSING_OVERRIDES_CODE_ACTION_HPP
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "cancellation_token.hpp"
+#include "code_formatter.hpp"
+#include "common_types.hpp"
+
+namespace Tsepepe
+{
+
+struct MissingOverridesCodeActionParameters
+{
+    //! Only the implementors defined within files under that directory are edited.
+    std::filesystem::path root_directory;
+    //! Bare name of the interface, e.g. 'Interface' for 'Namespace::Interface'.
+    std::string interface_name;
+    //! Where the class index is kept between the runs; when empty, the translation units are found by grepping.
+    std::filesystem::path cache_directory;
+    //! When given, the generated code is formatted in-process; the rest of the file is left untouched.
+    std::optional<CodeFormattingOptions> code_formatting;
+    //! Checked before each parse; see CancellationToken.
+    CancellationToken cancellation;
+};
+
+/**
+ * @brief Finds all the implementors of an interface, and adds the overrides of the pure virtual functions, which they
+ * do not override yet, e.g. after a pure virtual function has been added to the interface.
+ *
+ * The translation units are visited in parallel. An implementor, which is visible from many translation units (e.g.
+ * defined within a header), is processed once. Two kinds of the derived classes are left untouched: the ones, which
+ * leave unimplemented any pure virtual function from beyond the interface (e.g. the interfaces extending it), and the
+ * intermediate bases, which leave some pure virtual functions of the interface for their derived classes.
+ *
+ * The project is grepped for the definition of the interface, and only the translation units, which include it,
+ * directly or not, are visited; see IncludeGraphBuilderLibclangBased. With the cache directory set, the implementors
+ * are looked up within the inheritance graph, built from the (cached) class index, instead; then only a single
+ * translation unit per file defining an implementor is visited.
+ */
+class MissingOverridesCodeActionLibclangBased
+{
+  public:
+    explicit MissingOverridesCodeActionLibclangBased(std::shared_ptr<clang::tooling::CompilationDatabase>);
+
+    //! Returns the new content of each edited file; the files with nothing to add are not present.
+    MultiFileEdit apply(MissingOverridesCodeActionParameters);
+
+  private:
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+};
+
+}; // namespace Tsepepe
+
+#endif /* MISSING_OVERRIDES_CODE_ACTION_HPP */
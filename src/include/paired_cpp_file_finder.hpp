@@ -0,0 +1,28 @@
+/**
+ * @file        paired_cpp_file_finder.hpp
+ * @brief       Finds the C++ files paired with each other, e.g. "foo.hpp" with "foo.cpp".
+ */
+#ifndef PAIRED_CPP_FILE_FINDER_HPP
+#define PAIRED_CPP_FILE_FINDER_HPP
+
+#include <filesystem>
+#include <vector>
+
+namespace Tsepepe
+{
+
+//! Tells whether the path has one of the C++ source file extensions (".cpp", ".cxx", ".cc").
+bool is_cpp_source_file(const std::filesystem::path&);
+
+/**
+ * @brief Finds the files paired with the C++ file: the source files for a header, or the headers for a source file.
+ *
+ * The files with the same stem are looked for within the directory of the C++ file first. Only if none is found there,
+ * the entire project tree is searched recursively.
+ */
+std::vector<std::filesystem::path> find_paired_cpp_files(const std::filesystem::path& project_root,
+                                                         const std::filesystem::path& cpp_file);
+
+} // namespace Tsepepe
+
+#endif /* PAIRED_CPP_FILE_FINDER_HPP */
@@ -0,0 +1,74 @@
+/**
+ * @file        parallel_utils.hpp
+ * @brief       Utilities to run independent jobs in parallel.
+ */
+#ifndef PARALLEL_UTILS_HPP
+#define PARALLEL_UTILS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tsepepe::utils
+{
+
+/**
+ * @brief Calls the job for each index from the range [0, jobs_count), on a bounded number of threads.
+ *
+ * The calling thread takes part in the work, so no thread is spawned for a single job. The number of threads never
+ * exceeds std::thread::hardware_concurrency(). The jobs must be independent; the order of execution is unspecified.
+ * When any of the jobs throws, the remaining jobs are still run, and then the first caught exception is rethrown.
+ */
+template<typename Job>
+void parallel_for(std::size_t jobs_count, Job job)
+{
+    if (jobs_count == 0)
+        return;
+
+    std::size_t threads_count{std::min<std::size_t>(jobs_count, std::max(1u, std::thread::hardware_concurrency()))};
+
+    std::atomic<std::size_t> next_job_index{0};
+    std::exception_ptr first_exception;
+    std::mutex first_exception_mutex;
+
+    auto worker{[&]() {
+        for (auto index{next_job_index++}; index < jobs_count; index = next_job_index++)
+        {
+            try
+            {
+                job(index);
+            } catch (...)
+            {
+                std::lock_guard lock{first_exception_mutex};
+                if (not first_exception)
+                    first_exception = std::current_exception();
+            }
+        }
+    }};
+
+    {
+        std::vector<std::jthread> helper_threads;
+        helper_threads.reserve(threads_count - 1);
+        for (std::size_t i{1}; i < threads_count; ++i)
+            helper_threads.emplace_back(worker);
+        worker();
+    }
+
+    if (first_exception)
+        std::rethrow_exception(first_exception);
+}
+
+//! Calls the job for each element of the random access range, in parallel. See parallel_for() for the details.
+template<typename Range, typename Job>
+void parallel_for_each(Range& range, Job job)
+{
+    parallel_for(std::size(range), [&](std::size_t index) { job(range[index]); });
+}
+
+} // namespace Tsepepe::utils
+
+#endif /* PARALLEL_UTILS_HPP */
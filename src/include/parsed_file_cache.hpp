@@ -0,0 +1,193 @@
+/**
+ * @file        parsed_file_cache.hpp
+ * @brief       The ASTs of the recently parsed files, kept for the next code actions on the same files.
+ */
+#ifndef PARSED_FILE_CACHE_HPP
+#define PARSED_FILE_CACHE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "cancellation_token.hpp"
+#include "source_file_content.hpp"
+#include "translation_unit_cache.hpp"
+
+namespace Tsepepe
+{
+
+//! A parsed file, together with the content it is parsed from, which its AST refers to.
+struct ParsedFile
+{
+    //! The path, which the file is parsed as.
+    std::filesystem::path path;
+    //! Parsed in place of the file on the disk; none when the file is read from the disk.
+    std::optional<SourceFileContent> content;
+    //! Set only when the AST is loaded from the snapshot, rather than parsed; see ParsedFileCache::store_snapshot().
+    std::optional<TranslationUnitFingerprint> snapshot_fingerprint;
+    //! Null when the parse has failed. Declared last, so that it is destroyed before the content.
+    std::unique_ptr<clang::ASTUnit> ast_unit;
+};
+
+/**
+ * Parses the file; if the content is given, then it is parsed at the path, instead of the file on the disk. May be
+ * called from many threads at once; each parse resolves the relative paths against its own compile command directory.
+ */
+ParsedFile parse_file(const clang::tooling::CompilationDatabase&,
+                      std::filesystem::path,
+                      std::optional<SourceFileContent> = std::nullopt);
+
+/**
+ * @brief Keeps the ASTs of the recently parsed files, so that the next code action on a file does not parse it again.
+ *
+ * A code action takes an AST out of the cache, uses it exclusively, and puts it back once done with it. The AST is
+ * taken again only if neither the parsed content, the compile command, nor any of the files under the root directory,
+ * which the AST consists of, has changed since; see TranslationUnitFingerprint. Otherwise, the file is parsed again.
+ * The least recently put ASTs are dropped, when there are more of them than the capacity. Thread safe.
+ *
+ * Meant to be kept by a long-lived process, e.g. for the lifetime of an editor session, together with the compilation
+ * database, which the files are parsed with. To outlive the process, the ASTs are stored within the snapshot
+ * directory, as the clang AST files, listed by a manifest, which is versioned. A new process reads just the manifest;
+ * each AST file is loaded only once its file is taken, and if its fingerprint is still up to date, which is much faster
+ * than parsing the file. The AST files of another clang version are refused by clang, and the files are parsed then.
+ */
+class ParsedFileCache
+{
+  public:
+    static constexpr std::size_t default_capacity{16};
+
+    //! Reads the manifest of the snapshot, if the snapshot directory is given; a missing, or broken one is ignored.
+    ParsedFileCache(std::shared_ptr<clang::tooling::CompilationDatabase>,
+                    std::filesystem::path root_directory,
+                    std::size_t capacity = default_capacity,
+                    std::filesystem::path snapshot_directory = {});
+
+    /**
+     * Takes the AST of the file out of the cache, or loads it from the snapshot, if it is up to date. Otherwise, parses
+     * the file; see parse_file().
+     */
+    ParsedFile take(const std::filesystem::path&, std::optional<SourceFileContent> = std::nullopt);
+
+    //! Puts the AST back, replacing the one of the same file and content, if any; a failed parse is not kept.
+    void put(ParsedFile);
+
+    /**
+     * @brief Parses ahead the files, which the code actions on the opened file are likely to parse, e.g. when the file
+     * is opened within the editor.
+     *
+     * Those are: the opened file itself, its paired files, and the headers under the root directory, which it
+     * includes, directly or not, and which declare pure virtual functions, i.e. the likely interfaces. The content of
+     * the opened file is parsed as by the code actions; see make_virtual_source_file_path(). The files are parsed in
+     * parallel, and the token is checked before each parse; OperationCancelled is thrown on cancellation.
+     */
+    void warm_up(const std::filesystem::path& file_path,
+                 std::optional<SourceFileContent>,
+                 const CancellationToken& = {});
+
+    /**
+     * @brief Stores the ASTs kept in memory, and the ones of the snapshot, which are not loaded yet, to the snapshot,
+     * e.g. on the shutdown, or periodically; does nothing without the snapshot directory.
+     *
+     * Only the ASTs of the files read from the disk are stored, up to the capacity; the most recently put first. The
+     * ASTs stored meanwhile by the others, sharing the snapshot directory, are kept, as long as the capacity allows.
+     * The takes, and the puts, wait meanwhile. Throws BaseError on failure.
+     */
+    void store_snapshot();
+
+    //! The number of ASTs kept in memory; the ones within the snapshot are not counted, until loaded.
+    std::size_t size() const;
+
+  private:
+    struct Entry
+    {
+        std::string key;
+        TranslationUnitFingerprint fingerprint;
+        ParsedFile parsed_file;
+        //! Whether the AST file is within the snapshot already.
+        bool is_in_snapshot{false};
+    };
+
+    //! An AST, stored within the snapshot directory.
+    struct SnapshotRecord
+    {
+        std::filesystem::path path;
+        std::string ast_file_name;
+        TranslationUnitFingerprint fingerprint;
+    };
+
+    bool is_up_to_date(const TranslationUnitFingerprint&, const std::filesystem::path&) const;
+
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+    std::filesystem::path root_directory;
+    std::size_t capacity;
+    std::filesystem::path snapshot_directory;
+
+    //! The most recently put first.
+    std::list<Entry> entries;
+    //! The records of the snapshot, which are not loaded yet, keyed as the entries.
+    std::map<std::string, SnapshotRecord> snapshot_records;
+    mutable std::mutex entries_mutex;
+};
+
+/**
+ * @brief A file taken out of the cache, which is put back once the taken file is destroyed, e.g. also when the code
+ * action using it throws, or is cancelled. Without the cache, the file is just dropped then. Move only.
+ */
+class TakenParsedFile
+{
+  public:
+    TakenParsedFile() = default;
+    //! The file is put back into the cache, if not null.
+    TakenParsedFile(ParsedFile, ParsedFileCache*);
+    TakenParsedFile(TakenParsedFile&&) noexcept;
+    //! Puts back the file held so far.
+    TakenParsedFile& operator=(TakenParsedFile&&) noexcept;
+    ~TakenParsedFile();
+
+    ParsedFile& operator*()
+    {
+        return parsed_file;
+    }
+
+    const ParsedFile& operator*() const
+    {
+        return parsed_file;
+    }
+
+    ParsedFile* operator->()
+    {
+        return &parsed_file;
+    }
+
+    const ParsedFile* operator->() const
+    {
+        return &parsed_file;
+    }
+
+  private:
+    //! The failure to put the file back only drops the file, since called by the destructor.
+    void put_back() noexcept;
+
+    ParsedFile parsed_file;
+    ParsedFileCache* parsed_file_cache{nullptr};
+};
+
+/**
+ * Takes the file out of the cache, if given; see ParsedFileCache::take(). Otherwise, parses the file; see parse_file().
+ */
+TakenParsedFile take_parsed_file(ParsedFileCache*,
+                                 const clang::tooling::CompilationDatabase&,
+                                 const std::filesystem::path&,
+                                 std::optional<SourceFileContent> = std::nullopt);
+
+} // namespace Tsepepe
+
+#endif /* PARSED_FILE_CACHE_HPP */
@@ -0,0 +1,74 @@
+/**
+ * @file        sharded_class_index.hpp
+ * @brief       The class index split into the shards, one per subtree, loaded on demand.
+ */
+#ifndef SHARDED_CLASS_INDEX_HPP
+#define SHARDED_CLASS_INDEX_HPP
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "class_index.hpp"
+
+namespace Tsepepe
+{
+
+struct ShardedClassIndexParameters
+{
+    //! Only the classes defined within files under that directory are indexed.
+    std::filesystem::path root_directory;
+    //! Where each shard keeps its per translation unit results; no caching when empty.
+    std::filesystem::path cache_directory;
+    //! Each directory makes up a shard; the directories may be nested.
+    std::vector<std::filesystem::path> shard_directories;
+};
+
+/**
+ * @brief The class index of a big project, split into the shards, so that only the parts in use are ever indexed.
+ *
+ * A translation unit belongs to the shard of the deepest shard directory containing it; the translation units outside
+ * any of the shard directories make up the last shard: the rest of the project. A shard is indexed, or loaded from its
+ * cache, on the first access only, and is then kept in memory. Each shard is cached, and rebuilt, independently from
+ * the others, so a change within a subtree never makes the other subtrees scanned again. The queries spanning many
+ * shards are answered from the index merged out of them.
+ */
+class ShardedClassIndex
+{
+  public:
+    using ShardId = std::size_t;
+
+    ShardedClassIndex(std::shared_ptr<clang::tooling::CompilationDatabase>, ShardedClassIndexParameters);
+
+    //! The shard directories count, plus one for the rest of the project.
+    std::size_t get_shards_count() const;
+
+    //! The shard, which the file, or the directory, belongs to; the rest of the project if outside any shard directory.
+    ShardId find_shard(const std::filesystem::path&) const;
+
+    //! Indexes the shard on the first call. Thread safe.
+    const ClassIndex& get_shard(ShardId);
+
+    //! Merges the shards, indexing these not accessed yet; the classes present within many shards are present once.
+    ClassIndex merge(std::span<const ShardId>);
+
+  private:
+    struct Shard
+    {
+        ClassIndexingParameters parameters;
+        std::once_flag is_indexed;
+        ClassIndex index;
+    };
+
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database;
+    std::vector<std::filesystem::path> shard_directories;
+    std::vector<Shard> shards;
+};
+
+} // namespace Tsepepe
+
+#endif /* SHARDED_CLASS_INDEX_HPP */
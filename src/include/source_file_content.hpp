@@ -0,0 +1,66 @@
+/**
+ * @file        source_file_content.hpp
+ * @brief       The content of the edited source file, as passed to the code actions.
+ */
+#ifndef SOURCE_FILE_CONTENT_HPP
+#define SOURCE_FILE_CONTENT_HPP
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+namespace Tsepepe
+{
+
+/**
+ * @brief The current content of a source file, which may differ from the one on the disk, e.g. is not saved yet.
+ *
+ * The content is kept within a single, null terminated buffer, which is never copied: the copies of the
+ * SourceFileContent share it. The parser takes it as a virtual file (see make_virtual_source_file_path()), and the
+ * code, which computes the insertion offsets, as a string view. A big file is mapped, rather than read.
+ */
+class SourceFileContent
+{
+  public:
+    //! An empty content.
+    SourceFileContent();
+    //! Takes the string over, without copying the characters.
+    SourceFileContent(std::string);
+    SourceFileContent(const char*);
+
+    //! Reads, or maps, the file; throws BaseError on failure.
+    static SourceFileContent from_file(const std::filesystem::path&);
+    //! Reads the standard input till its end; throws BaseError on failure.
+    static SourceFileContent from_standard_input();
+
+    std::string_view view() const;
+    llvm::StringRef get_ref() const;
+
+    operator std::string_view() const
+    {
+        return view();
+    }
+
+  private:
+    explicit SourceFileContent(std::unique_ptr<llvm::MemoryBuffer>);
+
+    std::shared_ptr<const llvm::MemoryBuffer> buffer;
+};
+
+/**
+ * @brief Tells the path, which the content of the edited file is parsed as.
+ *
+ * The path is placed next to the edited file, so that the same compile command, and the same includes, apply to it,
+ * but its name differs, so that the parse is not mixed up with the file on the disk. If the path is a directory, then
+ * the file is ".tsepepe_<id>_temp.hpp" within that directory. Nothing is written: the path is only mapped to the
+ * content, within the virtual file system of the parser, e.g. with the clang::tooling::ClangTool::mapVirtualFile().
+ */
+std::filesystem::path make_virtual_source_file_path(const std::filesystem::path&, const std::string& id);
+
+} // namespace Tsepepe
+
+#endif /* SOURCE_FILE_CONTENT_HPP */
@@ -0,0 +1,112 @@
+/**
+ * @file        string_builder.hpp
+ * @brief       Builds the generated code within a single, pre-sized buffer.
+ */
+#ifndef STRING_BUILDER_HPP
+#define STRING_BUILDER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace Tsepepe
+{
+
+/**
+ * @brief Appends the pieces of the code to a single buffer, rather than concatenating the temporary strings.
+ *
+ * When the final size is known, or can be estimated, the buffer shall be reserved up front, so that the building
+ * allocates once. The built string is taken out with take(), leaving the builder empty.
+ */
+class StringBuilder
+{
+  public:
+    explicit StringBuilder(std::size_t reserved_size = 0)
+    {
+        buffer.reserve(reserved_size);
+    }
+
+    StringBuilder& append(std::string_view piece)
+    {
+        buffer.append(piece);
+        return *this;
+    }
+
+    StringBuilder& append(char c)
+    {
+        buffer.push_back(c);
+        return *this;
+    }
+
+    //! Appends the piece, separated with a space from the preceding one; an empty piece is skipped.
+    StringBuilder& append_word(std::string_view piece)
+    {
+        if (piece.empty())
+            return *this;
+        if (not buffer.empty())
+            buffer.push_back(' ');
+        buffer.append(piece);
+        return *this;
+    }
+
+    /**
+     * @brief Appends the pieces, with the delimiter in between, reserving the space for all of them first.
+     *
+     * The terminator, if given, is appended after each of the pieces, e.g. an empty body after each declaration.
+     */
+    template<typename BegIt, typename EndIt>
+    StringBuilder& append_joined(BegIt begin, EndIt end, std::string_view delim, std::string_view terminator = {})
+    {
+        if (begin == end)
+            return *this;
+
+        std::size_t joined_size{0};
+        for (auto it{begin}; it != end; ++it)
+            joined_size += std::string_view{*it}.size() + terminator.size() + delim.size();
+        buffer.reserve(buffer.size() + joined_size - delim.size());
+
+        for (auto it{begin}; it != end; ++it)
+        {
+            if (it != begin)
+                buffer.append(delim);
+            buffer.append(std::string_view{*it});
+            buffer.append(terminator);
+        }
+        return *this;
+    }
+
+    void reserve(std::size_t size)
+    {
+        buffer.reserve(size);
+    }
+
+    std::size_t size() const
+    {
+        return buffer.size();
+    }
+
+    bool empty() const
+    {
+        return buffer.empty();
+    }
+
+    std::string_view view() const
+    {
+        return buffer;
+    }
+
+    std::string take()
+    {
+        std::string result{std::move(buffer)};
+        buffer.clear();
+        return result;
+    }
+
+  private:
+    std::string buffer;
+};
+
+} // namespace Tsepepe
+
+#endif /* STRING_BUILDER_HPP */
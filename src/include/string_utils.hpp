@@ -5,30 +5,24 @@
 #ifndef STRING_UTILS_HPP
 #define STRING_UTILS_HPP
 
-#include <numeric>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "string_builder.hpp"
+
 namespace Tsepepe::utils
 {
 
 template<typename BegIt, typename EndIt>
-inline std::string join(BegIt begin, EndIt end, std::string delim)
+inline std::string join(BegIt begin, EndIt end, std::string_view delim)
 {
-    if (begin == end)
-        return "";
-
-    std::string init{*begin};
-    init.reserve(120);
-    return std::accumulate(
-        std::next(begin), end, std::move(init), [&delim](std::string result, const std::string& elem) {
-            return std::move(result) + delim + elem;
-        });
+    return StringBuilder{}.append_joined(begin, end, delim).take();
 }
 
-inline std::string join(const std::vector<std::string>& string_vec, std::string delim = ", ")
+inline std::string join(const std::vector<std::string>& string_vec, std::string_view delim = ", ")
 {
-    return join(std::begin(string_vec), std::end(string_vec), std::move(delim));
+    return join(std::begin(string_vec), std::end(string_vec), delim);
 }
 
 } // namespace Tsepepe::utils
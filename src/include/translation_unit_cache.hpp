@@ -0,0 +1,116 @@
+/**
+ * @file        translation_unit_cache.hpp
+ * @brief       Building blocks of the per translation unit caches, kept by the project-wide scanners.
+ */
+#ifndef TRANSLATION_UNIT_CACHE_HPP
+#define TRANSLATION_UNIT_CACHE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <clang/Basic/SourceManager.h>
+#include <clang/Tooling/CompilationDatabase.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/StringSet.h>
+#include <llvm/Support/JSON.h>
+
+namespace Tsepepe
+{
+
+//! Tells what a cached result of scanning a translation unit depends on.
+struct TranslationUnitFingerprint
+{
+    //! Zero means that the translation unit could not be scanned, thus its result shall not be cached.
+    std::uint64_t compile_command_hash{0};
+    //! The content hashes of the files under the root directory, which the translation unit consists of.
+    std::map<std::string, std::uint64_t> dependencies;
+};
+
+//! Hashes all the compile commands of the translation unit; never returns zero.
+std::uint64_t hash_compile_commands(const clang::tooling::CompilationDatabase&, const std::string& translation_unit);
+
+//! The content hashes of the files, keyed with the path; the files, which cannot be read, are left out.
+using FileHashes = llvm::StringMap<std::uint64_t>;
+
+//! Hashes all the files at once, reading them in bulk; see read_files_in_bulk().
+FileHashes hash_files(const std::vector<std::filesystem::path>&);
+
+/**
+ * @brief Hashes the current content of the files, which the cached translation units depend on.
+ *
+ * Each file is read once, however many translation units depend on it, e.g. a widely included header. The records are
+ * a map, from the translation unit, to its record, having the fingerprint field.
+ */
+template<typename TranslationUnitRecords>
+FileHashes hash_cached_dependencies(const TranslationUnitRecords& records)
+{
+    llvm::StringSet<> dependencies;
+    for (const auto& [translation_unit, record] : records)
+        for (const auto& [path, content_hash] : record.fingerprint.dependencies)
+            dependencies.insert(path);
+
+    std::vector<std::filesystem::path> file_paths;
+    file_paths.reserve(dependencies.size());
+    for (const auto& dependency : dependencies)
+        file_paths.emplace_back(dependency.getKey().str());
+    return hash_files(file_paths);
+}
+
+bool is_within_directory(const std::filesystem::path& path, const std::filesystem::path& directory);
+
+/**
+ * Takes the fingerprint of a parsed translation unit, hashing the content of its files under the root directory, as
+ * parsed. The files are not read again, so a file changed meanwhile is found outdated by the next check.
+ */
+TranslationUnitFingerprint fingerprint_translation_unit(const clang::SourceManager&,
+                                                        std::uint64_t compile_command_hash,
+                                                        const std::filesystem::path& root_directory);
+
+//! Tells whether neither the compile command, nor any of the files, has changed since the fingerprint was taken.
+bool is_up_to_date(const TranslationUnitFingerprint&,
+                   std::uint64_t compile_command_hash,
+                   const FileHashes& current_file_hashes);
+
+//! Adds the fingerprint fields to the JSON object of a cached translation unit.
+void add_to_json(const TranslationUnitFingerprint&, llvm::json::Object&);
+
+//! Reads back the fields written with add_to_json(); returns nullopt if any of them is missing or broken.
+std::optional<TranslationUnitFingerprint> fingerprint_from_json(const llvm::json::Object&);
+
+/**
+ * @brief Loads the cached records, kept under the records key of the cache file.
+ *
+ * A missing, broken, or outdated (of another format version) cache file is not an error; an empty object is returned
+ * then, so that everything is scanned again.
+ */
+llvm::json::Object load_cache_records(const std::filesystem::path& cache_file_path,
+                                      std::int64_t format_version,
+                                      llvm::StringRef records_key);
+
+/**
+ * @brief Stores the records under the records key of the cache file, creating the directories on the way.
+ *
+ * The file is written aside, and then renamed, so that a concurrent scan never reads a partially written cache.
+ * Throws BaseError on failure.
+ */
+void store_cache_records(const std::filesystem::path& cache_file_path,
+                         std::int64_t format_version,
+                         llvm::StringRef records_key,
+                         llvm::json::Object records);
+
+//! Loads the cached translation units, keyed with the translation unit path; see load_cache_records().
+llvm::json::Object load_translation_unit_cache(const std::filesystem::path& cache_file_path,
+                                               std::int64_t format_version);
+
+//! Stores the translation units, keyed with the translation unit path; see store_cache_records().
+void store_translation_unit_cache(const std::filesystem::path& cache_file_path,
+                                  std::int64_t format_version,
+                                  llvm::json::Object translation_units);
+
+} // namespace Tsepepe
+
+#endif /* TRANSLATION_UNIT_CACHE_HPP */
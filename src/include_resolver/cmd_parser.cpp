@@ -0,0 +1,56 @@
+/**
+ * @file	cmd_parser.cpp
+ * @brief	Implements command parsing for the include resolver.
+ */
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "cmd_parser.hpp"
+#include "tool.hpp"
+
+#include "clang_ast_utils.hpp"
+#include "cmd_utils.hpp"
+#include "error.hpp"
+#include "filesystem_utils.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe::IncludeResolver
+{
+
+std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
+{
+    if (Tsepepe::utils::cmd::is_command_help_requested(argc, argv))
+    {
+        print_usage(argc, argv);
+        return ReturnCode{0};
+    }
+
+    if (argc != 5 and argc != 6)
+    {
+        std::cerr << "ERROR: Wrong number of arguments provided!\n" << std::endl;
+        print_usage(argc, argv);
+        return ReturnCode{1};
+    }
+
+    try
+    {
+        Input result;
+        result.compilation_database_ptr = Tsepepe::utils::clang_ast::parse_compilation_database(argv[1]);
+        result.parameters.root_directory = Tsepepe::utils::fs::parse_and_validate_path(argv[2]);
+        result.parameters.cache_directory =
+            argc == 6 ? std::filesystem::path{argv[5]} : result.parameters.root_directory / ".cache" / "tsepepe";
+        // The graph keeps the canonical paths.
+        result.includer = std::filesystem::weakly_canonical(Tsepepe::utils::fs::parse_and_validate_path(argv[3]));
+        result.header = std::filesystem::weakly_canonical(Tsepepe::utils::fs::parse_and_validate_path(argv[4]));
+        return result;
+    } catch (const Tsepepe::Error& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return ReturnCode{1};
+    }
+}
+
+} // namespace Tsepepe::IncludeResolver
@@ -0,0 +1,20 @@
+/**
+ * @file        cmd_parser.hpp
+ * @brief       Command line parser for the include resolver.
+ */
+#ifndef CMD_PARSER_HPP
+#define CMD_PARSER_HPP
+
+#include <variant>
+
+#include "input.hpp"
+
+namespace Tsepepe::IncludeResolver
+{
+
+using ReturnCode = int;
+std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv);
+
+} // namespace Tsepepe::IncludeResolver
+
+#endif /* CMD_PARSER_HPP */
@@ -0,0 +1,27 @@
+/**
+ * @file        input.hpp
+ * @brief       Input for the include resolver.
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <filesystem>
+#include <memory>
+
+#include "include_graph.hpp"
+
+namespace Tsepepe::IncludeResolver
+{
+
+struct Input
+{
+    std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
+    IncludeGraphParameters parameters;
+    //! The file, which shall include the header.
+    std::filesystem::path includer;
+    std::filesystem::path header;
+};
+
+} // namespace Tsepepe::IncludeResolver
+
+#endif /* INPUT_HPP */
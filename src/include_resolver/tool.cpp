@@ -0,0 +1,55 @@
+/**
+ * @file	tool.cpp
+ * @brief	Main entry point for the include resolver.
+ */
+
+#include <iostream>
+
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "base_error.hpp"
+#include "cmd_parser.hpp"
+#include "input.hpp"
+#include "tool.hpp"
+
+#include "include_graph.hpp"
+#include "include_resolver.hpp"
+
+using namespace Tsepepe::IncludeResolver;
+
+int Tsepepe::IncludeResolver::run(int argc, const char** argv)
+{
+    auto input_or_return_code{parse_cmd(argc, argv)};
+    if (std::holds_alternative<ReturnCode>(input_or_return_code))
+        return std::get<ReturnCode>(input_or_return_code);
+
+    auto input{std::move(std::get<Input>(input_or_return_code))};
+
+    try
+    {
+        Tsepepe::IncludeSearchPaths search_paths;
+        if (auto compile_commands{input.compilation_database_ptr->getCompileCommands(input.includer.string())};
+            not compile_commands.empty())
+            search_paths = Tsepepe::parse_include_search_paths(compile_commands.front());
+        auto include_path{Tsepepe::spell_include(input.header, input.includer, search_paths)};
+
+        auto graph{Tsepepe::IncludeGraphBuilderLibclangBased{std::move(input.compilation_database_ptr)}.build(
+            std::move(input.parameters))};
+
+        llvm::json::OStream json{llvm::outs(), 2};
+        json.object([&] {
+            if (include_path)
+                json.attribute("include_path", *include_path);
+            else
+                json.attribute("include_path", nullptr);
+            json.attribute("is_included", graph.is_included(input.header, input.includer));
+        });
+        llvm::outs() << '\n';
+        return 0;
+    } catch (const Tsepepe::BaseError& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
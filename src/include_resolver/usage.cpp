@@ -0,0 +1,47 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the include resolver.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::IncludeResolver::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " ROOT_DIRECTORY"
+                 " INCLUDER"
+                 " HEADER"
+                 " [CACHE_DIRECTORY]"
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tTells how INCLUDER shall include HEADER, and whether it includes it already, directly or not."
+                 "\n\n\tThe include path is the shortest one, which resolves to HEADER, given the header search"
+                 "\n\tdirectories from the compile command of INCLUDER ('-I', '-iquote', '-isystem', '-idirafter')."
+                 "\n\n\tThe inclusion is told by the include graph of the files under ROOT_DIRECTORY, which is built"
+                 "\n\tby lexing the files only, following the includes from each translation unit of the compilation"
+                 "\n\tdatabase. The include directives of each file are cached within CACHE_DIRECTORY"
+                 "\n\t('ROOT_DIRECTORY/.cache/tsepepe' by default), so that only the changed files are lexed again."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tThe output is a JSON object with the include path, together with its delimiters (null if"
+                 "\n\tnone of the search directories contains HEADER), and the inclusion flag."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving '<PROJECT_ROOT>/include/gui/drawable.hpp', compiled with '-I<PROJECT_ROOT>/include', when"
+                 "\n\tthe tool is called like that:"
+                 "\n\n\t\ttsepepe_include_resolver <PROJECT_ROOT>/build <PROJECT_ROOT> <PROJECT_ROOT>/src/main.cpp"
+                 "\n\t\t    <PROJECT_ROOT>/include/gui/drawable.hpp"
+                 "\n\n\tThe output will be:"
+                 "\n\n\t\t{"
+                 "\n\t\t  \"include_path\": \"\\\"gui/drawable.hpp\\\"\","
+                 "\n\t\t  \"is_included\": false"
+                 "\n\t\t}"
+                 "\n"
+              << std::endl;
+}
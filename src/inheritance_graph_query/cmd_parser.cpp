@@ -0,0 +1,96 @@
+/**
+ * @file	cmd_parser.cpp
+ * @brief	Implements command parsing for the inheritance graph query tool.
+ */
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "cmd_parser.hpp"
+#include "tool.hpp"
+
+#include "clang_ast_utils.hpp"
+#include "cmd_utils.hpp"
+#include "error.hpp"
+#include "filesystem_utils.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static Tsepepe::InheritanceGraphQuery::Query parse_query(std::string_view);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe::InheritanceGraphQuery
+{
+
+std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
+{
+    if (Tsepepe::utils::cmd::is_command_help_requested(argc, argv))
+    {
+        print_usage(argc, argv);
+        return ReturnCode{0};
+    }
+
+    if (argc < 5)
+    {
+        std::cerr << "ERROR: Wrong number of arguments provided!\n" << std::endl;
+        print_usage(argc, argv);
+        return ReturnCode{1};
+    }
+
+    try
+    {
+        Input result;
+        result.compilation_database_ptr = Tsepepe::utils::clang_ast::parse_compilation_database(argv[1]);
+        result.parameters.root_directory = Tsepepe::utils::fs::parse_and_validate_path(argv[2]);
+        result.parameters.cache_directory = result.parameters.root_directory / ".cache" / "tsepepe";
+        result.query = parse_query(argv[3]);
+        result.name = argv[4];
+        if (result.name.empty() and result.query != Query::abstract)
+            throw Tsepepe::Error{"No class name specified!"};
+
+        bool is_cache_directory_given{false};
+        for (int i{5}; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], "--shard") == 0 and i + 1 < argc)
+                result.parameters.shard_directories.push_back(Tsepepe::utils::fs::parse_and_validate_path(argv[++i]));
+            else if (std::strcmp(argv[i], "--clangd-index") == 0 and i + 1 < argc)
+                result.clangd_index_directory = Tsepepe::utils::fs::parse_and_validate_path(argv[++i]);
+            else if (argv[i][0] != '-' and not is_cache_directory_given)
+            {
+                result.parameters.cache_directory = argv[i];
+                is_cache_directory_given = true;
+            } else
+                throw Tsepepe::Error{"Unknown, or incomplete, option: " + std::string{argv[i]}};
+        }
+        return result;
+    } catch (const Tsepepe::Error& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return ReturnCode{1};
+    }
+}
+
+} // namespace Tsepepe::InheritanceGraphQuery
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static Tsepepe::InheritanceGraphQuery::Query parse_query(std::string_view query)
+{
+    using Tsepepe::InheritanceGraphQuery::Query;
+    if (query == "implementors")
+        return Query::implementors;
+    if (query == "derived")
+        return Query::derived;
+    if (query == "bases")
+        return Query::bases;
+    if (query == "interfaces")
+        return Query::interfaces;
+    if (query == "abstract")
+        return Query::abstract;
+    throw Tsepepe::Error{"Unknown query: " + std::string{query}};
+}
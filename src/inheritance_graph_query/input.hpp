@@ -0,0 +1,40 @@
+/**
+ * @file        input.hpp
+ * @brief       Input for the inheritance graph query tool.
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "sharded_class_index.hpp"
+
+namespace Tsepepe::InheritanceGraphQuery
+{
+
+enum class Query
+{
+    implementors,
+    derived,
+    bases,
+    interfaces,
+    abstract
+};
+
+struct Input
+{
+    std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
+    //! The index is not sharded when no shard directory is given.
+    ShardedClassIndexParameters parameters;
+    //! When given, the classes are read from the clangd background index kept there, as long as it is fresh.
+    std::filesystem::path clangd_index_directory;
+    Query query;
+    //! The class name, or the name prefix for the 'abstract' query.
+    std::string name;
+};
+
+} // namespace Tsepepe::InheritanceGraphQuery
+
+#endif /* INPUT_HPP */
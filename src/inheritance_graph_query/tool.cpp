@@ -0,0 +1,130 @@
+/**
+ * @file	tool.cpp
+ * @brief	Main entry point for the inheritance graph query tool.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "base_error.hpp"
+#include "cmd_parser.hpp"
+#include "input.hpp"
+#include "tool.hpp"
+
+#include "class_index.hpp"
+#include "clangd_index.hpp"
+#include "sharded_class_index.hpp"
+#include "inheritance_graph.hpp"
+
+using namespace Tsepepe::InheritanceGraphQuery;
+using ClassId = Tsepepe::InheritanceGraph::ClassId;
+
+static Tsepepe::ClassIndex load_class_index(Input& input)
+{
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database{
+        std::move(input.compilation_database_ptr)};
+
+    // No translation unit is scanned, when the clangd background index is fresh.
+    if (not input.clangd_index_directory.empty())
+        if (auto class_index{Tsepepe::ClangdIndex{compilation_database,
+                                                  input.parameters.root_directory,
+                                                  input.clangd_index_directory}
+                                 .get_class_index()};
+            class_index)
+            return std::move(*class_index);
+
+    Tsepepe::ShardedClassIndex sharded_class_index{std::move(compilation_database), input.parameters};
+    if (input.parameters.shard_directories.empty())
+        return sharded_class_index.get_shard(0);
+
+    // Only the named subtrees are loaded; the rest of the project is never indexed.
+    std::vector<Tsepepe::ShardedClassIndex::ShardId> shard_ids;
+    for (const auto& shard_directory : input.parameters.shard_directories)
+        shard_ids.push_back(sharded_class_index.find_shard(shard_directory));
+    return sharded_class_index.merge(shard_ids);
+}
+
+static std::set<ClassId> run_query(const Tsepepe::InheritanceGraph& graph, Query query, const std::string& name)
+{
+    if (query == Query::abstract)
+    {
+        auto abstract_classes{graph.find_abstract_classes(name)};
+        return {std::begin(abstract_classes), std::end(abstract_classes)};
+    }
+
+    std::set<ClassId> result;
+    for (auto id : graph.find(name))
+    {
+        std::vector<ClassId> found;
+        switch (query)
+        {
+        case Query::implementors:
+            found = graph.find_implementors(id);
+            break;
+        case Query::derived:
+            found = graph.find_derived_classes(id);
+            break;
+        case Query::bases:
+            found = graph.find_bases(id);
+            break;
+        case Query::interfaces:
+            found = graph.find_interfaces(id);
+            break;
+        case Query::abstract:
+            break;
+        }
+        result.insert(std::begin(found), std::end(found));
+    }
+    return result;
+}
+
+int Tsepepe::InheritanceGraphQuery::run(int argc, const char** argv)
+{
+    auto input_or_return_code{parse_cmd(argc, argv)};
+    if (std::holds_alternative<ReturnCode>(input_or_return_code))
+        return std::get<ReturnCode>(input_or_return_code);
+
+    auto input{std::move(std::get<Input>(input_or_return_code))};
+
+    try
+    {
+        auto class_index{load_class_index(input)};
+        Tsepepe::InheritanceGraph graph{class_index.classes};
+
+        auto by_qualified_name{[](const Tsepepe::IndexedClass& indexed_class) -> const std::string& {
+            return indexed_class.qualified_name;
+        }};
+
+        llvm::json::OStream json{llvm::outs(), 2};
+        json.array([&] {
+            for (auto id : run_query(graph, input.query, input.name))
+                json.object([&] {
+                    auto qualified_name{graph.get_qualified_name(id)};
+                    json.attribute("qualified_name", std::string{qualified_name});
+                    json.attribute("is_abstract", graph.is_abstract(id));
+                    json.attributeArray("locations", [&] {
+                        auto definitions{std::ranges::equal_range(
+                            class_index.classes, qualified_name, std::less<>{}, by_qualified_name)};
+                        for (const auto& definition : definitions)
+                            json.object([&] {
+                                json.attribute("file", definition.location.file.string());
+                                json.attribute("line", definition.location.line);
+                            });
+                    });
+                });
+        });
+        llvm::outs() << '\n';
+        return 0;
+    } catch (const Tsepepe::BaseError& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,71 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the inheritance graph query.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::InheritanceGraphQuery::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " ROOT_DIRECTORY"
+                 " QUERY"
+                 " NAME"
+                 " [CACHE_DIRECTORY]"
+                 " [--shard SHARD_DIRECTORY]..."
+                 " [--clangd-index INDEX_DIRECTORY]"
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tAnswers the QUERY about the classes called NAME, within the inheritance graph of all the"
+                 "\n\tclasses defined within the files under ROOT_DIRECTORY. The QUERY is one of:"
+                 "\n\n\t\timplementors - the non-abstract classes deriving from NAME, directly or not,"
+                 "\n\t\tderived      - all the classes deriving from NAME, directly or not,"
+                 "\n\t\tbases        - all the bases of NAME, direct or not,"
+                 "\n\t\tinterfaces   - the abstract bases of NAME, direct or not,"
+                 "\n\t\tabstract     - all the abstract classes, whose name starts with NAME, which may be empty;"
+                 "\n\t\t               useful for the interface name completion."
+                 "\n\n\tThe NAME may be bare, e.g. 'Interface', or partially qualified, e.g. 'Namespace::Interface'."
+                 "\n\tA NAME starting with '::' is matched exactly."
+                 "\n\n\tThe graph is built from the class index, whose per translation unit results are cached within"
+                 "\n\tCACHE_DIRECTORY, which defaults to 'ROOT_DIRECTORY/.cache/tsepepe'. A translation unit is"
+                 "\n\tscanned again only when its compile command, or any of its files under ROOT_DIRECTORY, has"
+                 "\n\tchanged."
+                 "\n\n\tWithin a big project, the query may be restricted to the subtrees in use, each given with"
+                 "\n\t--shard. The index is then split into the shards, one per SHARD_DIRECTORY, and only the given"
+                 "\n\tshards are indexed, and queried; the classes defined elsewhere are seen only if included by the"
+                 "\n\ttranslation units under any SHARD_DIRECTORY. Each shard is cached, and rebuilt, on its own."
+                 "\n\n\tWith --clangd-index, the classes are read from the background index of clangd, kept within"
+                 "\n\tINDEX_DIRECTORY, e.g. 'ROOT_DIRECTORY/.cache/clangd/index', and no translation unit is scanned."
+                 "\n\tThe clangd index is used only if it is fresh: each file is indexed after it has last changed, and"
+                 "\n\teach translation unit under ROOT_DIRECTORY is indexed. Otherwise, the class index is used."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tThe output is a JSON array of the found classes, ordered by the qualified name; each with the"
+                 "\n\tlocations of its definitions, which are empty for the classes defined outside ROOT_DIRECTORY."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving 'struct Shape { virtual void draw() = 0; };' and 'struct Circle : Shape { ... };'"
+                 "\n\tdefined within '<PROJECT_ROOT>/shapes.hpp', when the tool is called like that:"
+                 "\n\n\t\ttsepepe_inheritance_graph_query <PROJECT_ROOT>/build <PROJECT_ROOT> implementors Shape"
+                 "\n\n\tThe output will be:"
+                 "\n\n\t\t["
+                 "\n\t\t  {"
+                 "\n\t\t    \"qualified_name\": \"Circle\","
+                 "\n\t\t    \"is_abstract\": false,"
+                 "\n\t\t    \"locations\": ["
+                 "\n\t\t      {"
+                 "\n\t\t        \"file\": \"<PROJECT_ROOT>/shapes.hpp\","
+                 "\n\t\t        \"line\": 2"
+                 "\n\t\t      }"
+                 "\n\t\t    ]"
+                 "\n\t\t  }"
+                 "\n\t\t]"
+                 "\n"
+              << std::endl;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file	cmd_parser.cpp
+ * @brief	Implements command parsing for the interface completer.
+ */
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "cmd_parser.hpp"
+#include "tool.hpp"
+
+#include "clang_ast_utils.hpp"
+#include "cmd_utils.hpp"
+#include "error.hpp"
+#include "filesystem_utils.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe::InterfaceCompleter
+{
+
+std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
+{
+    if (Tsepepe::utils::cmd::is_command_help_requested(argc, argv))
+    {
+        print_usage(argc, argv);
+        return ReturnCode{0};
+    }
+
+    if (argc < 5)
+    {
+        std::cerr << "ERROR: Wrong number of arguments provided!\n" << std::endl;
+        print_usage(argc, argv);
+        return ReturnCode{1};
+    }
+
+    try
+    {
+        Input result;
+        result.compilation_database_ptr = Tsepepe::utils::clang_ast::parse_compilation_database(argv[1]);
+        result.indexing_parameters.root_directory = Tsepepe::utils::fs::parse_and_validate_path(argv[2]);
+        result.indexing_parameters.cache_directory = result.indexing_parameters.root_directory / ".cache" / "tsepepe";
+        result.is_refresh_requested = false;
+        result.completion_parameters = {.pattern = argv[4],
+                                        .mode = CompletionMode::prefix,
+                                        .current_file = std::filesystem::absolute(argv[3])};
+
+        for (int i{5}; i < argc; ++i)
+        {
+            auto has_value{i + 1 < argc};
+            if (std::strcmp(argv[i], "--fuzzy") == 0)
+                result.completion_parameters.mode = CompletionMode::fuzzy;
+            else if (std::strcmp(argv[i], "--refresh") == 0)
+                result.is_refresh_requested = true;
+            else if (std::strcmp(argv[i], "--max-results") == 0 and has_value)
+                result.completion_parameters.max_results = Tsepepe::utils::cmd::parse_and_validate_number(argv[++i]);
+            else if (std::strcmp(argv[i], "--cache-directory") == 0 and has_value)
+                result.indexing_parameters.cache_directory = argv[++i];
+            else
+                throw Tsepepe::Error{"Unknown, or incomplete, option: " + std::string{argv[i]}};
+        }
+        return result;
+    } catch (const Tsepepe::Error& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return ReturnCode{1};
+    }
+}
+
+} // namespace Tsepepe::InterfaceCompleter
@@ -0,0 +1,27 @@
+/**
+ * @file        input.hpp
+ * @brief       Input for the interface completer.
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <memory>
+
+#include "class_index.hpp"
+#include "interface_symbol_table.hpp"
+
+namespace Tsepepe::InterfaceCompleter
+{
+
+struct Input
+{
+    std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
+    //! Used only when the symbol table is (re)built.
+    ClassIndexingParameters indexing_parameters;
+    bool is_refresh_requested;
+    InterfaceCompletionParameters completion_parameters;
+};
+
+} // namespace Tsepepe::InterfaceCompleter
+
+#endif /* INPUT_HPP */
@@ -0,0 +1,65 @@
+/**
+ * @file	tool.cpp
+ * @brief	Main entry point for the interface completer.
+ */
+
+#include <filesystem>
+#include <iostream>
+
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "base_error.hpp"
+#include "cmd_parser.hpp"
+#include "input.hpp"
+#include "tool.hpp"
+
+#include "class_index.hpp"
+#include "index_segment.hpp"
+#include "interface_symbol_table.hpp"
+
+using namespace Tsepepe::InterfaceCompleter;
+
+int Tsepepe::InterfaceCompleter::run(int argc, const char** argv)
+{
+    auto input_or_return_code{parse_cmd(argc, argv)};
+    if (std::holds_alternative<ReturnCode>(input_or_return_code))
+        return std::get<ReturnCode>(input_or_return_code);
+
+    auto input{std::move(std::get<Input>(input_or_return_code))};
+
+    try
+    {
+        auto table_file_path{input.indexing_parameters.cache_directory / "interface_symbols.bin"};
+        if (input.is_refresh_requested or not std::filesystem::exists(table_file_path))
+        {
+            // The completers started at once build the table one by one; a later one may find it built already.
+            Tsepepe::IndexWriterLock writer_lock{std::filesystem::path{table_file_path}.concat(".lock")};
+            if (input.is_refresh_requested or not std::filesystem::exists(table_file_path))
+            {
+                auto class_index{Tsepepe::ClassIndexerLibclangBased{std::move(input.compilation_database_ptr)}.index(
+                    input.indexing_parameters)};
+                Tsepepe::InterfaceSymbolTable::write(class_index, table_file_path);
+            }
+        }
+
+        Tsepepe::InterfaceSymbolTable table{table_file_path};
+        auto candidates{table.complete(input.completion_parameters)};
+
+        llvm::json::OStream json{llvm::outs(), 2};
+        json.array([&] {
+            for (const auto& candidate : candidates)
+                json.object([&] {
+                    json.attribute("qualified_name", candidate.qualified_name);
+                    json.attribute("file", candidate.location.file.string());
+                    json.attribute("line", candidate.location.line);
+                });
+        });
+        llvm::outs() << '\n';
+        return 0;
+    } catch (const Tsepepe::BaseError& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
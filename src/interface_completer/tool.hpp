@@ -0,0 +1,19 @@
+/**
+ * @file        tool.hpp
+ * @brief       Entry points of the interface completer, dispatched to by the tsepepe multi-call binary.
+ */
+#ifndef INTERFACE_COMPLETER_TOOL_HPP
+#define INTERFACE_COMPLETER_TOOL_HPP
+
+namespace Tsepepe::InterfaceCompleter
+{
+
+//! Runs the tool with the given command line arguments, as if it were a standalone program; returns its exit code.
+int run(int argc, const char** argv);
+
+//! Depends on the standard library only, so that the usage is printed without loading the clang libraries.
+void print_usage(int argc, const char** argv);
+
+} // namespace Tsepepe::InterfaceCompleter
+
+#endif /* INTERFACE_COMPLETER_TOOL_HPP */
@@ -0,0 +1,54 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the interface completer.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::InterfaceCompleter::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " ROOT_DIRECTORY"
+                 " CURRENT_FILE"
+                 " PATTERN"
+                 " [--fuzzy]"
+                 " [--refresh]"
+                 " [--max-results COUNT]"
+                 " [--cache-directory CACHE_DIRECTORY]"
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tLists the interfaces (the abstract classes) defined under ROOT_DIRECTORY, whose bare name"
+                 "\n\tstarts with PATTERN (case sensitive), or, with --fuzzy, contains the PATTERN characters in"
+                 "\n\torder (case insensitive; the qualified name is matched when PATTERN contains '::')."
+                 "\n\tThe interfaces defined closer to CURRENT_FILE are ranked higher. At most COUNT (50 by default)"
+                 "\n\tinterfaces are listed."
+                 "\n\n\tThe interface names are kept within a symbol table file, which is memory mapped, under"
+                 "\n\tCACHE_DIRECTORY ('ROOT_DIRECTORY/.cache/tsepepe' by default). The table is built from the"
+                 "\n\tclass index when it does not exist yet, or when --refresh is passed; e.g. run it with --refresh"
+                 "\n\ton every save, and without it on every keystroke."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tThe output is a JSON array of the interfaces, best ranked first, each with its qualified name,"
+                 "\n\tfile and line."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving 'Gui::Drawable' defined within '<PROJECT_ROOT>/gui/drawable.hpp', when the tool is"
+                 "\n\tcalled like that:"
+                 "\n\n\t\ttsepepe_interface_completer <PROJECT_ROOT>/build <PROJECT_ROOT> <PROJECT_ROOT>/main.cpp Dra"
+                 "\n\n\tThe output will be:"
+                 "\n\n\t\t["
+                 "\n\t\t  {"
+                 "\n\t\t    \"qualified_name\": \"Gui::Drawable\","
+                 "\n\t\t    \"file\": \"<PROJECT_ROOT>/gui/drawable.hpp\","
+                 "\n\t\t    \"line\": 3"
+                 "\n\t\t  }"
+                 "\n\t\t]"
+                 "\n"
+              << std::endl;
+}
@@ -0,0 +1,23 @@
+/**
+ * @file        input.hpp
+ * @brief       Input for the missing definitions generator.
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <memory>
+
+#include "generate_missing_definitions_code_action.hpp"
+
+namespace Tsepepe::MissingDefinitionsGenerator
+{
+
+struct Input
+{
+    std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
+    GenerateMissingDefinitionsCodeActionParameters parameters;
+};
+
+} // namespace Tsepepe::MissingDefinitionsGenerator
+
+#endif /* INPUT_HPP */
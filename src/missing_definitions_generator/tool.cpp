@@ -0,0 +1,45 @@
+/**
+ * @file	tool.cpp
+ * @brief	Main entry point for the missing definitions generator.
+ */
+
+#include <iostream>
+
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "base_error.hpp"
+#include "cmd_parser.hpp"
+#include "input.hpp"
+#include "tool.hpp"
+
+#include "generate_missing_definitions_code_action.hpp"
+
+using namespace Tsepepe::MissingDefinitionsGenerator;
+
+int Tsepepe::MissingDefinitionsGenerator::run(int argc, const char** argv)
+{
+    auto input_or_return_code{parse_cmd(argc, argv)};
+    if (std::holds_alternative<ReturnCode>(input_or_return_code))
+        return std::get<ReturnCode>(input_or_return_code);
+
+    auto input{std::move(std::get<Input>(input_or_return_code))};
+
+    try
+    {
+        auto result{Tsepepe::GenerateMissingDefinitionsCodeActionLibclangBased{std::move(input.compilation_database_ptr)}.apply(
+            std::move(input.parameters))};
+
+        llvm::json::OStream json{llvm::outs(), 2};
+        json.object([&] {
+            for (const auto& [path, new_file_content] : result)
+                json.attribute(path.string(), new_file_content);
+        });
+        llvm::outs() << '\n';
+        return 0;
+    } catch (const Tsepepe::BaseError& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the missing definitions generator.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::MissingDefinitionsGenerator::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " ROOT_DIRECTORY"
+                 " HEADER_FILE..."
+                 " [--format[=STYLE]]"
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tGenerates the definitions of all the functions, which are declared, but not defined yet,"
+                 "\n\twithin the HEADER_FILEs. The headers are processed in parallel."
+                 "\n\n\tFor each header, its paired source file (e.g. 'foo.cpp' for 'foo.hpp') is looked for under"
+                 "\n\tthe ROOT_DIRECTORY. The functions defined there already are skipped. The new definitions are"
+                 "\n\tappended to the paired source file, in the declaration order. When no paired source file"
+                 "\n\texists, a new one, which includes the header, is created next to the header."
+                 "\n\n\tTemplates, inline, constexpr, deleted, defaulted and pure virtual functions are skipped."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tThe output is a JSON object, which maps the path of each source file to its new content."
+                 "\n\tSource files which need no edits are not present in the output."
+                 "\n\n\tWith the --format option, the generated code is formatted with clang-format, in-process;"
+                 "\n\tthe rest of the file is left untouched. The STYLE is as the clang-format -style option, e.g."
+                 "\n\t'LLVM', or 'file' (the default), to look up the .clang-format file."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving a header 'src/include/foo.hpp' with content:"
+                 "\n\n\t\tstruct Foo"
+                 "\n\t\t{"
+                 "\n\t\t    void run();"
+                 "\n\t\t    int stop(unsigned timeout);"
+                 "\n\t\t};"
+                 "\n\n\tand a source 'src/foo.cpp', which includes the header and defines 'Foo::run()' already,"
+                 "\n\twhen the tool is called like that:"
+                 "\n\n\t\ttsepepe_missing_definitions_generator <PROJECT_ROOT>/build <PROJECT_ROOT> src/include/foo.hpp"
+                 "\n\n\tthe new content of 'src/foo.cpp' will have the following definition appended:"
+                 "\n\n\t\tint Foo::stop(unsigned int timeout)"
+                 "\n\t\t{"
+                 "\n\t\t}"
+                 "\n"
+              << std::endl;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file	cmd_parser.cpp
+ * @brief	Implements command parsing for the missing overrides generator.
+ */
+#include <iostream>
+#include <string>
+
+#include "cmd_parser.hpp"
+#include "tool.hpp"
+
+#include "clang_ast_utils.hpp"
+#include "cmd_utils.hpp"
+#include "error.hpp"
+#include "filesystem_utils.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe::MissingOverridesGenerator
+{
+
+std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
+{
+    if (Tsepepe::utils::cmd::is_command_help_requested(argc, argv))
+    {
+        print_usage(argc, argv);
+        return ReturnCode{0};
+    }
+
+    auto code_formatting{Tsepepe::utils::cmd::take_code_formatting_option(argc, argv)};
+
+    if (argc != 4 and argc != 5)
+    {
+        std::cerr << "ERROR: Wrong number of arguments provided!\n" << std::endl;
+        print_usage(argc, argv);
+        return ReturnCode{1};
+    }
+
+    try
+    {
+        Input result;
+        result.compilation_database_ptr = Tsepepe::utils::clang_ast::parse_compilation_database(argv[1]);
+        result.parameters.root_directory = Tsepepe::utils::fs::parse_and_validate_path(argv[2]);
+        result.parameters.interface_name = argv[3];
+        if (result.parameters.interface_name.empty())
+            throw Tsepepe::Error{"No interface name specified!"};
+        if (argc == 5)
+            result.parameters.cache_directory = argv[4];
+        result.parameters.code_formatting = std::move(code_formatting);
+        return result;
+    } catch (const Tsepepe::Error& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return ReturnCode{1};
+    }
+}
+
+} // namespace Tsepepe::MissingOverridesGenerator
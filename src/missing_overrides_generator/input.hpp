@@ -0,0 +1,23 @@
+/**
+ * @file        input.hpp
+ * @brief       Input for the missing overrides generator.
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <memory>
+
+#include "missing_overrides_code_action.hpp"
+
+namespace Tsepepe::MissingOverridesGenerator
+{
+
+struct Input
+{
+    std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
+    MissingOverridesCodeActionParameters parameters;
+};
+
+} // namespace Tsepepe::MissingOverridesGenerator
+
+#endif /* INPUT_HPP */
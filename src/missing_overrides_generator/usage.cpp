@@ -0,0 +1,61 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the missing overrides generator.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::MissingOverridesGenerator::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " ROOT_DIRECTORY"
+                 " INTERFACE_NAME"
+                 " [CACHE_DIRECTORY]"
+                 " [--format[=STYLE]]"
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tFinds all the classes deriving from INTERFACE_NAME, within the translation units including its"
+                 "\n\tdefinition, and adds the overrides of the pure virtual functions, which they"
+                 "\n\tdo not override yet. Useful after a new pure virtual function has been added to the interface."
+                 "\n\n\tOnly the classes defined within files under ROOT_DIRECTORY are edited. Classes leaving"
+                 "\n\tunimplemented pure virtual functions from beyond the interface (e.g. the interfaces"
+                 "\n\textending it), and the intermediate bases, leaving some of its pure virtual functions"
+                 "\n\tfor their derived classes, are left untouched."
+                 "\n\n\tThe INTERFACE_NAME may be a raw name, thus, when it is a nested interface,"
+                 "\n\twithin another class or a namespace, then the bare name, without the parent scope,"
+                 "\n\tmust be specified (e.g. for 'Namespace::Interface' simply pass 'Interface')."
+                 "\n\n\tWhen CACHE_DIRECTORY is given, the implementors are looked up within the inheritance graph,"
+                 "\n\tbuilt from the class index cached there, so that only a single translation unit per file"
+                 "\n\tdefining an implementor is parsed."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tThe output is a JSON object, which maps the path of each edited file to its new content."
+                 "\n\tFiles which need no edits are not present in the output."
+                 "\n\n\tWith the --format option, the generated code is formatted with clang-format, in-process;"
+                 "\n\tthe rest of the file is left untouched. The STYLE is as the clang-format -style option, e.g."
+                 "\n\t'LLVM', or 'file' (the default), to look up the .clang-format file."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving an interface, and its implementor within the project under path <PROJECT_ROOT>:"
+                 "\n\n\t\tstruct Interface"
+                 "\n\t\t{"
+                 "\n\t\t    virtual void run() = 0;"
+                 "\n\t\t    virtual void stop() = 0; // Just added"
+                 "\n\t\t};"
+                 "\n\n\t\tstruct Implementor : Interface"
+                 "\n\t\t{"
+                 "\n\t\t    void run() override;"
+                 "\n\t\t};"
+                 "\n\n\tWhen the tool is called like that:"
+                 "\n\n\t\ttsepepe_missing_overrides_generator <PROJECT_ROOT>/build <PROJECT_ROOT> Interface"
+                 "\n\n\tThe 'void stop() override;' line will be added just after the 'run' method override,"
+                 "\n\twithin the new content of the file with the implementor."
+                 "\n"
+              << std::endl;
+}
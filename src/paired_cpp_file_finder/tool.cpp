@@ -5,18 +5,19 @@
 #include <iostream>
 
 #include "cmd_parser.hpp"
-#include "finder.hpp"
+#include "paired_cpp_file_finder.hpp"
+#include "tool.hpp"
 
 using namespace Tsepepe::PairedCppFileFinder;
 
-int main(int argc, const char* argv[])
+int Tsepepe::PairedCppFileFinder::run(int argc, const char** argv)
 {
     auto input_or_return_code{parse_cmd(argc, argv)};
     if (std::holds_alternative<ReturnCode>(input_or_return_code))
         return std::get<ReturnCode>(input_or_return_code);
 
     auto input{std::get<Input>(input_or_return_code)};
-    auto matches{find(input)};
+    auto matches{Tsepepe::find_paired_cpp_files(input.project_directory, input.cpp_file)};
     if (matches.empty())
     {
         std::cerr << "ERROR: No paired C++ file found for: " << input.cpp_file
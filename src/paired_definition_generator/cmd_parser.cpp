@@ -0,0 +1,61 @@
+/**
+ * @file	cmd_parser.cpp
+ * @brief	Implements command parsing for the paired definition generator.
+ */
+#include <iostream>
+
+#include "cmd_parser.hpp"
+#include "tool.hpp"
+
+#include "clang_ast_utils.hpp"
+#include "cmd_utils.hpp"
+#include "error.hpp"
+#include "filesystem_utils.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe::PairedDefinitionGenerator
+{
+
+std::variant<Input, ReturnCode> parse_cmd(int argc, const char** argv)
+{
+    if (Tsepepe::utils::cmd::is_command_help_requested(argc, argv))
+    {
+        print_usage(argc, argv);
+        return ReturnCode{0};
+    }
+
+    auto code_formatting{Tsepepe::utils::cmd::take_code_formatting_option(argc, argv)};
+
+    if (argc != 6 and argc != 7)
+    {
+        std::cerr << "ERROR: Wrong number of arguments provided!\n" << std::endl;
+        print_usage(argc, argv);
+        return ReturnCode{1};
+    }
+
+    try
+    {
+        Input result;
+        result.compilation_database_ptr = Tsepepe::utils::clang_ast::parse_compilation_database(argv[1]);
+
+        auto& params{result.parameters};
+        params.root_directory = Tsepepe::utils::fs::parse_and_validate_path(argv[2]);
+        params.header_file_path = Tsepepe::utils::fs::parse_and_validate_path(argv[3]);
+        params.header_file_content = Tsepepe::utils::cmd::parse_source_file_content(argv[4]);
+        params.selected_line_begin = Tsepepe::utils::cmd::parse_and_validate_number(argv[5]);
+        if (argc == 7)
+            params.selected_line_end = Tsepepe::utils::cmd::parse_and_validate_number(argv[6]);
+        else
+            params.selected_line_end = params.selected_line_begin;
+        params.code_formatting = std::move(code_formatting);
+        return result;
+    } catch (const Tsepepe::Error& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return ReturnCode{1};
+    }
+}
+
+} // namespace Tsepepe::PairedDefinitionGenerator
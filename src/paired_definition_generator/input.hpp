@@ -0,0 +1,23 @@
+/**
+ * @file        input.hpp
+ * @brief       Input for the paired definition generator.
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <memory>
+
+#include "generate_definitions_in_paired_source_code_action.hpp"
+
+namespace Tsepepe::PairedDefinitionGenerator
+{
+
+struct Input
+{
+    std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database_ptr;
+    GenerateDefinitionsInPairedSourceCodeActionParameters parameters;
+};
+
+} // namespace Tsepepe::PairedDefinitionGenerator
+
+#endif /* INPUT_HPP */
@@ -0,0 +1,44 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the paired definition generator.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::PairedDefinitionGenerator::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path
+              << " COMP_DB_DIR"
+                 " ROOT_DIRECTORY"
+                 " HEADER_FILE_PATH"
+                 " HEADER_FILE_CONTENT"
+                 " CURSOR_POSITION_LINE_BEGIN"
+                 " [CURSOR_POSITION_LINE_END]"
+                 " [--format[=STYLE]]"
+                 " \n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tGenerates function definitions for each function declaration, which can be found within the"
+                 "\n\tentire header (HEADER_FILE_CONTENT), in the range of lines"
+                 "\n\t<CURSOR_POSITION_LINE_BEGIN; CURSOR_POSITION_LINE_END>, and places them straight into the"
+                 "\n\tpaired source file (e.g. 'foo.cpp' for 'foo.hpp'), which is looked for under the"
+                 "\n\tROOT_DIRECTORY. The CURSOR_POSITION_LINE_END is optional."
+                 "\n\n\tEach definition is placed next to the definitions of the functions declared around it,"
+                 "\n\tin the declaration order; otherwise it is appended to the source file. Functions defined"
+                 "\n\twithin the source file already are skipped. When no paired source file exists, a new one,"
+                 "\n\twhich includes the header, is created next to the header."
+                 "\n\n\tThe HEADER_FILE_CONTENT may be '-', to read the content from the standard input, or '@PATH', to"
+                 "\n\tread it from the file under the PATH, e.g. when the content is too long for the command line."
+                 "\n\n\tWe need the path to the directory containing compile_commands.json as well,"
+                 "\n\twhich shall be supplied with COMP_DB_DIR parameter."
+                 "\n\n\tThe output is a JSON object, which maps the path of the source file to its new content."
+                 "\n\n\tWith the --format option, the generated code is formatted with clang-format, in-process;"
+                 "\n\tthe rest of the file is left untouched. The STYLE is as the clang-format -style option, e.g."
+                 "\n\t'LLVM', or 'file' (the default), to look up the .clang-format file."
+                 "\n\n"
+              << std::endl;
+}
@@ -7,6 +7,7 @@
 #include <clang/ASTMatchers/ASTMatchers.h>
 #include <clang/Tooling/Tooling.h>
 
+#include <optional>
 #include <regex>
 
 #include "extractor.hpp"
@@ -25,61 +26,67 @@ AST_MATCHER(CXXRecordDecl, isAbstract)
 class MatchCollector : public ast::MatchFinder::MatchCallback
 {
   public:
-    MatchCollector() : printing_policy{lang_options}
+    MatchCollector(Tsepepe::PureVirtualFunctionsExtractor::OverrideDeclarations& override_declarations,
+                   std::optional<std::string> queried_class_name) :
+        override_declarations{override_declarations},
+        queried_class_name{std::move(queried_class_name)},
+        printing_policy{lang_options}
     {
         printing_policy.adjustForCPlusPlus();
     }
 
     void run(const ast::MatchFinder::MatchResult& result) override
     {
-        auto node{result.Nodes.getNodeAs<CXXRecordDecl>("abstract class")};
+        auto node{result.Nodes.getNodeAs<CXXRecordDecl>("class")};
         if (node == nullptr)
             return;
+
+        auto key{queried_class_name ? *queried_class_name : node->getQualifiedNameAsString()};
+        auto& function_override_declarations{override_declarations[std::move(key)]};
+
         const auto& source_manager{result.Context->getSourceManager()};
         node->forallBases([&](const CXXRecordDecl* base) {
-            collect_override_declarations(base, source_manager);
+            collect_override_declarations(base, source_manager, function_override_declarations);
             return true;
         });
-        collect_override_declarations(node, source_manager);
-    }
-
-    const std::vector<std::string>& get_result()
-    {
-        return function_override_declarations;
+        collect_override_declarations(node, source_manager, function_override_declarations);
     }
 
   private:
-    void collect_override_declarations(const CXXRecordDecl* record, const SourceManager& source_manager)
+    void collect_override_declarations(const CXXRecordDecl* record,
+                                       const SourceManager& source_manager,
+                                       std::vector<std::string>& function_override_declarations)
     {
         for (auto method : record->methods())
             if (method->isPure())
-                append_override_declaration(method, source_manager);
+                function_override_declarations.emplace_back(make_override_declaration(method, source_manager));
     }
 
-    void append_override_declaration(const CXXMethodDecl* method, const SourceManager& source_manager)
+    std::string make_override_declaration(const CXXMethodDecl* method, const SourceManager& source_manager)
     {
         auto declaration{Tsepepe::utils::clang_ast::source_range_content_to_string(
             method->getSourceRange(), source_manager, lang_options)};
 
         std::regex overrider{"virtual\\s+(.*)(\\s+=\\s+0)"};
-        auto override_declaration{std::regex_replace(declaration, overrider, "$1 override;")};
-
-        function_override_declarations.emplace_back(std::move(override_declaration));
+        return std::regex_replace(declaration, overrider, "$1 override;");
     }
 
-    std::vector<std::string> function_override_declarations;
+    Tsepepe::PureVirtualFunctionsExtractor::OverrideDeclarations& override_declarations;
+    std::optional<std::string> queried_class_name;
     clang::LangOptions lang_options;
     clang::PrintingPolicy printing_policy;
 };
 
-std::vector<std::string> Tsepepe::PureVirtualFunctionsExtractor::extract(const Input& input)
+Tsepepe::PureVirtualFunctionsExtractor::OverrideDeclarations
+Tsepepe::PureVirtualFunctionsExtractor::extract(const Input& input)
 {
-    auto abstract_class_matcher{
-        ast_matchers::cxxRecordDecl(isAbstract(), ast_matchers::hasName(input.class_name)).bind("abstract class")};
+    OverrideDeclarations result;
 
     ast::MatchFinder finder;
-    MatchCollector collector;
-    finder.addMatcher(abstract_class_matcher, &collector);
+    auto collectors{Tsepepe::utils::clang_ast::add_class_matchers(
+        finder, input.class_query, isAbstract(), [&](std::optional<std::string> queried_class_name) {
+            return std::make_unique<MatchCollector>(result, std::move(queried_class_name));
+        })};
 
     ClangTool tool{*input.compilation_database_ptr, {input.header_file}};
 
@@ -88,5 +95,5 @@ std::vector<std::string> Tsepepe::PureVirtualFunctionsExtractor::extract(const I
 
     tool.run(newFrontendActionFactory(&finder).get());
 
-    return collector.get_result();
+    return result;
 }
@@ -5,6 +5,7 @@
 #ifndef EXTRACTOR_HPP
 #define EXTRACTOR_HPP
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -13,7 +14,11 @@
 namespace Tsepepe::PureVirtualFunctionsExtractor
 {
 
-std::vector<std::string> extract(const Input& input);
+//! Maps the queried class name (or the full class name, when all the classes are queried) to its override declarations.
+using OverrideDeclarations = std::map<std::string, std::vector<std::string>>;
+
+//! Finds all the queried abstract classes within a single pass over the header; the classes not found are absent.
+OverrideDeclarations extract(const Input& input);
 
 }
 
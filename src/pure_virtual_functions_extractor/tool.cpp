@@ -5,13 +5,17 @@
 
 #include <iostream>
 
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
 #include "cmd_parser.hpp"
 #include "extractor.hpp"
 #include "input.hpp"
+#include "tool.hpp"
 
 using namespace Tsepepe::PureVirtualFunctionsExtractor;
 
-int main(int argc, const char* argv[])
+int Tsepepe::PureVirtualFunctionsExtractor::run(int argc, const char** argv)
 {
     auto input_or_return_code{parse_cmd(argc, argv)};
     if (std::holds_alternative<ReturnCode>(input_or_return_code))
@@ -25,8 +29,21 @@ int main(int argc, const char* argv[])
         return 1;
     }
 
-    for (auto decl : override_declarations)
-        std::cout << decl << std::endl;
+    if (input.class_query.is_single_class())
+    {
+        for (auto decl : override_declarations.begin()->second)
+            std::cout << decl << std::endl;
+        return 0;
+    }
 
+    llvm::json::OStream json{llvm::outs(), 2};
+    json.object([&] {
+        for (const auto& [class_name, declarations] : override_declarations)
+            json.attributeArray(class_name, [&] {
+                for (const auto& declaration : declarations)
+                    json.value(declaration);
+            });
+    });
+    llvm::outs() << '\n';
     return 0;
 }
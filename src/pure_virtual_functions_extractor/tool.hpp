@@ -0,0 +1,19 @@
+/**
+ * @file        tool.hpp
+ * @brief       Entry points of the pure virtual functions extractor, dispatched to by the tsepepe multi-call binary.
+ */
+#ifndef PURE_VIRTUAL_FUNCTIONS_EXTRACTOR_TOOL_HPP
+#define PURE_VIRTUAL_FUNCTIONS_EXTRACTOR_TOOL_HPP
+
+namespace Tsepepe::PureVirtualFunctionsExtractor
+{
+
+//! Runs the tool with the given command line arguments, as if it were a standalone program; returns its exit code.
+int run(int argc, const char** argv);
+
+//! Depends on the standard library only, so that the usage is printed without loading the clang libraries.
+void print_usage(int argc, const char** argv);
+
+} // namespace Tsepepe::PureVirtualFunctionsExtractor
+
+#endif /* PURE_VIRTUAL_FUNCTIONS_EXTRACTOR_TOOL_HPP */
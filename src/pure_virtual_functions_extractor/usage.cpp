@@ -0,0 +1,38 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the pure virtual functions extractor.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::PureVirtualFunctionsExtractor::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path << " COMP_DB_DIR HEADER_FILE CLASS_NAME...\n\t" << program_path
+              << " COMP_DB_DIR HEADER_FILE --all\n\n";
+    std::cout << "DESCRIPTION:\n\tPrints out all the pure virtual functions as override declarations, one per line."
+                 "\n\tThe input file HEADER_FILE must contain an abstract class called CLASS_NAME."
+                 "\n\tRequires compilation database (compile_commands.json) put in the COMP_DB_DIR directory."
+                 "\n\n\tMany CLASS_NAMEs may be given at once, or the --all option, to query all the classes defined"
+                 "\n\twithin the HEADER_FILE; the header is parsed only once then. The output is then a JSON object,"
+                 "\n\twhich maps each class name (the full class name, for --all) to the result for that class."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving a header file \"printer.hpp\" with content:"
+                 "\n\n\t\t// ..."
+                 "\n\t\tstruct Printer {"
+                 "\n\t\t\tvirtual int print(std::string) = 0"
+                 "\n\t\t\tvirtual void drop() = 0"
+                 "\n\t\t\t// ..."
+                 "\n\n\tWhen the tool is called like that:"
+                 "\n\n\t\ttsepepe_pure_virtual_functions_extractor path/to/dir/with/comp/db printer.hpp Printer"
+                 "\n\n\tThe output will be:"
+                 "\n\n\t\tint print(std::string) override;"
+                 "\n\t\tvoid drop() override;"
+                 "\n"
+              << std::endl;
+}
@@ -0,0 +1,294 @@
+/**
+ * @file	bulk_file_reader.cpp
+ * @brief	Implements the bulk file reading, with the io_uring, or synchronously.
+ */
+#include "bulk_file_reader.hpp"
+
+#include <llvm/Support/MemoryBuffer.h>
+
+#ifdef TSEPEPE_HAS_IO_URING
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <liburing.h>
+#include <unistd.h>
+
+#include "base_error.hpp"
+#endif
+
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static void read_file_synchronously(const fs::path&, std::size_t file_index, Tsepepe::FileContentConsumer);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+#ifdef TSEPEPE_HAS_IO_URING
+namespace
+{
+
+//! Most of the source files fit, so a single read per file is enough.
+constexpr std::size_t initial_buffer_size{64 * 1024};
+//! Bounds the ring size, and the memory taken by the buffers.
+constexpr std::size_t max_slots_count{1024};
+
+//! A file being read; the slot is reused for the next files, together with its buffer.
+struct ReadSlot
+{
+    std::size_t file_index{0};
+    //! -1 while the file is being opened.
+    int file_descriptor{-1};
+    std::vector<char> buffer = std::vector<char>(initial_buffer_size);
+    std::size_t size{0};
+};
+
+/**
+ * @brief Keeps the io_uring, and reads the files through it, each within a slot of its own.
+ *
+ * Each slot has a single operation in flight at once: the open, or a read. The buffer of a slot grows when a read fills
+ * it. The files are closed with the io_uring, too, without waiting for it.
+ *
+ * When reading stops with an error, e.g. thrown by the consumer, the operations still in flight are cancelled, and
+ * waited for, before the slots are released, since the kernel may still write to their buffers.
+ */
+class IoUringBulkReader
+{
+  public:
+    IoUringBulkReader(std::span<const fs::path> file_paths,
+                      Tsepepe::FileContentConsumer consumer,
+                      std::size_t max_in_flight) :
+        file_paths{file_paths},
+        consumer{consumer},
+        slots(std::clamp<std::size_t>(std::min(max_in_flight, file_paths.size()), 1, max_slots_count))
+    {
+        // A slot may have a close in flight, besides an open, or a read.
+        is_available = io_uring_queue_init(static_cast<unsigned>(2 * slots.size()), &ring, 0) == 0;
+    }
+
+    ~IoUringBulkReader()
+    {
+        if (not is_available)
+            return;
+        drain();
+        io_uring_queue_exit(&ring);
+    }
+
+    IoUringBulkReader(const IoUringBulkReader&) = delete;
+    IoUringBulkReader& operator=(const IoUringBulkReader&) = delete;
+
+    //! False when the kernel does not provide the io_uring, or disallows it, e.g. within a container.
+    bool is_available;
+
+    void read()
+    {
+        for (auto& slot : slots)
+            start_next_file(slot);
+
+        while (in_flight_count > 0)
+        {
+            if (auto result{io_uring_submit_and_wait(&ring, 1)}; result < 0 and result != -EINTR and result != -EAGAIN)
+                throw Tsepepe::BaseError{"Failed to read the files with the io_uring: "
+                                         + std::system_category().message(-result)};
+
+            // Each completion is marked as seen before it is handled, so that the drain skips it, when handling throws.
+            io_uring_cqe* completion;
+            while (io_uring_peek_cqe(&ring, &completion) == 0)
+            {
+                auto completed{*completion};
+                io_uring_cqe_seen(&ring, completion);
+                complete(completed);
+            }
+        }
+        // The last closes.
+        io_uring_submit(&ring);
+    }
+
+  private:
+    void complete(const io_uring_cqe& completion)
+    {
+        auto slot_ptr{static_cast<ReadSlot*>(io_uring_cqe_get_data(&completion))};
+        if (slot_ptr == nullptr)
+            return; // A close.
+
+        --in_flight_count;
+        auto& slot{*slot_ptr};
+        if (completion.res < 0)
+        {
+            // E.g. the kernel does not support the operation; the missing files are reported the same way.
+            close_file(slot);
+            read_file_synchronously(file_paths[slot.file_index], slot.file_index, consumer);
+            start_next_file(slot);
+            return;
+        }
+
+        if (slot.file_descriptor == -1)
+        {
+            slot.file_descriptor = completion.res;
+            start_read(slot);
+            return;
+        }
+
+        slot.size += static_cast<std::size_t>(completion.res);
+        if (slot.size + 1 == slot.buffer.size())
+        {
+            // The file may be bigger than the buffer.
+            slot.buffer.resize(2 * slot.buffer.size());
+            start_read(slot);
+            return;
+        }
+
+        slot.buffer[slot.size] = '\0';
+        close_file(slot);
+        consumer(slot.file_index, llvm::StringRef{slot.buffer.data(), slot.size});
+        start_next_file(slot);
+    }
+
+    void start_next_file(ReadSlot& slot)
+    {
+        if (next_file_index == file_paths.size())
+            return;
+
+        slot.file_index = next_file_index++;
+        slot.size = 0;
+        auto submission{get_submission()};
+        io_uring_prep_openat(submission, AT_FDCWD, file_paths[slot.file_index].c_str(), O_RDONLY | O_CLOEXEC, 0);
+        io_uring_sqe_set_data(submission, &slot);
+        ++in_flight_count;
+    }
+
+    //! Reads till the end of the buffer, leaving a byte for the null terminator.
+    void start_read(ReadSlot& slot)
+    {
+        auto submission{get_submission()};
+        io_uring_prep_read(submission,
+                           slot.file_descriptor,
+                           slot.buffer.data() + slot.size,
+                           static_cast<unsigned>(slot.buffer.size() - slot.size - 1),
+                           slot.size);
+        io_uring_sqe_set_data(submission, &slot);
+        ++in_flight_count;
+    }
+
+    void close_file(ReadSlot& slot)
+    {
+        if (slot.file_descriptor == -1)
+            return;
+
+        auto submission{get_submission()};
+        io_uring_prep_close(submission, slot.file_descriptor);
+        io_uring_sqe_set_data(submission, nullptr);
+        slot.file_descriptor = -1;
+    }
+
+    io_uring_sqe* get_submission()
+    {
+        auto result{try_get_submission()};
+        if (result == nullptr)
+            throw Tsepepe::BaseError{"The io_uring submission queue is full!"};
+        return result;
+    }
+
+    io_uring_sqe* try_get_submission() noexcept
+    {
+        auto result{io_uring_get_sqe(&ring)};
+        if (result == nullptr)
+        {
+            io_uring_submit(&ring);
+            result = io_uring_get_sqe(&ring);
+        }
+        return result;
+    }
+
+    //! Cancels the operations still in flight, waits for all of them to complete, and closes the files left open.
+    void drain() noexcept
+    {
+        if (in_flight_count > 0)
+            for (auto& slot : slots)
+                if (auto submission{try_get_submission()}; submission != nullptr)
+                {
+                    // The slot may have nothing in flight; then the cancel just fails. Its completion is ignored, as
+                    // the one of a close.
+                    io_uring_prep_cancel(submission, &slot, 0);
+                    io_uring_sqe_set_data(submission, nullptr);
+                }
+        // As well as the closes, prepared before the reading has stopped.
+        io_uring_submit(&ring);
+
+        while (in_flight_count > 0)
+        {
+            if (auto result{io_uring_submit_and_wait(&ring, 1)};
+                result < 0 and result != -EINTR and result != -EAGAIN and result != -EBUSY)
+            {
+                // The kernel may still write to the buffers, so they are never released.
+                static_cast<void>(new std::vector<ReadSlot>{std::move(slots)});
+                return;
+            }
+
+            io_uring_cqe* completion;
+            while (io_uring_peek_cqe(&ring, &completion) == 0)
+            {
+                auto slot_ptr{static_cast<ReadSlot*>(io_uring_cqe_get_data(completion))};
+                if (slot_ptr != nullptr)
+                {
+                    --in_flight_count;
+                    // An open, which has completed before the cancel.
+                    if (slot_ptr->file_descriptor == -1 and completion->res >= 0)
+                        slot_ptr->file_descriptor = completion->res;
+                }
+                io_uring_cqe_seen(&ring, completion);
+            }
+        }
+
+        for (auto& slot : slots)
+            if (slot.file_descriptor != -1)
+                ::close(std::exchange(slot.file_descriptor, -1));
+    }
+
+    std::span<const fs::path> file_paths;
+    Tsepepe::FileContentConsumer consumer;
+    std::vector<ReadSlot> slots;
+    io_uring ring;
+
+    std::size_t next_file_index{0};
+    std::size_t in_flight_count{0};
+};
+
+} // namespace
+#endif
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::read_files_in_bulk(std::span<const fs::path> file_paths,
+                                 FileContentConsumer consumer,
+                                 std::size_t max_in_flight)
+{
+#ifdef TSEPEPE_HAS_IO_URING
+    // A single file is not worth setting up the io_uring.
+    if (file_paths.size() > 1)
+        if (IoUringBulkReader reader{file_paths, consumer, max_in_flight}; reader.is_available)
+            return reader.read();
+#endif
+
+    for (std::size_t i{0}; i < file_paths.size(); ++i)
+        read_file_synchronously(file_paths[i], i, consumer);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static void
+read_file_synchronously(const fs::path& file_path, std::size_t file_index, Tsepepe::FileContentConsumer consumer)
+{
+    // Big enough files get mapped, rather than read.
+    auto buffer{llvm::MemoryBuffer::getFile(file_path.string())};
+    consumer(file_index, buffer ? std::optional{(*buffer)->getBuffer()} : std::nullopt);
+}
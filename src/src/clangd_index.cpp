@@ -0,0 +1,861 @@
+/**
+ * @file	clangd_index.cpp
+ * @brief	Implements the ClangdIndex.
+ */
+#include "clangd_index.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#include <clang/Basic/LangOptions.h>
+#include <clang/Index/IndexSymbol.h>
+#include <clang/Lex/Lexer.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/Compression.h>
+#include <llvm/Support/Endian.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include "parallel_utils.hpp"
+#include "translation_unit_cache.hpp"
+
+namespace fs = std::filesystem;
+using clang::index::SymbolKind;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private data types
+// --------------------------------------------------------------------------------------------------------------------
+namespace
+{
+
+//! The raw 8 bytes of the clangd symbol id, taken as a number, since they are only compared.
+using SymbolId = std::uint64_t;
+
+//! As the RelationKind of clangd.
+enum class RelationKind : std::uint8_t
+{
+    base_of,
+    overridden_by
+};
+
+//! The beginning of a symbol; both the line and the column are 0-based, as within clangd.
+struct SymbolLocation
+{
+    fs::path file;
+    unsigned line;
+    unsigned column;
+};
+
+//! Only the classes, and the member functions, are kept, since only they are queried.
+struct IndexedSymbol
+{
+    SymbolId id;
+    SymbolKind kind;
+    std::string name;
+    //! E.g. "Namespace::" for a class, or "Namespace::Class::" for its member function.
+    std::string scope;
+    std::optional<SymbolLocation> definition;
+    std::optional<SymbolLocation> declaration;
+};
+
+//! E.g. the subject is a base of the object.
+struct Relation
+{
+    SymbolId subject;
+    RelationKind kind;
+    SymbolId object;
+};
+
+struct ShardContent
+{
+    //! The file, which the shard is of; empty if not found within the shard.
+    fs::path file;
+    bool is_translation_unit{false};
+    std::vector<fs::path> direct_includes;
+    std::vector<IndexedSymbol> symbols;
+    std::vector<Relation> relations;
+};
+
+//! Reads the data laid out as by clangd: the little-endian integers, and the variable length ones.
+class ShardDataReader
+{
+  public:
+    explicit ShardDataReader(llvm::StringRef data) : data{data}
+    {
+    }
+
+    //! Once failed, e.g. on reading past the end, each next read fails as well, and gives zero.
+    bool has_failed() const
+    {
+        return failed;
+    }
+
+    bool is_at_end() const
+    {
+        return data.empty();
+    }
+
+    llvm::StringRef consume(std::size_t size)
+    {
+        if (failed or data.size() < size)
+        {
+            failed = true;
+            return {};
+        }
+        auto result{data.take_front(size)};
+        data = data.drop_front(size);
+        return result;
+    }
+
+    std::uint8_t consume8()
+    {
+        auto bytes{consume(1)};
+        return bytes.empty() ? 0 : static_cast<std::uint8_t>(bytes.front());
+    }
+
+    std::uint32_t consume32()
+    {
+        auto bytes{consume(4)};
+        return bytes.empty() ? 0 : llvm::support::endian::read32le(bytes.data());
+    }
+
+    SymbolId consume_id()
+    {
+        auto bytes{consume(8)};
+        return bytes.empty() ? 0 : llvm::support::endian::read64le(bytes.data());
+    }
+
+    //! 7 bits per byte, the least significant first; the highest bit tells whether more bytes follow.
+    std::uint32_t consume_var()
+    {
+        std::uint32_t result{0};
+        for (unsigned shift{0}; shift < 32 and not failed; shift += 7)
+        {
+            auto byte{consume8()};
+            result |= static_cast<std::uint32_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return result;
+        }
+        failed = true;
+        return 0;
+    }
+
+    llvm::StringRef consume_string(const std::vector<llvm::StringRef>& strings)
+    {
+        auto index{consume_var()};
+        if (failed or index >= strings.size())
+        {
+            failed = true;
+            return {};
+        }
+        return strings[index];
+    }
+
+  private:
+    llvm::StringRef data;
+    bool failed{false};
+};
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static constexpr char shard_file_extension[]{".idx"};
+
+//! The versions of the shard format, which are known to lay out the read data the same way.
+static constexpr std::uint32_t min_supported_format_version{17};
+static constexpr std::uint32_t max_supported_format_version{20};
+
+//! Returns nullopt if the shard cannot be read, or is of an unsupported version.
+static std::optional<ShardContent> read_shard(const fs::path&);
+
+//! Splits the RIFF container into the chunks, keyed by their ids, e.g. "symb" for the symbols.
+static std::optional<std::map<llvm::StringRef, llvm::StringRef>> read_chunks(llvm::StringRef);
+
+//! The strings are kept within the storage, and referred to with the indices of the strings by the other chunks.
+static bool read_string_table(llvm::StringRef chunk, std::string& storage, std::vector<llvm::StringRef>& strings);
+
+static bool read_symbols(llvm::StringRef chunk, const std::vector<llvm::StringRef>& strings, ShardContent&);
+static bool read_relations(llvm::StringRef chunk, ShardContent&);
+static bool read_include_graph(llvm::StringRef chunk,
+                               const std::vector<llvm::StringRef>& strings,
+                               const fs::path& shard_path,
+                               ShardContent&);
+
+static std::optional<SymbolLocation> read_location(ShardDataReader&, const std::vector<llvm::StringRef>& strings);
+static std::optional<fs::path> get_path_from_uri(llvm::StringRef uri);
+
+static bool is_class(const IndexedSymbol&);
+static bool is_member_function(const IndexedSymbol&);
+static std::string get_qualified_name(const IndexedSymbol&);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe
+{
+
+struct ClangdIndex::Shard
+{
+    fs::file_time_type write_time;
+    ShardContent content;
+};
+
+//! Makes the class index out of the fresh shards.
+struct ClangdClassIndexMaker
+{
+    ClangdClassIndexMaker(const std::vector<const ShardContent*>& shards, const fs::path& root_directory) :
+        shards{shards},
+        root_directory{root_directory}
+    {
+        // A symbol may be present within many shards, e.g. the declaration of a class within its header, and the
+        // definition within the source file.
+        for (const auto& shard : shards)
+            for (const auto& symbol : shard->symbols)
+            {
+                auto [it, is_inserted]{symbols.try_emplace(symbol.id, &symbol)};
+                if (not is_inserted and not it->second->definition and symbol.definition)
+                    it->second = &symbol;
+            }
+
+        for (const auto& [id, symbol] : symbols)
+            if (is_class(*symbol))
+                class_ids_by_member_scope.try_emplace(get_qualified_name(*symbol) + "::", id);
+
+        for (const auto& shard : shards)
+            for (const auto& relation : shard->relations)
+            {
+                auto& related_ids{relation.kind == RelationKind::base_of ? base_ids[relation.object]
+                                                                         : overrider_ids[relation.subject]};
+                auto related_id{relation.kind == RelationKind::base_of ? relation.subject : relation.object};
+                if (std::ranges::find(related_ids, related_id) == std::end(related_ids))
+                    related_ids.push_back(related_id);
+            }
+
+        for (const auto& [id, symbol] : symbols)
+            if (is_member_function(*symbol))
+                if (auto it{class_ids_by_member_scope.find(symbol->scope)}; it != std::end(class_ids_by_member_scope))
+                {
+                    class_ids_by_function_id.emplace(id, it->second);
+                    auto is_pure{is_pure_virtual(*symbol)};
+                    if (not is_pure)
+                        has_undecidable_functions = true;
+                    else if (*is_pure)
+                        pure_function_ids[it->second].push_back(id);
+                }
+    }
+
+    //! Returns nullopt, if the pure virtual functions cannot be told, so that the classes are indexed otherwise.
+    std::optional<ClassIndex> make()
+    {
+        if (has_undecidable_functions)
+            return std::nullopt;
+
+        ClassIndex result;
+        for (const auto& [id, symbol] : symbols)
+        {
+            if (not is_class(*symbol) or not symbol->definition
+                or not is_within_directory(symbol->definition->file, root_directory))
+                continue;
+
+            IndexedClass indexed_class{.qualified_name = get_qualified_name(*symbol),
+                                       .location = {.file = symbol->definition->file,
+                                                    .line = symbol->definition->line + 1},
+                                       .is_abstract = not find_unresolved_pure_functions(id).empty()};
+            if (auto it{base_ids.find(id)}; it != std::end(base_ids))
+                for (auto base_id : it->second)
+                    if (auto base_it{symbols.find(base_id)}; base_it != std::end(symbols))
+                        indexed_class.bases.push_back(get_qualified_name(*base_it->second));
+            result.classes.push_back(std::move(indexed_class));
+        }
+        std::ranges::sort(result.classes);
+
+        for (const auto& shard : shards)
+            if (shard->is_translation_unit and is_within_directory(shard->file, root_directory))
+                result.translation_unit_files.emplace(shard->file.string(), find_included_project_files(shard->file));
+        return result;
+    }
+
+  private:
+    //! The pure virtual functions of the class, and of its bases, which are not overridden; none for a concrete class.
+    const std::vector<SymbolId>& find_unresolved_pure_functions(SymbolId class_id)
+    {
+        if (auto it{unresolved_pure_function_ids.find(class_id)}; it != std::end(unresolved_pure_function_ids))
+            return it->second;
+
+        std::vector<SymbolId> result;
+        if (auto it{pure_function_ids.find(class_id)}; it != std::end(pure_function_ids))
+            result = it->second;
+
+        // Guards against a cyclic inheritance, which clangd may record for the broken code.
+        if (visited_class_ids.insert(class_id).second)
+            if (auto it{base_ids.find(class_id)}; it != std::end(base_ids))
+                for (auto base_id : it->second)
+                    for (auto function_id : find_unresolved_pure_functions(base_id))
+                        if (not is_overridden_within(function_id, class_id))
+                            result.push_back(function_id);
+
+        // The references to the elements of the unordered map stay valid, when more elements are inserted.
+        return unresolved_pure_function_ids[class_id] = std::move(result);
+    }
+
+    bool is_overridden_within(SymbolId function_id, SymbolId class_id) const
+    {
+        auto it{overrider_ids.find(function_id)};
+        if (it == std::end(overrider_ids))
+            return false;
+        return std::ranges::any_of(it->second, [&](SymbolId overrider_id) {
+            auto class_it{class_ids_by_function_id.find(overrider_id)};
+            return class_it != std::end(class_ids_by_function_id) and class_it->second == class_id;
+        });
+    }
+
+    /**
+     * The index does not tell the pure virtual functions, thus the canonical declaration is lexed, from the name of the
+     * function up to its end, and the pure specifier is looked for at the end; the comments, and the line breaks, are
+     * skipped by the lexer. The function defined where it is declared is not pure, but a pure one may be defined out
+     * of line. Returns nullopt, when the declaration is not spelled within the file, e.g. is expanded from a macro.
+     */
+    std::optional<bool> is_pure_virtual(const IndexedSymbol& function)
+    {
+        if (not function.declaration or not is_within_directory(function.declaration->file, root_directory))
+            return false;
+        const auto& declaration_location{*function.declaration};
+        if (function.definition and function.definition->file == declaration_location.file
+            and function.definition->line == declaration_location.line
+            and function.definition->column == declaration_location.column)
+            return false;
+
+        const auto& lines{get_file_lines(declaration_location.file)};
+        if (declaration_location.line >= lines.size())
+            return std::nullopt;
+
+        // The columns count the UTF-16 code units, which are the bytes for the ASCII code.
+        auto line{lines[declaration_location.line]};
+        if (declaration_location.column >= line.size())
+            return std::nullopt;
+        auto declaration{line.substr(declaration_location.column)};
+
+        // A raw lexer needs no source manager, nor preprocessor; it just splits the code into tokens.
+        clang::Lexer lexer{clang::SourceLocation{},
+                           lang_options,
+                           declaration.data(),
+                           declaration.data(),
+                           declaration.data() + declaration.size()};
+        clang::Token token;
+        lexer.LexFromRawLexer(token);
+        if (not is_function_name_start(token, function.name))
+            return std::nullopt;
+
+        // The default arguments may contain the semicolons and the braces, e.g. within the lambdas.
+        unsigned nesting_depth{0};
+        clang::tok::TokenKind before_last_kind{clang::tok::unknown};
+        clang::Token last_token{token};
+        for (lexer.LexFromRawLexer(token); token.isNot(clang::tok::eof); lexer.LexFromRawLexer(token))
+        {
+            if (token.isOneOf(clang::tok::l_paren, clang::tok::l_square)
+                or (nesting_depth > 0 and token.is(clang::tok::l_brace)))
+                ++nesting_depth;
+            else if (token.isOneOf(clang::tok::r_paren, clang::tok::r_square, clang::tok::r_brace))
+            {
+                // The declaration is left, e.g. the name is an argument of a macro, which declares the function.
+                if (nesting_depth == 0)
+                    return std::nullopt;
+                --nesting_depth;
+            } else if (nesting_depth == 0 and token.isOneOf(clang::tok::semi, clang::tok::l_brace))
+                return token.is(clang::tok::semi) and before_last_kind == clang::tok::equal
+                       and last_token.is(clang::tok::numeric_constant)
+                       and llvm::StringRef{last_token.getLiteralData(), last_token.getLength()} == "0";
+
+            before_last_kind = last_token.getKind();
+            last_token = token;
+        }
+        return std::nullopt;
+    }
+
+    //! The declaration location of a destructor points at the tilde, and the one of an operator at the keyword.
+    static bool is_function_name_start(const clang::Token& token, std::string_view name)
+    {
+        if (name.starts_with("~"))
+            return token.is(clang::tok::tilde);
+        if (token.isNot(clang::tok::raw_identifier))
+            return false;
+        auto first_token{name.starts_with("operator") ? std::string_view{"operator"} : name};
+        return token.getRawIdentifier() == llvm::StringRef{first_token};
+    }
+
+    static clang::LangOptions make_lang_options()
+    {
+        clang::LangOptions result;
+        result.CPlusPlus = true;
+        result.CPlusPlus11 = true;
+        result.LineComment = true;
+        return result;
+    }
+
+    //! The views of the lines reach up to the end of the file, so that a declaration may span many lines.
+    const std::vector<std::string_view>& get_file_lines(const fs::path& path)
+    {
+        auto [it, is_inserted]{file_lines.try_emplace(path)};
+        if (not is_inserted)
+            return it->second;
+
+        auto buffer{llvm::MemoryBuffer::getFile(path.string())};
+        if (not buffer)
+            return it->second;
+
+        std::string_view content{(*buffer)->getBufferStart(), (*buffer)->getBufferSize()};
+        for (std::size_t offset{0}; offset <= content.size();)
+        {
+            it->second.push_back(content.substr(offset));
+            auto newline{content.find('\n', offset)};
+            if (newline == std::string_view::npos)
+                break;
+            offset = newline + 1;
+        }
+        file_buffers.push_back(std::move(*buffer));
+        return it->second;
+    }
+
+    std::vector<fs::path> find_included_project_files(const fs::path& translation_unit)
+    {
+        if (direct_includes.empty())
+            for (const auto& shard : shards)
+                direct_includes.emplace(shard->file, &shard->direct_includes);
+
+        std::vector<fs::path> result{translation_unit};
+        std::set<fs::path> visited{translation_unit};
+        for (std::size_t i{0}; i < result.size(); ++i)
+        {
+            auto it{direct_includes.find(result[i])};
+            if (it == std::end(direct_includes))
+                continue;
+            for (const auto& include : *it->second)
+                if (is_within_directory(include, root_directory) and visited.insert(include).second)
+                    result.push_back(include);
+        }
+        return result;
+    }
+
+    const std::vector<const ShardContent*>& shards;
+    const fs::path& root_directory;
+
+    std::unordered_map<SymbolId, const IndexedSymbol*> symbols;
+    std::unordered_map<std::string, SymbolId> class_ids_by_member_scope;
+    std::unordered_map<SymbolId, SymbolId> class_ids_by_function_id;
+    std::unordered_map<SymbolId, std::vector<SymbolId>> base_ids;
+    std::unordered_map<SymbolId, std::vector<SymbolId>> overrider_ids;
+    std::unordered_map<SymbolId, std::vector<SymbolId>> pure_function_ids;
+    std::unordered_map<SymbolId, std::vector<SymbolId>> unresolved_pure_function_ids;
+    std::set<SymbolId> visited_class_ids;
+    //! Set when a member function declaration is not lexed to its end; the pure virtual functions are unknown then.
+    bool has_undecidable_functions{false};
+
+    const clang::LangOptions lang_options{make_lang_options()};
+
+    std::map<fs::path, std::vector<std::string_view>> file_lines;
+    std::vector<std::unique_ptr<llvm::MemoryBuffer>> file_buffers;
+    std::map<fs::path, const std::vector<fs::path>*> direct_includes;
+};
+
+} // namespace Tsepepe
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+fs::path Tsepepe::get_default_clangd_index_directory(const fs::path& root_directory)
+{
+    return root_directory / ".cache" / "clangd" / "index";
+}
+
+Tsepepe::ClangdIndex::ClangdIndex(std::shared_ptr<clang::tooling::CompilationDatabase> comp_db,
+                                  fs::path root_directory_,
+                                  fs::path index_directory_) :
+    compilation_database{std::move(comp_db)},
+    // Compared with the paths from the shards, which are the real ones.
+    root_directory{fs::weakly_canonical(fs::absolute(root_directory_))},
+    index_directory{index_directory_.empty() ? get_default_clangd_index_directory(root_directory)
+                                             : std::move(index_directory_)}
+{
+}
+
+std::optional<Tsepepe::ClassIndex> Tsepepe::ClangdIndex::get_class_index()
+{
+    auto shards{read_fresh_shards()};
+    if (not shards)
+        return std::nullopt;
+
+    std::vector<const ShardContent*> shard_contents;
+    shard_contents.reserve(shards->size());
+    for (const auto& shard : *shards)
+        shard_contents.push_back(&shard->content);
+    return ClangdClassIndexMaker{shard_contents, root_directory}.make();
+}
+
+std::optional<std::vector<fs::path>>
+Tsepepe::ClangdIndex::find_class_definition_files(const std::vector<std::string>& bare_names)
+{
+    auto shards{read_fresh_shards()};
+    if (not shards)
+        return std::nullopt;
+
+    std::vector<fs::path> result;
+    for (const auto& bare_name : bare_names)
+    {
+        bool is_found{false};
+        for (const auto& shard : *shards)
+            for (const auto& symbol : shard->content.symbols)
+                if (is_class(symbol) and symbol.name == bare_name and symbol.definition
+                    and is_within_directory(symbol.definition->file, root_directory))
+                {
+                    is_found = true;
+                    if (std::ranges::find(result, symbol.definition->file) == std::end(result))
+                        result.push_back(symbol.definition->file);
+                }
+        if (not is_found)
+            return std::nullopt;
+    }
+    return result;
+}
+
+std::optional<std::vector<std::shared_ptr<const Tsepepe::ClangdIndex::Shard>>> Tsepepe::ClangdIndex::read_fresh_shards()
+{
+    std::error_code error_code;
+    std::vector<std::pair<fs::path, fs::file_time_type>> shard_files;
+    for (const auto& entry : fs::directory_iterator{index_directory, error_code})
+        if (entry.path().extension() == shard_file_extension)
+            if (auto write_time{entry.last_write_time(error_code)}; not error_code)
+                shard_files.emplace_back(entry.path(), write_time);
+    if (error_code or shard_files.empty())
+        return std::nullopt;
+    std::ranges::sort(shard_files);
+
+    std::vector<std::shared_ptr<const Shard>> shards(shard_files.size());
+    {
+        std::lock_guard lock{read_shards_mutex};
+        std::vector<std::size_t> changed_shard_indices;
+        for (std::size_t i{0}; i < shard_files.size(); ++i)
+            if (auto it{read_shards.find(shard_files[i].first)};
+                it != std::end(read_shards) and it->second->write_time == shard_files[i].second)
+                shards[i] = it->second;
+            else
+                changed_shard_indices.push_back(i);
+
+        utils::parallel_for(changed_shard_indices.size(), [&](std::size_t index) {
+            const auto& [path, write_time]{shard_files[changed_shard_indices[index]]};
+            if (auto content{read_shard(path)}; content)
+                shards[changed_shard_indices[index]] =
+                    std::make_shared<const Shard>(Shard{.write_time = write_time, .content = std::move(*content)});
+        });
+
+        // The shards, which are gone, are forgotten; the unreadable ones are read again on the next call.
+        read_shards.clear();
+        for (std::size_t i{0}; i < shard_files.size(); ++i)
+            if (shards[i] != nullptr)
+                read_shards.emplace(shard_files[i].first, shards[i]);
+    }
+
+    if (std::ranges::find(shards, nullptr) != std::end(shards))
+        return std::nullopt;
+
+    // Clangd never removes the shards of the removed files, thus these are left out, rather than taken as stale.
+    std::set<fs::path> indexed_translation_units;
+    std::vector<std::shared_ptr<const Shard>> result;
+    result.reserve(shards.size());
+    for (auto& shard : shards)
+    {
+        if (shard->content.file.empty())
+            continue;
+        auto file_write_time{fs::last_write_time(shard->content.file, error_code)};
+        if (error_code)
+            continue;
+        if (file_write_time > shard->write_time)
+            return std::nullopt;
+        if (shard->content.is_translation_unit)
+            indexed_translation_units.insert(shard->content.file);
+        result.push_back(std::move(shard));
+    }
+
+    for (const auto& translation_unit : compilation_database->getAllFiles())
+    {
+        auto path{fs::weakly_canonical(translation_unit, error_code)};
+        if (error_code or not is_within_directory(path, root_directory))
+            continue;
+        if (not indexed_translation_units.contains(path))
+            return std::nullopt;
+    }
+    return result;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static std::optional<ShardContent> read_shard(const fs::path& shard_path)
+{
+    auto buffer{llvm::MemoryBuffer::getFile(shard_path.string())};
+    if (not buffer)
+        return std::nullopt;
+
+    auto chunks{read_chunks((*buffer)->getBuffer())};
+    if (not chunks)
+        return std::nullopt;
+
+    auto get_chunk{[&](llvm::StringRef id) -> std::optional<llvm::StringRef> {
+        if (auto it{chunks->find(id)}; it != std::end(*chunks))
+            return it->second;
+        return std::nullopt;
+    }};
+
+    auto meta{get_chunk("meta")};
+    if (not meta)
+        return std::nullopt;
+    ShardDataReader meta_reader{*meta};
+    auto format_version{meta_reader.consume32()};
+    if (meta_reader.has_failed() or format_version < min_supported_format_version
+        or format_version > max_supported_format_version)
+        return std::nullopt;
+
+    auto string_table{get_chunk("stri")};
+    std::string string_storage;
+    std::vector<llvm::StringRef> strings;
+    if (not string_table or not read_string_table(*string_table, string_storage, strings))
+        return std::nullopt;
+
+    // Each chunk is optional, e.g. there are no relations within the shard of a file without any class.
+    ShardContent result;
+    if (auto symbols{get_chunk("symb")}; symbols and not read_symbols(*symbols, strings, result))
+        return std::nullopt;
+    if (auto relations{get_chunk("rela")}; relations and not read_relations(*relations, result))
+        return std::nullopt;
+    if (auto include_graph{get_chunk("srcs")};
+        include_graph and not read_include_graph(*include_graph, strings, shard_path, result))
+        return std::nullopt;
+    return result;
+}
+
+static std::optional<std::map<llvm::StringRef, llvm::StringRef>> read_chunks(llvm::StringRef file)
+{
+    ShardDataReader reader{file};
+    if (reader.consume(4) != "RIFF")
+        return std::nullopt;
+    auto riff_size{reader.consume32()};
+    if (reader.has_failed() or riff_size > file.size() - 8)
+        return std::nullopt;
+
+    ShardDataReader chunks_reader{file.substr(8, riff_size)};
+    if (chunks_reader.consume(4) != "CdIx")
+        return std::nullopt;
+
+    std::map<llvm::StringRef, llvm::StringRef> result;
+    while (not chunks_reader.is_at_end())
+    {
+        auto id{chunks_reader.consume(4)};
+        auto size{chunks_reader.consume32()};
+        auto data{chunks_reader.consume(size)};
+        // Each chunk is padded to the even size.
+        if (size % 2 != 0 and not chunks_reader.is_at_end())
+            chunks_reader.consume(1);
+        if (chunks_reader.has_failed())
+            return std::nullopt;
+        result.emplace(id, data);
+    }
+    return result;
+}
+
+static bool read_string_table(llvm::StringRef chunk, std::string& storage, std::vector<llvm::StringRef>& strings)
+{
+    ShardDataReader reader{chunk};
+    auto uncompressed_size{reader.consume32()};
+    if (reader.has_failed())
+        return false;
+
+    // The table is stored as it is, when the size is zero; compressed with zlib otherwise.
+    auto table{chunk.drop_front(4)};
+    if (uncompressed_size == 0)
+    {
+        storage = table.str();
+    } else
+    {
+#if LLVM_VERSION_MAJOR >= 15
+        llvm::SmallVector<std::uint8_t, 0> uncompressed;
+        if (not llvm::compression::zlib::isAvailable())
+            return false;
+        if (auto error{llvm::compression::zlib::decompress(
+                llvm::arrayRefFromStringRef(table), uncompressed, uncompressed_size)})
+#else
+        llvm::SmallVector<char, 0> uncompressed;
+        if (not llvm::zlib::isAvailable())
+            return false;
+        if (auto error{llvm::zlib::uncompress(table, uncompressed, uncompressed_size)})
+#endif
+        {
+            llvm::consumeError(std::move(error));
+            return false;
+        }
+        storage.assign(std::begin(uncompressed), std::end(uncompressed));
+    }
+
+    // Each string is null terminated.
+    llvm::StringRef rest{storage};
+    while (not rest.empty())
+    {
+        auto length{rest.find('\0')};
+        if (length == llvm::StringRef::npos)
+            return false;
+        strings.push_back(rest.take_front(length));
+        rest = rest.drop_front(length + 1);
+    }
+    return true;
+}
+
+static bool read_symbols(llvm::StringRef chunk, const std::vector<llvm::StringRef>& strings, ShardContent& result)
+{
+    ShardDataReader reader{chunk};
+    while (not reader.is_at_end() and not reader.has_failed())
+    {
+        IndexedSymbol symbol{.id = reader.consume_id(), .kind = static_cast<SymbolKind>(reader.consume8())};
+        reader.consume8(); // The language.
+        symbol.name = reader.consume_string(strings).str();
+        symbol.scope = reader.consume_string(strings).str();
+        auto template_specialization_arguments{reader.consume_string(strings)};
+        symbol.definition = read_location(reader, strings);
+        symbol.declaration = read_location(reader, strings);
+        reader.consume_var(); // The references count.
+        reader.consume8();    // The flags.
+
+        // The signature, the completion snippet suffix, the documentation, the return type, and the type.
+        for (int i{0}; i < 5; ++i)
+            reader.consume_string(strings);
+
+        // Each include header, with its references count, and the supported directives.
+        auto include_headers_count{reader.consume_var()};
+        for (std::uint32_t i{0}; i < include_headers_count and not reader.has_failed(); ++i)
+        {
+            reader.consume_string(strings);
+            reader.consume_var();
+        }
+
+        // The specializations are not indexed, as by the ClassIndexerLibclangBased.
+        if ((is_class(symbol) or is_member_function(symbol)) and template_specialization_arguments.empty())
+            result.symbols.push_back(std::move(symbol));
+    }
+    return not reader.has_failed();
+}
+
+static bool read_relations(llvm::StringRef chunk, ShardContent& result)
+{
+    ShardDataReader reader{chunk};
+    while (not reader.is_at_end() and not reader.has_failed())
+    {
+        Relation relation{.subject = reader.consume_id()};
+        auto kind{reader.consume8()};
+        relation.object = reader.consume_id();
+        if (kind == static_cast<std::uint8_t>(RelationKind::base_of)
+            or kind == static_cast<std::uint8_t>(RelationKind::overridden_by))
+        {
+            relation.kind = static_cast<RelationKind>(kind);
+            result.relations.push_back(relation);
+        }
+    }
+    return not reader.has_failed();
+}
+
+static bool read_include_graph(llvm::StringRef chunk,
+                               const std::vector<llvm::StringRef>& strings,
+                               const fs::path& shard_path,
+                               ShardContent& result)
+{
+    static constexpr std::uint8_t is_translation_unit_flag{1};
+    static constexpr std::size_t digest_size{8};
+
+    // The shard is named after its file, e.g. "file.cpp.<HASH OF THE PATH>.idx".
+    auto file_name{shard_path.stem().stem()};
+
+    // Holds the node of the file, and the nodes of its direct includes, which have only the paths set.
+    ShardDataReader reader{chunk};
+    bool is_digest_found{false};
+    while (not reader.is_at_end() and not reader.has_failed())
+    {
+        auto flags{reader.consume8()};
+        auto digest{reader.consume(digest_size)};
+        auto path{get_path_from_uri(reader.consume_string(strings))};
+
+        std::vector<fs::path> direct_includes;
+        auto direct_includes_count{reader.consume_var()};
+        for (std::uint32_t i{0}; i < direct_includes_count and not reader.has_failed(); ++i)
+            if (auto include{get_path_from_uri(reader.consume_string(strings))}; include)
+                direct_includes.push_back(std::move(*include));
+
+        if (not path or path->filename() != file_name)
+            continue;
+        bool has_digest{std::ranges::any_of(digest, [](char byte) { return byte != 0; })};
+        if (not result.file.empty() and (is_digest_found or not has_digest))
+            continue;
+
+        result.file = std::move(*path);
+        result.is_translation_unit = (flags & is_translation_unit_flag) != 0;
+        result.direct_includes = std::move(direct_includes);
+        is_digest_found = has_digest;
+    }
+    return not reader.has_failed();
+}
+
+static std::optional<SymbolLocation> read_location(ShardDataReader& reader, const std::vector<llvm::StringRef>& strings)
+{
+    auto uri{reader.consume_string(strings)};
+    auto line{reader.consume_var()};
+    auto column{reader.consume_var()};
+    // The end of the symbol name.
+    reader.consume_var();
+    reader.consume_var();
+
+    auto path{get_path_from_uri(uri)};
+    if (not path)
+        return std::nullopt;
+    return SymbolLocation{.file = std::move(*path), .line = line, .column = column};
+}
+
+static std::optional<fs::path> get_path_from_uri(llvm::StringRef uri)
+{
+    if (not uri.consume_front("file://"))
+        return std::nullopt;
+
+    std::string path;
+    path.reserve(uri.size());
+    for (std::size_t i{0}; i < uri.size(); ++i)
+        if (uri[i] == '%' and i + 2 < uri.size() and llvm::isHexDigit(uri[i + 1]) and llvm::isHexDigit(uri[i + 2]))
+        {
+            path += static_cast<char>(llvm::hexFromNibbles(uri[i + 1], uri[i + 2]));
+            i += 2;
+        } else
+        {
+            path += uri[i];
+        }
+    return fs::path{path}.lexically_normal();
+}
+
+static bool is_class(const IndexedSymbol& symbol)
+{
+    return symbol.kind == SymbolKind::Class or symbol.kind == SymbolKind::Struct;
+}
+
+static bool is_member_function(const IndexedSymbol& symbol)
+{
+    return symbol.kind == SymbolKind::InstanceMethod or symbol.kind == SymbolKind::Destructor
+           or symbol.kind == SymbolKind::ConversionFunction;
+}
+
+static std::string get_qualified_name(const IndexedSymbol& symbol)
+{
+    return symbol.scope + symbol.name;
+}
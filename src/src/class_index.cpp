@@ -0,0 +1,370 @@
+/**
+ * @file	class_index.cpp
+ * @brief	Implements the class indexer.
+ */
+#include "class_index.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <clang/AST/DeclCXX.h>
+#include <clang/AST/DeclTemplate.h>
+#include <clang/ASTMatchers/ASTMatchFinder.h>
+#include <clang/ASTMatchers/ASTMatchers.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Tooling/Tooling.h>
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/xxhash.h>
+
+#include "index_segment.hpp"
+#include "parallel_utils.hpp"
+#include "translation_unit_cache.hpp"
+
+#include "libclang_utils/misc_utils.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang;
+using namespace clang::tooling;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private data types
+// --------------------------------------------------------------------------------------------------------------------
+namespace
+{
+
+struct TranslationUnitRecord
+{
+    Tsepepe::TranslationUnitFingerprint fingerprint;
+    std::vector<Tsepepe::IndexedClass> classes;
+};
+
+using TranslationUnitRecords = std::map<std::string, TranslationUnitRecord>;
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+//! Bump it whenever the cached data layout, or the way it is produced, changes.
+static constexpr std::int64_t cache_format_version{1};
+static constexpr const char* cache_file_name{"class_index.json"};
+
+static fs::path get_cache_file_name(const Tsepepe::ClassIndexingParameters&);
+
+static std::optional<std::string> get_base_qualified_name(const CXXBaseSpecifier&);
+
+static llvm::json::Value to_json(const TranslationUnitRecord&);
+static std::optional<TranslationUnitRecord> translation_unit_record_from_json(const llvm::json::Object&);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe
+{
+
+struct ClassIndexerLibclangBasedImpl
+{
+    explicit ClassIndexerLibclangBasedImpl(std::shared_ptr<CompilationDatabase> comp_db,
+                                           ClassIndexingParameters params) :
+        compilation_database{std::move(comp_db)},
+        parameters{std::move(params)},
+        root_directory{fs::weakly_canonical(fs::absolute(parameters.root_directory))},
+        cache_file_path{parameters.cache_directory / get_cache_file_name(parameters)}
+    {
+        if (not parameters.shard_directory.empty())
+            shard_directory = fs::weakly_canonical(fs::absolute(parameters.shard_directory));
+        for (const auto& excluded_directory : parameters.excluded_directories)
+            excluded_directories.push_back(fs::weakly_canonical(fs::absolute(excluded_directory)));
+    }
+
+    ClassIndex index()
+    {
+        // A single process at a time scans; the others wait, and then find its results cached.
+        std::optional<IndexWriterLock> writer_lock;
+        if (not parameters.cache_directory.empty())
+            writer_lock.emplace(fs::path{cache_file_path}.concat(".lock"));
+
+        auto cached_records{load_cache()};
+        auto current_file_hashes{hash_cached_dependencies(cached_records)};
+
+        auto translation_units{compilation_database->getAllFiles()};
+        std::erase_if(translation_units, [&](const std::string& translation_unit) {
+            return not is_within_shard(translation_unit);
+        });
+        std::vector<TranslationUnitRecord> records(translation_units.size());
+        utils::parallel_for(translation_units.size(), [&](std::size_t index) {
+            const auto& translation_unit{translation_units[index]};
+            auto compile_command_hash{hash_compile_commands(*compilation_database, translation_unit)};
+            if (auto it{cached_records.find(translation_unit)};
+                it != std::end(cached_records)
+                and is_up_to_date(it->second.fingerprint, compile_command_hash, current_file_hashes))
+                records[index] = std::move(it->second);
+            else
+                records[index] = scan(translation_unit, compile_command_hash);
+        });
+
+        store_cache(translation_units, records);
+        return make_index(translation_units, records);
+    }
+
+  private:
+    //! The paths from the compilation database are taken as they are, since there may be plenty of them.
+    bool is_within_shard(const std::string& translation_unit) const
+    {
+        auto path{fs::path{translation_unit}.lexically_normal()};
+        if (not shard_directory.empty() and not is_within_directory(path, shard_directory))
+            return false;
+        return std::ranges::none_of(excluded_directories, [&](const fs::path& excluded_directory) {
+            return is_within_directory(path, excluded_directory);
+        });
+    }
+
+    TranslationUnitRecord scan(const std::string& translation_unit, std::uint64_t compile_command_hash) const
+    {
+        std::vector<std::unique_ptr<ASTUnit>> ast_units;
+        auto tool{make_clang_tool(*compilation_database, {translation_unit})};
+        tool.buildASTs(ast_units);
+        if (ast_units.empty() or ast_units.back() == nullptr)
+            return {};
+
+        auto& ast_unit{*ast_units.back()};
+        const auto& source_manager{ast_unit.getSourceManager()};
+
+        TranslationUnitRecord result{
+            .fingerprint = fingerprint_translation_unit(source_manager, compile_command_hash, root_directory)};
+
+        // Resolving the real path of a file is not for free, so it is done once per file.
+        llvm::DenseMap<FileID, std::optional<fs::path>> project_files;
+        auto get_project_file{[&](SourceLocation location) -> std::optional<fs::path> {
+            auto expansion_location{source_manager.getExpansionLoc(location)};
+            auto [it, is_inserted]{project_files.try_emplace(source_manager.getFileID(expansion_location))};
+            if (is_inserted)
+                if (auto path{get_absolute_file_path(expansion_location, source_manager)};
+                    not path.empty() and is_within_directory(path, root_directory))
+                    it->second = std::move(path);
+            return it->second;
+        }};
+
+        using namespace ast_matchers;
+        auto matcher{cxxRecordDecl(isDefinition(),
+                                   unless(isExpansionInSystemHeader()),
+                                   unless(isImplicit()),
+                                   unless(isLambda()),
+                                   unless(isUnion()),
+                                   unless(isTemplateInstantiation()))
+                         .bind("class")};
+        for (const auto& match : ast_matchers::match(matcher, ast_unit.getASTContext()))
+        {
+            auto node{match.getNodeAs<CXXRecordDecl>("class")};
+            if (node == nullptr or node->getIdentifier() == nullptr)
+                continue;
+
+            auto file{get_project_file(node->getLocation())};
+            if (not file)
+                continue;
+
+            IndexedClass indexed_class{
+                .qualified_name = node->getQualifiedNameAsString(),
+                .location = {.file = std::move(*file),
+                             .line = source_manager.getPresumedLineNumber(
+                                 source_manager.getExpansionLoc(node->getLocation()))},
+                .is_abstract = node->isAbstract()};
+            for (const auto& base : node->bases())
+                if (auto base_name{get_base_qualified_name(base)}; base_name)
+                    indexed_class.bases.emplace_back(std::move(*base_name));
+            result.classes.emplace_back(std::move(indexed_class));
+        }
+        return result;
+    }
+
+    static ClassIndex make_index(const std::vector<std::string>& translation_units,
+                                 std::vector<TranslationUnitRecord>& records)
+    {
+        ClassIndex result;
+        for (std::size_t i{0}; i < translation_units.size(); ++i)
+        {
+            auto& record{records[i]};
+            std::ranges::move(record.classes, std::back_inserter(result.classes));
+
+            auto& files{result.translation_unit_files[translation_units[i]]};
+            files.reserve(record.fingerprint.dependencies.size());
+            for (const auto& dependency : record.fingerprint.dependencies)
+                files.emplace_back(dependency.first);
+        }
+
+        // The classes from the headers are seen by many translation units.
+        auto is_same_class{[](const IndexedClass& lhs, const IndexedClass& rhs) {
+            return lhs.qualified_name == rhs.qualified_name and lhs.location == rhs.location;
+        }};
+        std::ranges::sort(result.classes);
+        auto duplicates{std::ranges::unique(result.classes, is_same_class)};
+        result.classes.erase(std::begin(duplicates), std::end(duplicates));
+        return result;
+    }
+
+    TranslationUnitRecords load_cache() const
+    {
+        TranslationUnitRecords result;
+        if (parameters.cache_directory.empty())
+            return result;
+
+        for (const auto& [translation_unit, value] :
+             load_translation_unit_cache(cache_file_path, cache_format_version))
+            if (auto object{value.getAsObject()}; object != nullptr)
+                if (auto record{translation_unit_record_from_json(*object)}; record)
+                    result.emplace(translation_unit.str(), std::move(*record));
+        return result;
+    }
+
+    void store_cache(const std::vector<std::string>& translation_units,
+                     const std::vector<TranslationUnitRecord>& records) const
+    {
+        if (parameters.cache_directory.empty())
+            return;
+
+        llvm::json::Object translation_units_json;
+        for (std::size_t i{0}; i < translation_units.size(); ++i)
+            if (records[i].fingerprint.compile_command_hash != 0)
+                translation_units_json[translation_units[i]] = to_json(records[i]);
+
+        store_translation_unit_cache(cache_file_path, cache_format_version, std::move(translation_units_json));
+    }
+
+    std::shared_ptr<CompilationDatabase> compilation_database;
+    ClassIndexingParameters parameters;
+    fs::path root_directory;
+    fs::path shard_directory;
+    std::vector<fs::path> excluded_directories;
+    fs::path cache_file_path;
+};
+
+} // namespace Tsepepe
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::ClassIndexerLibclangBased::ClassIndexerLibclangBased(
+    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db) :
+    compilation_database{std::move(comp_db)}
+{
+}
+
+Tsepepe::ClassIndex Tsepepe::ClassIndexerLibclangBased::index(ClassIndexingParameters params)
+{
+    return ClassIndexerLibclangBasedImpl{compilation_database, std::move(params)}.index();
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+//! Each shard has a cache file of its own, named after the directories which make it up.
+static fs::path get_cache_file_name(const Tsepepe::ClassIndexingParameters& parameters)
+{
+    if (parameters.shard_directory.empty() and parameters.excluded_directories.empty())
+        return cache_file_name;
+
+    auto root_directory{fs::weakly_canonical(fs::absolute(parameters.root_directory))};
+    auto get_relative_path{[&](const fs::path& directory) {
+        return fs::weakly_canonical(fs::absolute(directory)).lexically_relative(root_directory);
+    }};
+    std::string shard_key{
+        parameters.shard_directory.empty() ? std::string{} : get_relative_path(parameters.shard_directory).string()};
+    for (const auto& excluded_directory : parameters.excluded_directories)
+        shard_key += '\n' + get_relative_path(excluded_directory).string();
+    return "class_index." + llvm::utohexstr(llvm::xxHash64(shard_key)) + ".json";
+}
+
+static std::optional<std::string> get_base_qualified_name(const CXXBaseSpecifier& base)
+{
+    auto type{base.getType()};
+    if (auto record{type->getAsCXXRecordDecl()}; record != nullptr)
+        return record->getQualifiedNameAsString();
+
+    // A dependent base, e.g. 'Base<T>', has no record until instantiated, but its template is known.
+    if (auto specialization{type->getAs<TemplateSpecializationType>()}; specialization != nullptr)
+        if (auto template_decl{specialization->getTemplateName().getAsTemplateDecl()}; template_decl != nullptr)
+            return template_decl->getQualifiedNameAsString();
+
+    // E.g. a template parameter.
+    return std::nullopt;
+}
+
+static llvm::json::Value to_json(const Tsepepe::IndexedClass& indexed_class)
+{
+    llvm::json::Array bases;
+    for (const auto& base : indexed_class.bases)
+        bases.push_back(base);
+
+    return llvm::json::Object{{"qualified_name", indexed_class.qualified_name},
+                              {"file", indexed_class.location.file.string()},
+                              {"line", indexed_class.location.line},
+                              {"is_abstract", indexed_class.is_abstract},
+                              {"bases", std::move(bases)}};
+}
+
+static std::optional<Tsepepe::IndexedClass> indexed_class_from_json(const llvm::json::Value& value)
+{
+    auto object{value.getAsObject()};
+    if (object == nullptr)
+        return std::nullopt;
+
+    auto qualified_name{object->getString("qualified_name")};
+    auto file{object->getString("file")};
+    auto line{object->getInteger("line")};
+    auto is_abstract{object->getBoolean("is_abstract")};
+    auto bases{object->getArray("bases")};
+    if (not qualified_name or not file or not line or not is_abstract or bases == nullptr)
+        return std::nullopt;
+
+    Tsepepe::IndexedClass result{.qualified_name = qualified_name->str(),
+                                 .location = {.file = file->str(), .line = static_cast<unsigned>(*line)},
+                                 .is_abstract = *is_abstract};
+    for (const auto& base_value : *bases)
+    {
+        auto base{base_value.getAsString()};
+        if (not base)
+            return std::nullopt;
+        result.bases.emplace_back(base->str());
+    }
+    return result;
+}
+
+static llvm::json::Value to_json(const TranslationUnitRecord& record)
+{
+    llvm::json::Array classes;
+    for (const auto& indexed_class : record.classes)
+        classes.push_back(to_json(indexed_class));
+
+    llvm::json::Object result{{"classes", std::move(classes)}};
+    Tsepepe::add_to_json(record.fingerprint, result);
+    return result;
+}
+
+static std::optional<TranslationUnitRecord> translation_unit_record_from_json(const llvm::json::Object& object)
+{
+    auto fingerprint{Tsepepe::fingerprint_from_json(object)};
+    if (not fingerprint)
+        return std::nullopt;
+
+    auto classes{object.getArray("classes")};
+    if (classes == nullptr)
+        return std::nullopt;
+
+    TranslationUnitRecord result{.fingerprint = std::move(*fingerprint)};
+    for (const auto& value : *classes)
+    {
+        auto indexed_class{indexed_class_from_json(value)};
+        if (not indexed_class)
+            return std::nullopt;
+        result.classes.emplace_back(std::move(*indexed_class));
+    }
+    return result;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file	class_reporter.cpp
+ * @brief	Implements the ClassReporterLibclangBased.
+ */
+#include "class_reporter.hpp"
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <clang/AST/DeclCXX.h>
+#include <clang/ASTMatchers/ASTMatchFinder.h>
+#include <clang/ASTMatchers/ASTMatchers.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Tooling/Tooling.h>
+
+#include "base_error.hpp"
+#include "source_file_content.hpp"
+
+using namespace clang;
+using namespace clang::tooling;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe
+{
+
+class ClassReportCollector : public ast_matchers::MatchFinder::MatchCallback
+{
+  public:
+    ClassReportCollector(ClassReports& class_reports,
+                         std::string queried_class_name,
+                         std::string_view file_content,
+                         CodeGenerationCache* code_generation_cache) :
+        class_reports{class_reports},
+        queried_class_name{std::move(queried_class_name)},
+        file_content{file_content},
+        code_generation_cache{code_generation_cache}
+    {
+    }
+
+    void run(const ast_matchers::MatchFinder::MatchResult& result) override
+    {
+        auto node{result.Nodes.getNodeAs<CXXRecordDecl>("class")};
+        if (node == nullptr)
+            return;
+
+        const auto& source_manager{*result.SourceManager};
+
+        ClassReport report{.qualified_name = node->getQualifiedNameAsString(), .is_abstract = node->isAbstract()};
+
+        report.bases.reserve(node->getNumBases());
+        for (const auto& base : node->bases())
+        {
+            auto base_node{base.getType()->getAsCXXRecordDecl()};
+            report.bases.emplace_back(base_node != nullptr ? base_node->getQualifiedNameAsString()
+                                                           : base.getType().getAsString());
+        }
+
+        if (report.is_abstract)
+            report.pure_virtual_override_declarations = pure_virtual_functions_to_override_declarations(
+                node, report.qualified_name, source_manager, code_generation_cache);
+
+        report.suitable_public_method_place =
+            find_suitable_place_in_class_for_public_method(file_content, node, source_manager);
+
+        class_reports.insert_or_assign(queried_class_name, std::move(report));
+    }
+
+  private:
+    ClassReports& class_reports;
+    std::string queried_class_name;
+    std::string_view file_content;
+    CodeGenerationCache* code_generation_cache;
+};
+
+} // namespace Tsepepe
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::ClassReporterLibclangBased::ClassReporterLibclangBased(
+    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db, std::shared_ptr<CodeGenerationCache> cache) :
+    compilation_database{std::move(comp_db)}, code_generation_cache{std::move(cache)}
+{
+}
+
+Tsepepe::ClassReports Tsepepe::ClassReporterLibclangBased::report(ClassReportParameters params)
+{
+    if (params.class_names.empty())
+        throw BaseError{"No class name specified!"};
+
+    auto virtual_file_path{make_virtual_source_file_path(params.source_file_path, "class_report").string()};
+
+    std::vector<std::unique_ptr<ASTUnit>> ast_units;
+    ClangTool tool{*compilation_database, {virtual_file_path}};
+    tool.mapVirtualFile(virtual_file_path, params.source_file_content.get_ref());
+    tool.buildASTs(ast_units);
+    if (ast_units.empty() or ast_units.back() == nullptr)
+        throw BaseError{"Failed to parse the file: " + params.source_file_path.string()};
+
+    ClassReports result;
+
+    using namespace ast_matchers;
+    MatchFinder finder;
+    std::vector<std::unique_ptr<ClassReportCollector>> collectors;
+    collectors.reserve(params.class_names.size());
+    for (const auto& class_name : params.class_names)
+    {
+        collectors.emplace_back(std::make_unique<ClassReportCollector>(
+            result, class_name, params.source_file_content, code_generation_cache.get()));
+        finder.addMatcher(cxxRecordDecl(hasName(class_name), isDefinition(), isExpansionInMainFile()).bind("class"),
+                          collectors.back().get());
+    }
+
+    finder.matchAST(ast_units.back()->getASTContext());
+    return result;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file	code_formatter.cpp
+ * @brief	Implements the formatting of the generated code.
+ */
+#include "code_formatter.hpp"
+
+#include <clang/Format/Format.h>
+#include <clang/Tooling/Core/Replacement.h>
+#include <llvm/Support/Error.h>
+
+#include "base_error.hpp"
+#include "code_insertions_applier.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+std::string Tsepepe::format_code_ranges(std::string code,
+                                        const fs::path& file_path,
+                                        const std::vector<CodeRange>& ranges,
+                                        const CodeFormattingOptions& options)
+{
+    if (ranges.empty())
+        return code;
+
+    auto file_name{file_path.string()};
+    auto style{format::getStyle(options.style, file_name, options.fallback_style, code)};
+    if (not style)
+        throw BaseError{"Invalid code formatting style: " + options.style + ", " + llvm::toString(style.takeError())};
+
+    std::vector<tooling::Range> clang_ranges;
+    clang_ranges.reserve(ranges.size());
+    for (const auto& range : ranges)
+        clang_ranges.emplace_back(range.offset, range.length);
+
+    // Only the lines touching the ranges are reformatted; no replacement is made elsewhere.
+    auto replacements{format::reformat(*style, code, clang_ranges, file_name)};
+    if (replacements.empty())
+        return code;
+
+    auto formatted_code{tooling::applyAllReplacements(code, replacements)};
+    if (not formatted_code)
+        throw BaseError{"Failed to format: " + file_name + ", " + llvm::toString(formatted_code.takeError())};
+    return std::move(*formatted_code);
+}
+
+std::string Tsepepe::apply_and_format_insertions(std::string_view input,
+                                                 std::vector<CodeInsertionByOffset> insertions,
+                                                 const fs::path& file_path,
+                                                 const std::optional<CodeFormattingOptions>& formatting_options)
+{
+    if (not formatting_options)
+        return apply_insertions(input, std::move(insertions));
+
+    std::vector<CodeRange> inserted_ranges;
+    auto code{apply_insertions(input, std::move(insertions), inserted_ranges)};
+    return format_code_ranges(std::move(code), file_path, inserted_ranges, *formatting_options);
+}
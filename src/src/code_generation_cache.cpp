@@ -0,0 +1,283 @@
+/**
+ * @file	code_generation_cache.cpp
+ * @brief	Implements the CodeGenerationCache.
+ */
+#include "code_generation_cache.hpp"
+
+#include <algorithm>
+
+#include <clang/AST/RecursiveASTVisitor.h>
+#include <clang/AST/TypeLoc.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/xxhash.h>
+
+#include "index_segment.hpp"
+#include "translation_unit_cache.hpp"
+
+#include "libclang_utils/misc_utils.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static constexpr std::int64_t cache_format_version{1};
+static constexpr llvm::StringLiteral cache_records_key{"entries"};
+
+//! Everything, but the content hash, which is checked on the lookup.
+static std::string make_entry_key(const Tsepepe::CodeGenerationKey&);
+
+static FileID get_declaring_file_id(const Decl*, const SourceManager&);
+static std::uint64_t hash_files_content(std::vector<FileID>, const SourceManager&);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace
+{
+
+/**
+ * @brief Collects the files declaring the types spelled within the function signatures, since the generated code
+ * depends on them, too: e.g. a type moved to another namespace is printed with another qualifier.
+ */
+class ReferencedTypeFilesCollector : public RecursiveASTVisitor<ReferencedTypeFilesCollector>
+{
+  public:
+    ReferencedTypeFilesCollector(const SourceManager& source_manager, std::vector<FileID>& file_ids) :
+        source_manager{source_manager}, file_ids{file_ids}
+    {
+    }
+
+    void collect(const FunctionDecl* function_node)
+    {
+        if (auto type_source_info{function_node->getTypeSourceInfo()}; type_source_info != nullptr)
+            TraverseTypeLoc(type_source_info->getTypeLoc());
+    }
+
+    bool VisitTagTypeLoc(TagTypeLoc type_loc)
+    {
+        add(type_loc.getDecl());
+        return true;
+    }
+
+    bool VisitTypedefTypeLoc(TypedefTypeLoc type_loc)
+    {
+        add(type_loc.getTypedefNameDecl());
+        return true;
+    }
+
+    bool VisitUsingTypeLoc(UsingTypeLoc type_loc)
+    {
+        add(type_loc.getTypePtr()->getFoundDecl());
+        return true;
+    }
+
+    bool VisitTemplateSpecializationTypeLoc(TemplateSpecializationTypeLoc type_loc)
+    {
+        add(type_loc.getTypePtr()->getTemplateName().getAsTemplateDecl());
+        return true;
+    }
+
+  private:
+    void add(const Decl* node)
+    {
+        // E.g. the builtin types are declared nowhere.
+        if (node != nullptr and node->getLocation().isValid())
+            file_ids.push_back(get_declaring_file_id(node, source_manager));
+    }
+
+    const SourceManager& source_manager;
+    std::vector<FileID>& file_ids;
+};
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::CodeGenerationCache::CodeGenerationCache(fs::path cache_file_path_) :
+    cache_file_path{std::move(cache_file_path_)}
+{
+    auto records{load_cache_records(cache_file_path, cache_format_version, cache_records_key)};
+    for (const auto& [key, value] : records)
+    {
+        auto record{value.getAsObject()};
+        if (record == nullptr)
+            continue;
+
+        std::uint64_t content_hash;
+        auto content_hash_hex{record->getString("content_hash")};
+        auto code_json{record->getArray("code")};
+        if (not content_hash_hex or content_hash_hex->getAsInteger(16, content_hash) or code_json == nullptr)
+            continue;
+
+        std::vector<std::string> code;
+        code.reserve(code_json->size());
+        for (const auto& piece : *code_json)
+            if (auto piece_string{piece.getAsString()}; piece_string)
+                code.emplace_back(piece_string->str());
+        entries.insert_or_assign(key.str(), Entry{.content_hash = content_hash, .code = std::move(code)});
+    }
+}
+
+std::optional<std::vector<std::string>> Tsepepe::CodeGenerationCache::find(const CodeGenerationKey& key) const
+{
+    if (key.usr.empty())
+        return std::nullopt;
+
+    std::lock_guard lock{mutex};
+    auto it{entries.find(make_entry_key(key))};
+    if (it == std::end(entries) or it->second.content_hash != key.content_hash)
+        return std::nullopt;
+    return it->second.code;
+}
+
+void Tsepepe::CodeGenerationCache::insert(const CodeGenerationKey& key, std::vector<std::string> code)
+{
+    if (key.usr.empty())
+        return;
+
+    auto entry_key{make_entry_key(key)};
+    Entry entry{.content_hash = key.content_hash, .code = std::move(code)};
+
+    std::lock_guard lock{mutex};
+    if (not cache_file_path.empty())
+        inserted_entries.insert_or_assign(entry_key, entry);
+    entries.insert_or_assign(entry_key, std::move(entry));
+}
+
+std::size_t Tsepepe::CodeGenerationCache::size() const
+{
+    std::lock_guard lock{mutex};
+    return entries.size();
+}
+
+void Tsepepe::CodeGenerationCache::store()
+{
+    std::lock_guard lock{mutex};
+    if (cache_file_path.empty() or inserted_entries.empty())
+        return;
+
+    // The others may have stored their entries since the load; these are kept, unless replaced.
+    IndexWriterLock writer_lock{cache_file_path.string() + ".lock"};
+    auto records{load_cache_records(cache_file_path, cache_format_version, cache_records_key)};
+    for (const auto& inserted_entry : inserted_entries)
+    {
+        const auto& [content_hash, code] = inserted_entry.getValue();
+        llvm::json::Array code_json;
+        for (const auto& piece : code)
+            code_json.emplace_back(piece);
+        records[inserted_entry.getKey()] =
+            llvm::json::Object{{"content_hash", llvm::utohexstr(content_hash)}, {"code", std::move(code_json)}};
+    }
+    store_cache_records(cache_file_path, cache_format_version, cache_records_key, std::move(records));
+    inserted_entries.clear();
+}
+
+Tsepepe::CodeGenerationKey Tsepepe::make_override_declarations_key(const CXXRecordDecl* interface_node,
+                                                                   std::string implementor_fully_qualified_name,
+                                                                   const SourceManager& source_manager)
+{
+    // The overrides come from the whole hierarchy of the interface, and spell the types declared elsewhere.
+    std::vector<FileID> file_ids;
+    ReferencedTypeFilesCollector referenced_type_files_collector{source_manager, file_ids};
+    auto add_class{[&](const CXXRecordDecl* node) {
+        file_ids.push_back(get_declaring_file_id(node, source_manager));
+        for (auto method : node->methods())
+            if (method->isPure())
+                referenced_type_files_collector.collect(method);
+        return true;
+    }};
+    add_class(interface_node);
+    interface_node->forallBases(add_class);
+
+    return {.usr = generate_usr(interface_node),
+            .content_hash = hash_files_content(std::move(file_ids), source_manager),
+            .implementor_scope = std::move(implementor_fully_qualified_name)};
+}
+
+Tsepepe::CodeGenerationKey Tsepepe::make_function_declaration_key(const FunctionDecl* function_node,
+                                                                  const SourceManager& source_manager,
+                                                                  FullFunctionDeclarationExpanderOptions options)
+{
+    std::vector<FileID> file_ids{get_declaring_file_id(function_node, source_manager)};
+    ReferencedTypeFilesCollector{source_manager, file_ids}.collect(function_node);
+
+    auto packed_options{options.ignore_attribute_specifiers | (options.remove_scope_from_parameters << 1)};
+    return {.usr = generate_usr(function_node),
+            .content_hash = hash_files_content(std::move(file_ids), source_manager),
+            .expander_options = static_cast<unsigned>(packed_options)};
+}
+
+Tsepepe::OverrideDeclarations
+Tsepepe::pure_virtual_functions_to_override_declarations(const CXXRecordDecl* interface_node,
+                                                         std::string implementor_fully_qualified_name,
+                                                         const SourceManager& source_manager,
+                                                         CodeGenerationCache* cache)
+{
+    if (cache == nullptr)
+        return pure_virtual_functions_to_override_declarations(
+            interface_node, std::move(implementor_fully_qualified_name), source_manager);
+
+    auto key{make_override_declarations_key(interface_node, implementor_fully_qualified_name, source_manager)};
+    if (auto cached_declarations{cache->find(key)}; cached_declarations)
+        return std::move(*cached_declarations);
+
+    auto result{pure_virtual_functions_to_override_declarations(
+        interface_node, std::move(implementor_fully_qualified_name), source_manager)};
+    cache->insert(key, result);
+    return result;
+}
+
+std::string Tsepepe::fully_expand_function_declaration(const FunctionDecl* function_node,
+                                                       const SourceManager& source_manager,
+                                                       FullFunctionDeclarationExpanderOptions options,
+                                                       CodeGenerationCache* cache,
+                                                       AstPrintingMemo* printing_memo)
+{
+    if (cache == nullptr)
+        return fully_expand_function_declaration(function_node, source_manager, options, printing_memo);
+
+    auto key{make_function_declaration_key(function_node, source_manager, options)};
+    if (auto cached_declaration{cache->find(key)}; cached_declaration and cached_declaration->size() == 1)
+        return std::move(cached_declaration->front());
+
+    auto result{fully_expand_function_declaration(function_node, source_manager, options, printing_memo)};
+    cache->insert(key, {result});
+    return result;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static std::string make_entry_key(const Tsepepe::CodeGenerationKey& key)
+{
+    return key.usr + '\n' + key.implementor_scope + '\n' + std::to_string(key.expander_options);
+}
+
+static FileID get_declaring_file_id(const Decl* node, const SourceManager& source_manager)
+{
+    return source_manager.getFileID(source_manager.getSpellingLoc(node->getLocation()));
+}
+
+static std::uint64_t hash_files_content(std::vector<FileID> file_ids, const SourceManager& source_manager)
+{
+    std::sort(std::begin(file_ids), std::end(file_ids));
+    file_ids.erase(std::unique(std::begin(file_ids), std::end(file_ids)), std::end(file_ids));
+
+    // The buffers are in memory already, since the files have been parsed. The file IDs follow the include order of
+    // the parsed translation unit, so the hashes are sorted, to be the same across the translation units.
+    std::vector<std::uint64_t> file_hashes;
+    file_hashes.reserve(file_ids.size());
+    for (auto file_id : file_ids)
+        file_hashes.push_back(llvm::xxHash64(source_manager.getBufferData(file_id)));
+    std::sort(std::begin(file_hashes), std::end(file_hashes));
+    file_hashes.erase(std::unique(std::begin(file_hashes), std::end(file_hashes)), std::end(file_hashes));
+
+    std::string content_hashes;
+    for (auto file_hash : file_hashes)
+        content_hashes += llvm::utohexstr(file_hash) + '\n';
+    return llvm::xxHash64(content_hashes);
+}
@@ -5,6 +5,7 @@
 
 #include "code_insertions_applier.hpp"
 #include "base_error.hpp"
+#include "string_builder.hpp"
 
 #include <algorithm>
 #include <numeric>
@@ -18,12 +19,20 @@ using CodeInsertions = std::vector<Tsepepe::CodeInsertionByOffset>;
 // --------------------------------------------------------------------------------------------------------------------
 // Private declarations
 // --------------------------------------------------------------------------------------------------------------------
-static void validate_insertions_in_bounds(const std::string& input, const CodeInsertions&);
+static void validate_insertions_in_bounds(std::string_view input, const CodeInsertions&);
 
 // --------------------------------------------------------------------------------------------------------------------
 // Public stuff
 // --------------------------------------------------------------------------------------------------------------------
-std::string Tsepepe::apply_insertions(const std::string& input, std::vector<CodeInsertionByOffset> insertions)
+std::string Tsepepe::apply_insertions(std::string_view input, std::vector<CodeInsertionByOffset> insertions)
+{
+    std::vector<CodeRange> inserted_ranges;
+    return apply_insertions(input, std::move(insertions), inserted_ranges);
+}
+
+std::string Tsepepe::apply_insertions(std::string_view input,
+                                      std::vector<CodeInsertionByOffset> insertions,
+                                      std::vector<CodeRange>& inserted_ranges)
 {
     validate_insertions_in_bounds(input, insertions);
 
@@ -50,22 +59,25 @@ std::string Tsepepe::apply_insertions(const std::string& input, std::vector<Code
             return sum + insertion.code.size();
         })};
 
-    std::string result;
-    result.reserve(insertions_total_size + input.size());
+    StringBuilder result{insertions_total_size + input.size()};
+    inserted_ranges.clear();
+    inserted_ranges.reserve(insertions.size());
     for (unsigned i{0}; i < insertions.size(); ++i)
     {
-        result += chunks[i];
-        result += std::move(insertions[i].code);
+        result.append(chunks[i]);
+        auto offset{static_cast<unsigned>(result.size())};
+        result.append(insertions[i].code);
+        inserted_ranges.push_back({.offset = offset, .length = static_cast<unsigned>(insertions[i].code.size())});
     }
-    result += chunks.back();
+    result.append(chunks.back());
 
-    return result;
+    return result.take();
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 // Private definitions
 // --------------------------------------------------------------------------------------------------------------------
-static void validate_insertions_in_bounds(const std::string& input, const CodeInsertions& insertions)
+static void validate_insertions_in_bounds(std::string_view input, const CodeInsertions& insertions)
 {
     for (const auto& insertion : insertions)
         if (input.size() < insertion.offset)
@@ -0,0 +1,359 @@
+/**
+ * @file	declaration_drift_detector.cpp
+ * @brief	Implements the declaration drift detector.
+ */
+#include "declaration_drift_detector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <clang/AST/Decl.h>
+#include <clang/ASTMatchers/ASTMatchFinder.h>
+#include <clang/ASTMatchers/ASTMatchers.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Tooling/Tooling.h>
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/Support/JSON.h>
+
+#include "index_segment.hpp"
+#include "parallel_utils.hpp"
+#include "translation_unit_cache.hpp"
+
+#include "libclang_utils/full_function_declaration_expander.hpp"
+#include "libclang_utils/misc_utils.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang;
+using namespace clang::tooling;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private data types
+// --------------------------------------------------------------------------------------------------------------------
+namespace
+{
+
+struct FunctionRecord
+{
+    std::string usr;
+    std::string qualified_name;
+    std::string signature;
+    Tsepepe::SourceFileLocation location;
+};
+
+struct TranslationUnitRecord
+{
+    Tsepepe::TranslationUnitFingerprint fingerprint;
+    std::vector<FunctionRecord> declarations;
+    std::vector<FunctionRecord> definitions;
+};
+
+using TranslationUnitRecords = std::map<std::string, TranslationUnitRecord>;
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+//! Bump it whenever the cached data layout, or the way it is produced, changes.
+static constexpr std::int64_t cache_format_version{1};
+static constexpr const char* cache_file_name{"declaration_drift.json"};
+
+static llvm::json::Value to_json(const TranslationUnitRecord&);
+static std::optional<TranslationUnitRecord> translation_unit_record_from_json(const llvm::json::Object&);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe
+{
+
+struct DeclarationDriftDetectorLibclangBasedImpl
+{
+    explicit DeclarationDriftDetectorLibclangBasedImpl(std::shared_ptr<CompilationDatabase> comp_db,
+                                                       DeclarationDriftDetectionParameters params) :
+        compilation_database{std::move(comp_db)},
+        parameters{std::move(params)},
+        root_directory{fs::weakly_canonical(fs::absolute(parameters.root_directory))}
+    {
+    }
+
+    DeclarationDriftReport detect()
+    {
+        // A single process at a time scans; the others wait, and then find its results cached.
+        std::optional<IndexWriterLock> writer_lock;
+        if (not parameters.cache_directory.empty())
+            writer_lock.emplace(fs::path{parameters.cache_directory / cache_file_name}.concat(".lock"));
+
+        auto cached_records{load_cache()};
+        auto current_file_hashes{hash_cached_dependencies(cached_records)};
+
+        auto translation_units{compilation_database->getAllFiles()};
+        std::vector<TranslationUnitRecord> records(translation_units.size());
+        utils::parallel_for(translation_units.size(), [&](std::size_t index) {
+            const auto& translation_unit{translation_units[index]};
+            auto compile_command_hash{hash_compile_commands(*compilation_database, translation_unit)};
+            if (auto it{cached_records.find(translation_unit)};
+                it != std::end(cached_records)
+                and is_up_to_date(it->second.fingerprint, compile_command_hash, current_file_hashes))
+                records[index] = std::move(it->second);
+            else
+                records[index] = scan(translation_unit, compile_command_hash);
+        });
+
+        store_cache(translation_units, records);
+        return make_report(records);
+    }
+
+  private:
+    TranslationUnitRecord scan(const std::string& translation_unit, std::uint64_t compile_command_hash) const
+    {
+        std::vector<std::unique_ptr<ASTUnit>> ast_units;
+        auto tool{make_clang_tool(*compilation_database, {translation_unit})};
+        tool.buildASTs(ast_units);
+        if (ast_units.empty() or ast_units.back() == nullptr)
+            return {};
+
+        auto& ast_unit{*ast_units.back()};
+        const auto& source_manager{ast_unit.getSourceManager()};
+
+        TranslationUnitRecord result{
+            .fingerprint = fingerprint_translation_unit(source_manager, compile_command_hash, root_directory)};
+
+        // Resolving the real path of a file is not for free, so it is done once per file.
+        llvm::DenseMap<FileID, std::optional<fs::path>> project_files;
+        auto get_project_file{[&](SourceLocation location) -> std::optional<fs::path> {
+            auto expansion_location{source_manager.getExpansionLoc(location)};
+            auto [it, is_inserted]{project_files.try_emplace(source_manager.getFileID(expansion_location))};
+            if (is_inserted)
+                if (auto path{get_absolute_file_path(expansion_location, source_manager)};
+                    not path.empty() and is_within_directory(path, root_directory))
+                    it->second = std::move(path);
+            return it->second;
+        }};
+
+        AstPrintingMemo printing_memo;
+        using namespace ast_matchers;
+        auto matcher{functionDecl(unless(isExpansionInSystemHeader())).bind("function")};
+        for (const auto& match : ast_matchers::match(matcher, ast_unit.getASTContext()))
+        {
+            auto function{match.getNodeAs<FunctionDecl>("function")};
+            if (function == nullptr)
+                continue;
+
+            auto file{get_project_file(function->getLocation())};
+            if (not file)
+                continue;
+
+            if (function->isThisDeclarationADefinition())
+            {
+                if (not function->isImplicit() and function->getTemplatedKind() == FunctionDecl::TK_NonTemplate
+                    and not function->isDependentContext())
+                    result.definitions.emplace_back(
+                        make_function_record(function, *file, source_manager, printing_memo));
+            } else if (function->isFirstDecl() and is_definable_out_of_line(function))
+            {
+                result.declarations.emplace_back(
+                    make_function_record(function, *file, source_manager, printing_memo));
+            }
+        }
+        return result;
+    }
+
+    static FunctionRecord make_function_record(const FunctionDecl* function,
+                                               const fs::path& file,
+                                               const SourceManager& source_manager,
+                                               AstPrintingMemo& printing_memo)
+    {
+        return {.usr = generate_usr(function),
+                .qualified_name = std::string{printing_memo.get_qualified_name(function)},
+                .signature = fully_expand_function_declaration(
+                    function,
+                    source_manager,
+                    {.ignore_attribute_specifiers = true, .remove_scope_from_parameters = true},
+                    &printing_memo),
+                .location = {.file = file,
+                             .line = source_manager.getPresumedLineNumber(
+                                 source_manager.getExpansionLoc(function->getLocation()))}};
+    }
+
+    static DeclarationDriftReport make_report(const std::vector<TranslationUnitRecord>& records)
+    {
+        std::map<std::string_view, const FunctionRecord*> declarations;
+        std::set<std::string_view> defined_usrs;
+        std::multimap<std::string_view, const FunctionRecord*> definitions_by_name;
+
+        // Declarations and definitions from the headers are seen by many translation units; the first one wins.
+        for (const auto& record : records)
+        {
+            for (const auto& declaration : record.declarations)
+                declarations.try_emplace(declaration.usr, &declaration);
+            for (const auto& definition : record.definitions)
+                if (defined_usrs.insert(definition.usr).second)
+                    definitions_by_name.emplace(definition.qualified_name, &definition);
+        }
+
+        DeclarationDriftReport report;
+        for (const auto& [usr, declaration] : declarations)
+        {
+            if (usr.empty() or defined_usrs.contains(usr))
+                continue;
+
+            bool is_mismatch_found{false};
+            auto [begin, end]{definitions_by_name.equal_range(declaration->qualified_name)};
+            for (auto it{begin}; it != end; ++it)
+            {
+                const auto& definition{*it->second};
+                // A definition of another, properly declared, overload is not a mismatch.
+                if (declarations.contains(definition.usr))
+                    continue;
+                report.signature_mismatches.push_back({.expected_definition = declaration->signature,
+                                                       .declaration_location = declaration->location,
+                                                       .actual_definition = definition.signature,
+                                                       .definition_location = definition.location});
+                is_mismatch_found = true;
+            }
+
+            if (not is_mismatch_found)
+                report.undefined_declarations.push_back(
+                    {.expected_definition = declaration->signature, .declaration_location = declaration->location});
+        }
+
+        auto by_declaration_location{[](const auto& lhs, const auto& rhs) {
+            return lhs.declaration_location < rhs.declaration_location;
+        }};
+        std::ranges::sort(report.undefined_declarations, by_declaration_location);
+        std::ranges::sort(report.signature_mismatches, by_declaration_location);
+        return report;
+    }
+
+    TranslationUnitRecords load_cache() const
+    {
+        TranslationUnitRecords result;
+        if (parameters.cache_directory.empty())
+            return result;
+
+        for (const auto& [translation_unit, value] :
+             load_translation_unit_cache(parameters.cache_directory / cache_file_name, cache_format_version))
+            if (auto object{value.getAsObject()}; object != nullptr)
+                if (auto record{translation_unit_record_from_json(*object)}; record)
+                    result.emplace(translation_unit.str(), std::move(*record));
+        return result;
+    }
+
+    void store_cache(const std::vector<std::string>& translation_units,
+                     const std::vector<TranslationUnitRecord>& records) const
+    {
+        if (parameters.cache_directory.empty())
+            return;
+
+        llvm::json::Object translation_units_json;
+        for (std::size_t i{0}; i < translation_units.size(); ++i)
+            if (records[i].fingerprint.compile_command_hash != 0)
+                translation_units_json[translation_units[i]] = to_json(records[i]);
+
+        store_translation_unit_cache(
+            parameters.cache_directory / cache_file_name, cache_format_version, std::move(translation_units_json));
+    }
+
+    std::shared_ptr<CompilationDatabase> compilation_database;
+    DeclarationDriftDetectionParameters parameters;
+    fs::path root_directory;
+};
+
+} // namespace Tsepepe
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::DeclarationDriftDetectorLibclangBased::DeclarationDriftDetectorLibclangBased(
+    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db) :
+    compilation_database{std::move(comp_db)}
+{
+}
+
+Tsepepe::DeclarationDriftReport
+Tsepepe::DeclarationDriftDetectorLibclangBased::detect(DeclarationDriftDetectionParameters params)
+{
+    return DeclarationDriftDetectorLibclangBasedImpl{compilation_database, std::move(params)}.detect();
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static llvm::json::Value to_json(const FunctionRecord& function)
+{
+    return llvm::json::Object{{"usr", function.usr},
+                              {"qualified_name", function.qualified_name},
+                              {"signature", function.signature},
+                              {"file", function.location.file.string()},
+                              {"line", function.location.line}};
+}
+
+static std::optional<FunctionRecord> function_record_from_json(const llvm::json::Value& value)
+{
+    auto object{value.getAsObject()};
+    if (object == nullptr)
+        return std::nullopt;
+
+    auto usr{object->getString("usr")};
+    auto qualified_name{object->getString("qualified_name")};
+    auto signature{object->getString("signature")};
+    auto file{object->getString("file")};
+    auto line{object->getInteger("line")};
+    if (not usr or not qualified_name or not signature or not file or not line)
+        return std::nullopt;
+
+    return FunctionRecord{.usr = usr->str(),
+                          .qualified_name = qualified_name->str(),
+                          .signature = signature->str(),
+                          .location = {.file = file->str(), .line = static_cast<unsigned>(*line)}};
+}
+
+static llvm::json::Value to_json(const TranslationUnitRecord& record)
+{
+    auto to_json_array{[](const std::vector<FunctionRecord>& functions) {
+        llvm::json::Array result;
+        for (const auto& function : functions)
+            result.push_back(to_json(function));
+        return result;
+    }};
+
+    llvm::json::Object result{{"declarations", to_json_array(record.declarations)},
+                              {"definitions", to_json_array(record.definitions)}};
+    Tsepepe::add_to_json(record.fingerprint, result);
+    return result;
+}
+
+static std::optional<TranslationUnitRecord> translation_unit_record_from_json(const llvm::json::Object& object)
+{
+    auto parse_functions{[](const llvm::json::Array* array, std::vector<FunctionRecord>& functions) {
+        if (array == nullptr)
+            return false;
+        for (const auto& value : *array)
+        {
+            auto function{function_record_from_json(value)};
+            if (not function)
+                return false;
+            functions.emplace_back(std::move(*function));
+        }
+        return true;
+    }};
+
+    auto fingerprint{Tsepepe::fingerprint_from_json(object)};
+    if (not fingerprint)
+        return std::nullopt;
+
+    TranslationUnitRecord result{.fingerprint = std::move(*fingerprint)};
+
+    if (not parse_functions(object.getArray("declarations"), result.declarations)
+        or not parse_functions(object.getArray("definitions"), result.definitions))
+        return std::nullopt;
+    return result;
+}
@@ -0,0 +1,308 @@
+/**
+ * @file	generate_definitions_in_paired_source_code_action.cpp
+ * @brief	Implements the GenerateDefinitionsInPairedSourceCodeActionLibclangBased.
+ */
+#include "generate_definitions_in_paired_source_code_action.hpp"
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <clang/AST/ASTContext.h>
+#include <clang/AST/Decl.h>
+#include <clang/AST/RawCommentList.h>
+#include <clang/ASTMatchers/ASTMatchFinder.h>
+#include <clang/ASTMatchers/ASTMatchers.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Lex/Lexer.h>
+
+#include "base_error.hpp"
+#include "code_formatter.hpp"
+#include "paired_cpp_file_finder.hpp"
+#include "parallel_utils.hpp"
+#include "parsed_file_cache.hpp"
+
+#include "libclang_utils/full_function_declaration_expander.hpp"
+#include "libclang_utils/misc_utils.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang;
+using namespace clang::tooling;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe
+{
+
+struct GenerateDefinitionsInPairedSourceCodeActionLibclangBasedImpl
+{
+    explicit GenerateDefinitionsInPairedSourceCodeActionLibclangBasedImpl(
+        std::shared_ptr<CompilationDatabase> comp_db,
+        CodeGenerationCache* code_generation_cache,
+        ParsedFileCache* parsed_file_cache,
+        GenerateDefinitionsInPairedSourceCodeActionParameters params) :
+        compilation_database{std::move(comp_db)},
+        code_generation_cache{code_generation_cache},
+        parsed_file_cache{parsed_file_cache},
+        parameters{std::move(params)}
+    {
+        if (parameters.selected_line_begin > parameters.selected_line_end)
+            throw BaseError{"Selected line range must have the end line be past the begin line!"};
+        if (is_cpp_source_file(parameters.header_file_path))
+            throw BaseError{"Expected a header file, got a source file: " + parameters.header_file_path.string()};
+        parameters.header_file_path = fs::weakly_canonical(fs::absolute(parameters.header_file_path));
+    }
+
+    MultiFileEdit apply()
+    {
+        std::optional<fs::path> source_file_path;
+        for (const auto& paired_file : find_paired_cpp_files(parameters.root_directory, parameters.header_file_path))
+        {
+            if (is_cpp_source_file(paired_file))
+            {
+                source_file_path = fs::weakly_canonical(fs::absolute(paired_file));
+                break;
+            }
+        }
+
+        std::vector<HeaderFunction> header_functions;
+        SourceFile source_file;
+        utils::parallel_for(source_file_path ? 2 : 1, [&](std::size_t index) {
+            if (index == 0)
+                header_functions = collect_header_functions();
+            else
+                source_file = collect_source_definitions(*source_file_path);
+        });
+
+        if (not source_file_path)
+        {
+            source_file_path = fs::path{parameters.header_file_path}.replace_extension(".cpp");
+            source_file.content = "#include \"" + parameters.header_file_path.filename().string() + "\"\n";
+        }
+
+        auto insertions{make_insertions(header_functions, source_file)};
+        if (insertions.empty())
+            return {};
+        return {{*source_file_path,
+                 apply_and_format_insertions(
+                     source_file.content, std::move(insertions), *source_file_path, parameters.code_formatting)}};
+    }
+
+  private:
+    struct HeaderFunction
+    {
+        std::string usr;
+        //! Set only for the functions declared within the selected lines.
+        std::optional<std::string> definition;
+    };
+
+    struct DefinitionBounds
+    {
+        //! Offset of the beginning of the first line of the definition, including its leading comment.
+        unsigned begin;
+        //! Offset past the newline, which ends the last line of the definition.
+        unsigned end;
+    };
+
+    struct SourceFile
+    {
+        std::string content;
+        std::map<std::string, DefinitionBounds> definitions_by_usr;
+    };
+
+    //! Returns all the functions declared within the header, in the declaration order.
+    std::vector<HeaderFunction> collect_header_functions() const
+    {
+        auto virtual_file_path{make_virtual_source_file_path(parameters.header_file_path, "func_decls")};
+        auto parsed_file{parse(virtual_file_path, parameters.header_file_content)};
+        const auto& ast_unit{parsed_file->ast_unit};
+        if (ast_unit == nullptr)
+            throw BaseError{"Failed to parse the header file: " + parameters.header_file_path.string()};
+
+        using namespace ast_matchers;
+        auto matcher{functionDecl(unless(isDefinition()), isExpansionInMainFile()).bind("function")};
+        auto matches{match(matcher, ast_unit->getASTContext())};
+
+        const auto& source_manager{ast_unit->getSourceManager()};
+        AstPrintingMemo printing_memo;
+        std::vector<std::pair<unsigned, HeaderFunction>> functions_by_offset;
+        for (const auto& match : matches)
+        {
+            auto function{match.getNodeAs<FunctionDecl>("function")};
+            if (function == nullptr)
+                continue;
+
+            HeaderFunction header_function{.usr = generate_usr(function)};
+            auto line{source_manager.getPresumedLoc(function->getBeginLoc()).getLine()};
+            if (line >= parameters.selected_line_begin and line <= parameters.selected_line_end)
+                header_function.definition = fully_expand_function_declaration(
+                    function,
+                    source_manager,
+                    {.ignore_attribute_specifiers = true, .remove_scope_from_parameters = true},
+                    code_generation_cache,
+                    &printing_memo);
+            else if (not function->isFirstDecl() or not is_definable_out_of_line(function))
+                continue;
+
+            auto offset{source_manager.getFileOffset(source_manager.getExpansionLoc(function->getBeginLoc()))};
+            functions_by_offset.emplace_back(offset, std::move(header_function));
+        }
+
+        std::ranges::stable_sort(functions_by_offset, {}, &std::pair<unsigned, HeaderFunction>::first);
+        std::vector<HeaderFunction> result;
+        result.reserve(functions_by_offset.size());
+        for (auto& [offset, header_function] : functions_by_offset)
+            result.emplace_back(std::move(header_function));
+        return result;
+    }
+
+    SourceFile collect_source_definitions(const fs::path& source_file_path) const
+    {
+        auto parsed_file{parse(source_file_path)};
+        const auto& ast_unit{parsed_file->ast_unit};
+        if (ast_unit == nullptr)
+            throw BaseError{"Failed to parse the source file: " + source_file_path.string()};
+
+        auto& ast_context{ast_unit->getASTContext()};
+        const auto& source_manager{ast_unit->getSourceManager()};
+
+        SourceFile result;
+        result.content = source_manager.getBufferData(source_manager.getMainFileID()).str();
+
+        using namespace ast_matchers;
+        auto matcher{functionDecl(isDefinition(), isExpansionInMainFile()).bind("function")};
+        for (const auto& match : ast_matchers::match(matcher, ast_context))
+        {
+            auto function{match.getNodeAs<FunctionDecl>("function")};
+            if (function == nullptr or function->isImplicit())
+                continue;
+
+            auto usr{generate_usr(function)};
+            if (usr.empty())
+                continue;
+
+            auto begin_location{source_manager.getExpansionLoc(function->getBeginLoc())};
+            if (auto comment{ast_context.getRawCommentForDeclNoCache(function)}; comment != nullptr)
+                begin_location = std::min(begin_location, source_manager.getExpansionLoc(comment->getBeginLoc()));
+            auto end_location{Lexer::getLocForEndOfToken(
+                source_manager.getExpansionLoc(function->getEndLoc()), 0, source_manager, ast_context.getLangOpts())};
+
+            result.definitions_by_usr.try_emplace(
+                std::move(usr),
+                DefinitionBounds{
+                    .begin = to_line_begin(result.content, source_manager.getFileOffset(begin_location)),
+                    .end = past_line_end(result.content, source_manager.getFileOffset(end_location))});
+        }
+        return result;
+    }
+
+    static std::vector<CodeInsertionByOffset> make_insertions(const std::vector<HeaderFunction>& header_functions,
+                                                              const SourceFile& source_file)
+    {
+        const auto& definitions_by_usr{source_file.definitions_by_usr};
+        auto find_definition{[&](const HeaderFunction& function) -> const DefinitionBounds* {
+            if (function.usr.empty())
+                return nullptr;
+            auto it{definitions_by_usr.find(function.usr)};
+            return it != std::end(definitions_by_usr) ? &it->second : nullptr;
+        }};
+
+        // The definitions placed at the same offset are concatenated in the declaration order, because
+        // apply_insertions() does not keep the order of the insertions with equal offsets.
+        std::map<unsigned, std::string> code_by_offset;
+        for (std::size_t index{0}; index < header_functions.size(); ++index)
+        {
+            const auto& function{header_functions[index]};
+            if (not function.definition or find_definition(function) != nullptr)
+                continue;
+
+            const DefinitionBounds* preceding{nullptr};
+            for (auto i{index}; i > 0 and preceding == nullptr; --i)
+                preceding = find_definition(header_functions[i - 1]);
+
+            const DefinitionBounds* following{nullptr};
+            for (auto i{index + 1}; i < header_functions.size() and preceding == nullptr and following == nullptr; ++i)
+                following = find_definition(header_functions[i]);
+
+            if (following != nullptr)
+            {
+                code_by_offset[following->begin] += *function.definition + "\n{\n}\n\n";
+                continue;
+            }
+
+            const auto& content{source_file.content};
+            unsigned offset{preceding != nullptr ? preceding->end : static_cast<unsigned>(content.size())};
+            auto& code{code_by_offset[offset]};
+            if (code.empty() and offset > 0 and content[offset - 1] != '\n')
+                code += '\n';
+            if (not code.empty() or offset > 0)
+                code += '\n';
+            code += *function.definition + "\n{\n}\n";
+        }
+
+        std::vector<CodeInsertionByOffset> result;
+        result.reserve(code_by_offset.size());
+        for (auto& [offset, code] : code_by_offset)
+            result.push_back({.code = std::move(code), .offset = offset});
+        return result;
+    }
+
+    static unsigned to_line_begin(const std::string& content, unsigned offset)
+    {
+        auto newline_position{content.rfind('\n', offset == 0 ? 0 : offset - 1)};
+        if (offset == 0 or newline_position == std::string::npos)
+            return 0;
+        return newline_position + 1;
+    }
+
+    static unsigned past_line_end(const std::string& content, unsigned offset)
+    {
+        auto newline_position{content.find('\n', offset)};
+        if (newline_position == std::string::npos)
+            return content.size();
+        return newline_position + 1;
+    }
+
+    /**
+     * Parses the file, unless it is cached; if the content is given, then it is parsed instead of the disk file. The
+     * cached file is put back, once the taken file is destroyed, also on an exception.
+     */
+    TakenParsedFile parse(const fs::path& path, std::optional<SourceFileContent> content = std::nullopt) const
+    {
+        parameters.cancellation.throw_if_cancelled();
+        return take_parsed_file(parsed_file_cache, *compilation_database, path, std::move(content));
+    }
+
+    std::shared_ptr<CompilationDatabase> compilation_database;
+    CodeGenerationCache* code_generation_cache;
+    ParsedFileCache* parsed_file_cache;
+    GenerateDefinitionsInPairedSourceCodeActionParameters parameters;
+};
+
+} // namespace Tsepepe
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::GenerateDefinitionsInPairedSourceCodeActionLibclangBased::
+    GenerateDefinitionsInPairedSourceCodeActionLibclangBased(
+        std::shared_ptr<clang::tooling::CompilationDatabase> comp_db,
+        std::shared_ptr<CodeGenerationCache> cache,
+        std::shared_ptr<ParsedFileCache> parsed_files) :
+    compilation_database{std::move(comp_db)},
+    code_generation_cache{std::move(cache)},
+    parsed_file_cache{std::move(parsed_files)}
+{
+}
+
+Tsepepe::MultiFileEdit Tsepepe::GenerateDefinitionsInPairedSourceCodeActionLibclangBased::apply(
+    GenerateDefinitionsInPairedSourceCodeActionParameters params)
+{
+    return GenerateDefinitionsInPairedSourceCodeActionLibclangBasedImpl{
+        compilation_database, code_generation_cache.get(), parsed_file_cache.get(), std::move(params)}
+        .apply();
+}
@@ -7,14 +7,16 @@
 #include <clang/AST/Decl.h>
 #include <clang/ASTMatchers/ASTMatchFinder.h>
 #include <clang/ASTMatchers/ASTMatchers.h>
-#include <clang/Tooling/Tooling.h>
 
+#include <algorithm>
+#include <iterator>
 #include <utility>
 
 #include "base_error.hpp"
+#include "source_file_content.hpp"
+#include "string_builder.hpp"
 #include "libclang_utils/full_function_declaration_expander.hpp"
 #include "string_utils.hpp"
-#include "temporary_file_maker.hpp"
 
 namespace fs = std::filesystem;
 using namespace clang;
@@ -26,70 +28,119 @@ AST_MATCHER_P(FunctionDecl, isWithinFile, std::string, filename)
     return source_manager.getFilename(Node.getLocation()) == filename;
 };
 
-using LineRange = std::pair<unsigned, unsigned>;
-AST_MATCHER_P(FunctionDecl, isWithinLines, LineRange, line_range)
-{
-    const auto& source_manager{Finder->getASTContext().getSourceManager()};
-    auto actual_line_with_declaration{source_manager.getPresumedLoc(Node.getBeginLoc()).getLine()};
-    auto [begin, end] = line_range;
-    return actual_line_with_declaration >= begin and actual_line_with_declaration <= end;
-}
-
 Tsepepe::GenerateFunctionDefinitionsCodeActionLibclangBased::GenerateFunctionDefinitionsCodeActionLibclangBased(
-    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db) :
+    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db,
+    std::shared_ptr<CodeGenerationCache> cache,
+    std::shared_ptr<ParsedFileCache> parsed_files) :
     compilation_database{std::move(comp_db)},
-    tsepepe_temp_directory_tree{fs::temp_directory_path() / "tsepepe"},
-    this_code_action_directory_tree{fs::temp_directory_path() / "tsepepe" / "gen_func_def_code_action"}
+    code_generation_cache{std::move(cache)},
+    parsed_file_cache{std::move(parsed_files)}
 {
 }
 
 std::string Tsepepe::GenerateFunctionDefinitionsCodeActionLibclangBased::apply(
     GenerateFunctionDefinitionsCodeActionParameters params)
 {
-    validate_selected_range(params);
+    auto definitions_per_range{apply_per_range(std::move(params))};
 
-    auto full_path_to_temp_file{
-        Tsepepe::make_temporary_source_file(params.source_file_path, "func_decls", params.source_file_content)};
+    std::vector<std::string> non_empty_groups;
+    non_empty_groups.reserve(definitions_per_range.size());
+    for (auto& definitions : definitions_per_range)
+        if (not definitions.empty())
+            non_empty_groups.emplace_back(std::move(definitions));
 
-    std::vector<std::unique_ptr<ASTUnit>> ast_units;
-    ClangTool tool{*compilation_database, {full_path_to_temp_file.string()}};
-    tool.buildASTs(ast_units);
+    return Tsepepe::utils::join(non_empty_groups, "\n");
+}
 
-    auto& ast_unit{*ast_units.back()};
+std::vector<std::string> Tsepepe::GenerateFunctionDefinitionsCodeActionLibclangBased::apply_per_range(
+    GenerateFunctionDefinitionsCodeActionParameters params)
+{
+    auto sorted_ranges{validate_selected_ranges(params)};
+
+    std::vector<LineRange> ranges{{params.selected_line_begin, params.selected_line_end}};
+    ranges.insert(std::end(ranges),
+                  std::begin(params.additional_selected_line_ranges),
+                  std::end(params.additional_selected_line_ranges));
+
+    auto virtual_file_path{make_virtual_source_file_path(params.source_file_path, "func_decls").string()};
+
+    params.cancellation.throw_if_cancelled();
+
+    // The cached file is put back, once the taken file is destroyed, also on an exception.
+    auto parsed_file{Tsepepe::take_parsed_file(
+        parsed_file_cache.get(), *compilation_database, virtual_file_path, params.source_file_content)};
+    if (parsed_file->ast_unit == nullptr)
+        throw Tsepepe::BaseError{"Failed to parse the file: " + params.source_file_path.string()};
+
+    auto& ast_unit{*parsed_file->ast_unit};
     auto matcher{ast_matchers::functionDecl(ast_matchers::unless(ast_matchers::isDefinition()),
-                                            isWithinFile(full_path_to_temp_file),
-                                            isWithinLines({params.selected_line_begin, params.selected_line_end}))
+                                            isWithinFile(virtual_file_path))
                      .bind("function")};
     auto matches{ast_matchers::match(matcher, ast_unit.getASTContext())};
-    if (matches.empty())
-        return "";
-
-    std::vector<std::string> result_parted;
-    auto number_of_potential_declarations(params.selected_line_end - params.selected_line_begin + 1);
-    result_parted.reserve(number_of_potential_declarations);
 
+    // The declarations are collected per sorted range, then the groups are reordered to follow the requested order.
+    std::vector<std::vector<std::string>> definitions_per_sorted_range(sorted_ranges.size());
     const auto& source_manager{ast_unit.getSourceManager()};
+    AstPrintingMemo printing_memo;
     for (const auto& match : matches)
     {
         auto node{match.getNodeAs<FunctionDecl>("function")};
         if (node == nullptr)
             continue;
+
+        auto line{source_manager.getPresumedLoc(node->getBeginLoc()).getLine()};
+        auto range_it{std::ranges::upper_bound(sorted_ranges, line, {}, &LineRange::begin)};
+        if (range_it == std::begin(sorted_ranges))
+            continue;
+        --range_it;
+        if (line > range_it->end)
+            continue;
+
         auto definition{Tsepepe::fully_expand_function_declaration(
-            node, source_manager, {.ignore_attribute_specifiers = true, .remove_scope_from_parameters = true})};
-        result_parted.emplace_back(std::move(definition));
+            node,
+            source_manager,
+            {.ignore_attribute_specifiers = true, .remove_scope_from_parameters = true},
+            code_generation_cache.get(),
+            &printing_memo)};
+        definitions_per_sorted_range[std::distance(std::begin(sorted_ranges), range_it)].emplace_back(
+            std::move(definition));
     }
 
-    auto result{Tsepepe::utils::join(result_parted, "\n{\n}\n\n")};
-    result += "\n{\n}\n";
+    std::vector<std::string> result;
+    result.reserve(ranges.size());
+    for (const auto& range : ranges)
+    {
+        auto sorted_index{std::distance(std::begin(sorted_ranges), std::ranges::lower_bound(sorted_ranges, range))};
+        const auto& definitions{definitions_per_sorted_range[sorted_index]};
+        if (definitions.empty())
+        {
+            result.emplace_back();
+            continue;
+        }
+
+        result.emplace_back(Tsepepe::StringBuilder{}
+                                .append_joined(std::begin(definitions), std::end(definitions), "\n", "\n{\n}\n")
+                                .take());
+    }
     return result;
 }
 
-void Tsepepe::GenerateFunctionDefinitionsCodeActionLibclangBased::validate_selected_range(
+std::vector<Tsepepe::LineRange> Tsepepe::GenerateFunctionDefinitionsCodeActionLibclangBased::validate_selected_ranges(
     const GenerateFunctionDefinitionsCodeActionParameters& params) const
 {
-    auto begin{params.selected_line_begin};
-    auto end{params.selected_line_end};
-    if (begin > end)
-        throw Tsepepe::BaseError{"Selected line range must have the end line be past the begin line!"};
-}
+    std::vector<LineRange> sorted_ranges{{params.selected_line_begin, params.selected_line_end}};
+    sorted_ranges.insert(std::end(sorted_ranges),
+                         std::begin(params.additional_selected_line_ranges),
+                         std::end(params.additional_selected_line_ranges));
 
+    for (const auto& [begin, end] : sorted_ranges)
+        if (begin > end)
+            throw Tsepepe::BaseError{"Selected line range must have the end line be past the begin line!"};
+
+    std::ranges::sort(sorted_ranges);
+    for (std::size_t i{1}; i < sorted_ranges.size(); ++i)
+        if (sorted_ranges[i].begin <= sorted_ranges[i - 1].end)
+            throw Tsepepe::BaseError{"Selected line ranges must be disjoint!"};
+
+    return sorted_ranges;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file	generate_missing_definitions_code_action.cpp
+ * @brief	Implements the GenerateMissingDefinitionsCodeActionLibclangBased.
+ */
+#include "generate_missing_definitions_code_action.hpp"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <clang/AST/Decl.h>
+#include <clang/ASTMatchers/ASTMatchFinder.h>
+#include <clang/ASTMatchers/ASTMatchers.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Tooling/Tooling.h>
+
+#include "base_error.hpp"
+#include "code_formatter.hpp"
+#include "paired_cpp_file_finder.hpp"
+#include "parallel_utils.hpp"
+#include "string_builder.hpp"
+
+#include "libclang_utils/full_function_declaration_expander.hpp"
+#include "libclang_utils/misc_utils.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang;
+using namespace clang::tooling;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations and definitions
+// --------------------------------------------------------------------------------------------------------------------
+//! Matches the first declarations of the functions, which have no definition and could be defined in a source file.
+AST_MATCHER(FunctionDecl, isMissingOutOfLineDefinition)
+{
+    return Node.isFirstDecl() and not Node.isDefined() and Tsepepe::is_definable_out_of_line(&Node);
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe
+{
+
+struct GenerateMissingDefinitionsCodeActionLibclangBasedImpl
+{
+    explicit GenerateMissingDefinitionsCodeActionLibclangBasedImpl(
+        std::shared_ptr<CompilationDatabase> comp_db, GenerateMissingDefinitionsCodeActionParameters params) :
+        compilation_database{std::move(comp_db)}, parameters{std::move(params)}
+    {
+        for (auto& header_path : parameters.header_paths)
+        {
+            if (not fs::is_regular_file(header_path))
+                throw BaseError{"Header file: " + header_path.string() + " does not exist!"};
+            header_path = fs::weakly_canonical(fs::absolute(header_path));
+        }
+    }
+
+    MultiFileEdit apply()
+    {
+        std::vector<HeaderDefinitions> header_definitions(parameters.header_paths.size());
+        utils::parallel_for(parameters.header_paths.size(), [&](std::size_t index) {
+            header_definitions[index] = generate_definitions(parameters.header_paths[index]);
+        });
+
+        // Many headers may share the same paired source file, e.g. both foo.h and foo.hpp the new foo.cpp; their
+        // groups are appended in the order of the headers, and the includes missing from the file are merged.
+        MultiFileEdit result;
+        std::map<fs::path, std::vector<CodeRange>> appended_ranges;
+        std::map<fs::path, std::string> include_blocks;
+        for (auto& [source_file_path, source_file_content, include_statement, definitions] : header_definitions)
+        {
+            if (definitions.empty())
+                continue;
+
+            auto& new_content{result.try_emplace(source_file_path, std::move(source_file_content)).first->second};
+            if (auto& include_block{include_blocks[source_file_path]};
+                include_block.find(include_statement) == std::string::npos)
+                include_block += include_statement;
+            if (not new_content.empty())
+                new_content += new_content.ends_with('\n') ? "\n" : "\n\n";
+            auto offset{static_cast<unsigned>(new_content.size())};
+            new_content += definitions;
+            appended_ranges[source_file_path].push_back(
+                {.offset = offset, .length = static_cast<unsigned>(definitions.size())});
+        }
+
+        // The includes are prepended, separated with an empty line, once all the groups are appended.
+        for (auto& [source_file_path, include_block] : include_blocks)
+        {
+            if (include_block.empty())
+                continue;
+            include_block += '\n';
+            result.at(source_file_path).insert(0, include_block);
+            for (auto& range : appended_ranges[source_file_path])
+                range.offset += static_cast<unsigned>(include_block.size());
+        }
+
+        if (parameters.code_formatting)
+            for (auto& [source_file_path, new_content] : result)
+                new_content = format_code_ranges(std::move(new_content),
+                                                 source_file_path,
+                                                 appended_ranges[source_file_path],
+                                                 *parameters.code_formatting);
+        return result;
+    }
+
+  private:
+    struct HeaderDefinitions
+    {
+        fs::path source_file_path;
+        //! Empty for a new source file.
+        std::string source_file_content;
+        //! Empty, if the source file includes the header already.
+        std::string include_statement;
+        std::string definitions;
+    };
+
+    HeaderDefinitions generate_definitions(const fs::path& header_path) const
+    {
+        HeaderDefinitions result;
+
+        std::unique_ptr<ASTUnit> ast_unit;
+        auto paired_source_files{find_paired_cpp_files(parameters.root_directory, header_path)};
+        if (paired_source_files.empty())
+        {
+            result.source_file_path = fs::path{header_path}.replace_extension(".cpp");
+            result.include_statement = make_include_statement(header_path, result.source_file_path);
+        } else
+        {
+            result.source_file_path = fs::weakly_canonical(fs::absolute(paired_source_files.front()));
+            ast_unit = build_ast_unit(result.source_file_path);
+            if (ast_unit == nullptr)
+                throw BaseError{"Failed to parse the source file: " + result.source_file_path.string()};
+
+            const auto& source_manager{ast_unit->getSourceManager()};
+            result.source_file_content = source_manager.getBufferData(source_manager.getMainFileID()).str();
+
+            // The functions defined within the source are visible only if the source includes the header; otherwise the
+            // header is parsed alone, and has to be included by the source, which its definitions are appended to.
+            if (find_file_id(header_path, *ast_unit).isInvalid())
+            {
+                ast_unit = nullptr;
+                result.include_statement = make_include_statement(header_path, result.source_file_path);
+            }
+        }
+
+        if (ast_unit == nullptr)
+            ast_unit = build_ast_unit(header_path);
+        if (ast_unit == nullptr)
+            throw BaseError{"Failed to parse the header file: " + header_path.string()};
+
+        result.definitions = generate_definitions(*ast_unit, find_file_id(header_path, *ast_unit));
+        return result;
+    }
+
+    std::string generate_definitions(ASTUnit& ast_unit, FileID header_file_id) const
+    {
+        auto matcher{ast_matchers::functionDecl(isMissingOutOfLineDefinition()).bind("function")};
+        auto matches{ast_matchers::match(matcher, ast_unit.getASTContext())};
+
+        const auto& source_manager{ast_unit.getSourceManager()};
+        std::vector<std::string> definitions;
+        AstPrintingMemo printing_memo;
+        for (const auto& match : matches)
+        {
+            auto node{match.getNodeAs<FunctionDecl>("function")};
+            if (node == nullptr)
+                continue;
+            if (source_manager.getFileID(source_manager.getExpansionLoc(node->getLocation())) != header_file_id)
+                continue;
+
+            definitions.emplace_back(Tsepepe::fully_expand_function_declaration(
+                node,
+                source_manager,
+                {.ignore_attribute_specifiers = true, .remove_scope_from_parameters = true},
+                &printing_memo));
+        }
+
+        return StringBuilder{}
+            .append_joined(std::begin(definitions), std::end(definitions), "\n", "\n{\n}\n")
+            .take();
+    }
+
+    std::unique_ptr<ASTUnit> build_ast_unit(const fs::path& path) const
+    {
+        parameters.cancellation.throw_if_cancelled();
+
+        std::vector<std::unique_ptr<ASTUnit>> ast_units;
+        auto tool{make_clang_tool(*compilation_database, {path.string()})};
+        tool.buildASTs(ast_units);
+        if (ast_units.empty())
+            return nullptr;
+        return std::move(ast_units.back());
+    }
+
+    //! The header is included relative to the source file.
+    static std::string make_include_statement(const fs::path& header_path, const fs::path& source_file_path)
+    {
+        return "#include \"" + header_path.lexically_relative(source_file_path.parent_path()).generic_string() + "\"\n";
+    }
+
+    static FileID find_file_id(const fs::path& path, ASTUnit& ast_unit)
+    {
+        auto file_entry{ast_unit.getFileManager().getFile(path.string())};
+        if (not file_entry)
+            return {};
+        return ast_unit.getSourceManager().translateFile(*file_entry);
+    }
+
+    std::shared_ptr<CompilationDatabase> compilation_database;
+    GenerateMissingDefinitionsCodeActionParameters parameters;
+};
+
+} // namespace Tsepepe
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::GenerateMissingDefinitionsCodeActionLibclangBased::GenerateMissingDefinitionsCodeActionLibclangBased(
+    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db) :
+    compilation_database{std::move(comp_db)}
+{
+}
+
+Tsepepe::MultiFileEdit
+Tsepepe::GenerateMissingDefinitionsCodeActionLibclangBased::apply(GenerateMissingDefinitionsCodeActionParameters params)
+{
+    return GenerateMissingDefinitionsCodeActionLibclangBasedImpl{compilation_database, std::move(params)}.apply();
+}
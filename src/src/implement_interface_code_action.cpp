@@ -5,25 +5,37 @@
 
 #include "implement_interface_code_action.hpp"
 
+#include <algorithm>
 #include <filesystem>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <regex>
+#include <set>
+#include <string_view>
+#include <system_error>
 
 #include <clang/ASTMatchers/ASTMatchFinder.h>
 #include <clang/ASTMatchers/ASTMatchers.h>
 #include <clang/Frontend/ASTUnit.h>
-#include <clang/Tooling/Tooling.h>
 
 #include "base_error.hpp"
-#include "code_insertions_applier.hpp"
+#include "clangd_index.hpp"
+#include "code_formatter.hpp"
+#include "code_generation_cache.hpp"
 #include "codebase_grepper.hpp"
 #include "common_types.hpp"
-#include "directory_tree.hpp"
+#include "include_resolver.hpp"
 #include "include_statement_place_resolver.hpp"
-#include "temporary_file_maker.hpp"
+#include "parallel_utils.hpp"
+#include "parsed_file_cache.hpp"
+#include "source_file_content.hpp"
+#include "string_builder.hpp"
+#include "string_utils.hpp"
 
 #include "libclang_utils/ast_record.hpp"
 #include "libclang_utils/base_specifier_resolver.hpp"
+#include "libclang_utils/misc_utils.hpp"
 #include "libclang_utils/presumed_source_range.hpp"
 #include "libclang_utils/pure_virtual_functions_extractor.hpp"
 #include "libclang_utils/suitable_place_in_class_finder.hpp"
@@ -57,41 +69,134 @@ namespace Tsepepe
 struct ImplementIntefaceCodeActionLibclangBasedImpl
 {
     explicit ImplementIntefaceCodeActionLibclangBasedImpl(std::shared_ptr<CompilationDatabase> comp_db,
+                                                          CodeGenerationCache* code_generation_cache,
+                                                          ParsedFileCache* parsed_file_cache,
+                                                          ClangdIndex* clangd_index,
                                                           ImplementInterfaceCodeActionParameters params) :
         compilation_database{std::move(comp_db)},
-        tsepepe_temp_directory_tree{fs::temp_directory_path() / "tsepepe"},
-        this_code_action_directory_tree{fs::temp_directory_path() / "tsepepe" / "impl_iface_code_action"},
+        code_generation_cache{code_generation_cache},
+        parsed_file_cache{parsed_file_cache},
+        clangd_index{clangd_index},
         parameters{std::move(params)},
+        interface_candidate_files{find_interface_candidate_files()},
+        interface_candidate_parsed_files{parse_files()},
         implementor{find_implementor()},
-        interface_{find_interface()}
+        interfaces{find_interfaces()}
     {
     }
 
     NewFileContent apply()
     {
-        const auto& file_content{parameters.source_file_content};
+        auto file_content{parameters.source_file_content.view()};
 
-        auto include_code_insertion{get_include_statement_code_insertion()};
-        auto base_class_specifier_insertion{
-            Tsepepe::resolve_base_specifier(file_content, implementor, interface_.node)};
+        std::vector<const CXXRecordDecl*> interface_nodes;
+        interface_nodes.reserve(interfaces.size());
+        std::ranges::transform(
+            interfaces, std::back_inserter(interface_nodes), [](const auto& iface) { return iface.node; });
+
+        auto include_code_insertion{get_include_statements_code_insertion()};
+        auto base_class_specifiers_insertion{
+            Tsepepe::resolve_base_specifiers(file_content, implementor, interface_nodes)};
         auto overrides_insertion{get_overrides_code_insertion()};
 
-        return apply_insertions(file_content,
-                                {include_code_insertion, base_class_specifier_insertion, overrides_insertion});
+        return apply_and_format_insertions(
+            file_content,
+            {include_code_insertion, base_class_specifiers_insertion, overrides_insertion},
+            parameters.source_file_path,
+            parameters.code_formatting);
     }
 
   private:
-    ClangClassRecord find_implementor()
+    //! Looks the interfaces up within the clangd index, if it is fresh; greps the codebase for them otherwise.
+    std::vector<fs::path> find_interface_candidate_files()
     {
-        auto full_path_to_temp_file{
-            make_temporary_source_file(parameters.source_file_path, "implementor", parameters.source_file_content)};
+        if (parameters.interface_names.empty())
+            throw BaseError{"No interface name specified!"};
 
-        ClangTool tool{*compilation_database, {full_path_to_temp_file.string()}};
-        tool.buildASTs(ast_units);
+        if (clangd_index != nullptr)
+            if (auto files{clangd_index->find_class_definition_files(parameters.interface_names)}; files)
+            {
+                are_interface_candidates_indexed = true;
+                return std::move(*files);
+            }
+        return grep_interface_candidate_files();
+    }
+
+    //! Greps once for all the interfaces; returns the unique paths of files, which potentially define them.
+    std::vector<fs::path> grep_interface_candidate_files() const
+    {
+        std::string class_definition_regex{"\\b(struct|class)\\s+(" + utils::join(parameters.interface_names, "|")
+                                           + ")\\b"};
+        auto file_matches{
+            codebase_grep(RootDirectory(parameters.root_directory), EcmaScriptPattern{class_definition_regex})};
+
+        std::vector<fs::path> result;
+        result.reserve(file_matches.size());
+        for (auto& file_match : file_matches)
+            if (std::ranges::find(result, file_match.path) == std::end(result))
+                result.emplace_back(std::move(file_match.path));
+        return result;
+    }
+
+    //! Parses the implementor and all the interface candidate files in parallel, each file exactly once.
+    std::vector<TakenParsedFile> parse_files()
+    {
+        implementor_file_path = make_virtual_source_file_path(parameters.source_file_path, "implementor").string();
+
+        // The job with index 0 parses the implementor, the rest parse the interface candidate files.
+        std::vector<TakenParsedFile> result(interface_candidate_files.size());
+        utils::parallel_for(interface_candidate_files.size() + 1, [&](std::size_t job_index) {
+            if (job_index == 0)
+                implementor_parsed_file = parse(implementor_file_path, parameters.source_file_content);
+            else
+                result[job_index - 1] = parse(interface_candidate_files[job_index - 1]);
+        });
+
+        if (implementor_parsed_file->ast_unit == nullptr)
+            throw BaseError{"Failed to parse the file with the potential implementor!"};
+
+        // The class found within the clangd index, under the name of an interface, may be not the abstract one.
+        if (are_interface_candidates_indexed
+            and not std::ranges::all_of(parameters.interface_names, [&](const std::string& iface_name) {
+                    return find_abstract_class(result, iface_name).has_value();
+                }))
+            parse_grepped_interface_candidate_files(result);
+
+        return result;
+    }
+
+    //! Parses the grepped files, which are not parsed yet, and appends them to the interface candidates.
+    void parse_grepped_interface_candidate_files(std::vector<TakenParsedFile>& parsed_files)
+    {
+        std::vector<fs::path> grepped_files;
+        for (auto& path : grep_interface_candidate_files())
+            if (std::ranges::find(interface_candidate_files, path) == std::end(interface_candidate_files))
+                grepped_files.emplace_back(std::move(path));
+
+        std::vector<TakenParsedFile> grepped_parsed_files(grepped_files.size());
+        utils::parallel_for(grepped_files.size(), [&](std::size_t index) {
+            grepped_parsed_files[index] = parse(grepped_files[index]);
+        });
+
+        std::ranges::move(grepped_files, std::back_inserter(interface_candidate_files));
+        std::ranges::move(grepped_parsed_files, std::back_inserter(parsed_files));
+    }
 
-        auto& ast_unit{*ast_units.back()};
+    /**
+     * Parses the file, unless it is cached; if the content is given, then it is parsed instead of the disk file. The
+     * cached file is put back, once the taken file is destroyed, along with this object, or on an exception.
+     */
+    TakenParsedFile parse(const fs::path& path, std::optional<SourceFileContent> content = std::nullopt) const
+    {
+        parameters.cancellation.throw_if_cancelled();
+        return take_parsed_file(parsed_file_cache, *compilation_database, path, std::move(content));
+    }
+
+    ClangClassRecord find_implementor()
+    {
+        auto& ast_unit{*implementor_parsed_file->ast_unit};
         auto class_matcher{
-            ast_matchers::cxxRecordDecl(ast_matchers::hasDefinition(), isWithinFile(full_path_to_temp_file))
+            ast_matchers::cxxRecordDecl(ast_matchers::hasDefinition(), isWithinFile(implementor_file_path))
                 .bind("class")};
         auto matches{ast_matchers::match(class_matcher, ast_unit.getASTContext())};
 
@@ -123,90 +228,182 @@ struct ImplementIntefaceCodeActionLibclangBasedImpl
         return {.node = result, .source_manager = &source_manager};
     }
 
-    ClangClassRecord find_interface()
+    //! Resolves the interfaces in the order of the interface names. The duplicated names are resolved once.
+    std::vector<ClangClassRecord> find_interfaces() const
     {
-        const auto& iface_name{parameters.inteface_name};
-        std::string class_definition_regex{"\\b(struct|class)\\s+" + iface_name + "\\b"};
-        auto file_matches{
-            codebase_grep(RootDirectory(parameters.root_directory), EcmaScriptPattern{class_definition_regex})};
+        std::vector<ClangClassRecord> result;
+        result.reserve(parameters.interface_names.size());
+
+        std::vector<std::string_view> resolved_names;
+        resolved_names.reserve(parameters.interface_names.size());
 
+        for (const auto& iface_name : parameters.interface_names)
+        {
+            if (std::ranges::find(resolved_names, iface_name) != std::end(resolved_names))
+                continue;
+            result.emplace_back(find_interface(iface_name));
+            resolved_names.emplace_back(iface_name);
+        }
+
+        return result;
+    }
+
+    ClangClassRecord find_interface(const std::string& iface_name) const
+    {
+        if (auto result{find_abstract_class(interface_candidate_parsed_files, iface_name)}; result)
+            return *result;
+        throw BaseError{"No interface named: " + iface_name + " found under the project root directory!"};
+    }
+
+    static std::optional<ClangClassRecord> find_abstract_class(const std::vector<TakenParsedFile>& parsed_files,
+                                                               const std::string& name)
+    {
         auto abstract_class_matcher{
-            ast_matchers::cxxRecordDecl(isAbstract(), ast_matchers::hasName(iface_name)).bind("abstract class")};
+            ast_matchers::cxxRecordDecl(isAbstract(), ast_matchers::hasName(name)).bind("abstract class")};
 
-        for (const auto& file_match : file_matches)
+        for (const auto& parsed_file : parsed_files)
         {
-            build_and_append_ast_unit(file_match.path);
-            auto& ast_unit{*ast_units.back()};
-            auto match_result{ast_matchers::match(abstract_class_matcher, ast_unit.getASTContext())};
+            const auto& ast_unit{parsed_file->ast_unit};
+            if (ast_unit == nullptr)
+                continue;
+
+            auto match_result{ast_matchers::match(abstract_class_matcher, ast_unit->getASTContext())};
             if (match_result.size() == 0)
                 continue;
 
             const auto& first_match{match_result[0]};
-            return {.node = first_match.getNodeAs<CXXRecordDecl>("abstract class"),
-                    .source_manager = &ast_unit.getSourceManager()};
+            return ClangClassRecord{.node = first_match.getNodeAs<CXXRecordDecl>("abstract class"),
+                                    .source_manager = &ast_unit->getSourceManager()};
         }
-
-        throw BaseError{"No interface with the specified name found under the project root directory!"};
+        return std::nullopt;
     }
 
-    void build_and_append_ast_unit(const std::filesystem::path& path)
+    //! Makes a single block of include statements, one per each interface header, which is not included yet.
+    CodeInsertionByOffset get_include_statements_code_insertion() const
     {
-        ClangTool tool{*compilation_database, {path.string()}};
-        tool.buildASTs(ast_units);
-    }
+        auto included_files{find_files_seen_by_implementor()};
 
-    CodeInsertionByOffset get_include_statement_code_insertion() const
-    {
-        auto interface_header_path{interface_.source_manager->getFilename(interface_.node->getLocation()).str()};
-        if (is_include_already_in_place(interface_header_path))
+        std::vector<fs::path> header_paths;
+        header_paths.reserve(interfaces.size());
+        for (const auto& iface : interfaces)
+        {
+            auto header_path{get_absolute_file_path(iface.node->getLocation(), *iface.source_manager)};
+            if (header_path.empty() or included_files.contains(header_path) or is_include_already_in_place(header_path))
+                continue;
+            if (std::ranges::find(header_paths, header_path) == std::end(header_paths))
+                header_paths.emplace_back(std::move(header_path));
+        }
+
+        if (header_paths.empty())
             return {};
 
         auto include_statement_place{Tsepepe::resolve_include_statement_place(parameters.source_file_content)};
+        auto search_paths{get_implementor_include_search_paths()};
+
+        StringBuilder code{1 + header_paths.size() * include_statement_reserved_size};
+        if (include_statement_place.is_newline_needed)
+            code.append('\n');
+        for (const auto& header_path : header_paths)
+        {
+            code.append("#include ");
+            // The bare filename is the last resort, when the header is out of reach of all the search directories.
+            if (auto spelling{spell_include(header_path, implementor_file_path, search_paths)}; spelling)
+                code.append(*spelling);
+            else
+                code.append('"').append(header_path.filename().string()).append('"');
+            code.append('\n');
+        }
+        return {.code = code.take(), .offset = include_statement_place.offset};
+    }
+
+    //! The source file itself, and the files it includes, directly or not; known from the implementor parse already.
+    std::set<fs::path> find_files_seen_by_implementor() const
+    {
+        std::set<fs::path> result;
+        std::error_code error_code;
+        if (auto source_file_path{fs::weakly_canonical(parameters.source_file_path, error_code)}; not error_code)
+            result.emplace(std::move(source_file_path));
+
+        const auto& source_manager{implementor_parsed_file->ast_unit->getSourceManager()};
+        for (auto it{source_manager.fileinfo_begin()}; it != source_manager.fileinfo_end(); ++it)
+        {
+            const FileEntry* file_entry{it->first};
+            if (auto real_path{file_entry->tryGetRealPathName()}; not real_path.empty())
+                result.emplace(real_path.str());
+        }
+        return result;
+    }
 
-        std::string code{include_statement_place.is_newline_needed ? "\n" : ""};
-        code += "#include \"" + fs::path(interface_header_path).filename().string() + "\"\n";
-        return {.code = std::move(code), .offset = include_statement_place.offset};
+    IncludeSearchPaths get_implementor_include_search_paths() const
+    {
+        auto compile_commands{compilation_database->getCompileCommands(implementor_file_path)};
+        if (compile_commands.empty())
+            return {};
+        return parse_include_search_paths(compile_commands.front());
     }
 
     bool is_include_already_in_place(const fs::path& header_path) const
     {
         const auto& header_filename{header_path.filename()};
         std::regex re{"#include\\s+\".*?" + header_filename.string() + "\""};
-        return std::regex_search(parameters.source_file_content, re);
+        auto file_content{parameters.source_file_content.view()};
+        return std::regex_search(std::begin(file_content), std::end(file_content), re);
     }
 
+    //! Puts the overrides of all the interfaces together. A method shared by several interfaces is overridden once.
     CodeInsertionByOffset get_overrides_code_insertion() const
     {
-        auto indentation{
-            (Lexer::getIndentationForLine(implementor.node->getLocation(), *implementor.source_manager) + "    ")
-                .str()};
+        auto class_indentation{
+            Lexer::getIndentationForLine(implementor.node->getLocation(), *implementor.source_manager)};
 
         std::string implementor_full_name{implementor.node->getQualifiedNameAsString()};
-        auto method_overrides{Tsepepe::pure_virtual_functions_to_override_declarations(
-            interface_.node, implementor_full_name, *interface_.source_manager)};
+        OverrideDeclarations method_overrides;
+        for (const auto& iface : interfaces)
+        {
+            auto interface_method_overrides{Tsepepe::pure_virtual_functions_to_override_declarations(
+                iface.node, implementor_full_name, *iface.source_manager, code_generation_cache)};
+            for (auto& override_ : interface_method_overrides)
+                if (std::ranges::find(method_overrides, override_) == std::end(method_overrides))
+                    method_overrides.emplace_back(std::move(override_));
+        }
+
         auto method_overrides_place{Tsepepe::find_suitable_place_in_class_for_public_method(
             parameters.source_file_content, implementor.node, *implementor.source_manager)};
 
-        std::string code{method_overrides_place.is_public_section_needed ? "public:\n" : ""};
-        for (auto& override_ : method_overrides)
-        {
-            code += indentation;
-            code += std::move(override_);
-            code += '\n';
-        }
-        return {.code = std::move(code), .offset = method_overrides_place.offset};
+        std::string_view public_section{method_overrides_place.is_public_section_needed ? "public:\n" : ""};
+        std::size_t code_size{public_section.size()};
+        for (const auto& override_ : method_overrides)
+            code_size += class_indentation.size() + method_indentation.size() + override_.size() + 1;
+
+        StringBuilder code{code_size};
+        code.append(public_section);
+        for (const auto& override_ : method_overrides)
+            code.append(class_indentation).append(method_indentation).append(override_).append('\n');
+        return {.code = code.take(), .offset = method_overrides_place.offset};
     }
 
-    std::shared_ptr<CompilationDatabase> compilation_database;
-    std::vector<std::unique_ptr<clang::ASTUnit>> ast_units;
+    //! The overrides are indented by one level, relative to the class.
+    static constexpr std::string_view method_indentation{"    "};
+    //! Enough for most of the include statements, so that the block allocates once.
+    static constexpr std::size_t include_statement_reserved_size{64};
 
-    DirectoryTree tsepepe_temp_directory_tree;
-    DirectoryTree this_code_action_directory_tree;
+    std::shared_ptr<CompilationDatabase> compilation_database;
+    CodeGenerationCache* code_generation_cache;
+    ParsedFileCache* parsed_file_cache;
+    ClangdIndex* clangd_index;
 
     ImplementInterfaceCodeActionParameters parameters;
 
+    //! Declared before the candidates, since set while they are looked for.
+    bool are_interface_candidates_indexed{false};
+    std::vector<fs::path> interface_candidate_files;
+    std::string implementor_file_path;
+    //! Declared before the class records, which refer to their ASTs.
+    TakenParsedFile implementor_parsed_file;
+    std::vector<TakenParsedFile> interface_candidate_parsed_files;
+
     ClangClassRecord implementor;
-    ClangClassRecord interface_;
+    std::vector<ClangClassRecord> interfaces;
 };
 } // namespace Tsepepe
 
@@ -214,15 +411,26 @@ struct ImplementIntefaceCodeActionLibclangBasedImpl
 // Public stuff
 // --------------------------------------------------------------------------------------------------------------------
 Tsepepe::ImplementIntefaceCodeActionLibclangBased::ImplementIntefaceCodeActionLibclangBased(
-    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db) :
-    compilation_database(std::move(comp_db))
+    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db,
+    std::shared_ptr<CodeGenerationCache> cache,
+    std::shared_ptr<ParsedFileCache> parsed_files,
+    std::shared_ptr<ClangdIndex> clangd_index_) :
+    compilation_database(std::move(comp_db)),
+    code_generation_cache(std::move(cache)),
+    parsed_file_cache(std::move(parsed_files)),
+    clangd_index(std::move(clangd_index_))
 {
 }
 
 Tsepepe::NewFileContent
 Tsepepe::ImplementIntefaceCodeActionLibclangBased::apply(ImplementInterfaceCodeActionParameters params)
 {
-    return ImplementIntefaceCodeActionLibclangBasedImpl{compilation_database, std::move(params)}.apply();
+    return ImplementIntefaceCodeActionLibclangBasedImpl{compilation_database,
+                                                        code_generation_cache.get(),
+                                                        parsed_file_cache.get(),
+                                                        clangd_index.get(),
+                                                        std::move(params)}
+        .apply();
 }
 
 // --------------------------------------------------------------------------------------------------------------------
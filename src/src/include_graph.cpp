@@ -0,0 +1,360 @@
+/**
+ * @file	include_graph.cpp
+ * @brief	Implements the IncludeGraph and its builder.
+ */
+#include "include_graph.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <system_error>
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/xxhash.h>
+
+#include "bulk_file_reader.hpp"
+#include "include_resolver.hpp"
+#include "index_segment.hpp"
+#include "parallel_utils.hpp"
+#include "translation_unit_cache.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang::tooling;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private data types
+// --------------------------------------------------------------------------------------------------------------------
+namespace
+{
+
+struct FileRecord
+{
+    std::uint64_t content_hash;
+    std::vector<Tsepepe::IncludeDirective> include_directives;
+};
+
+using FileRecords = std::map<std::string, FileRecord>;
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+//! Bump it whenever the cached data layout, or the way it is produced, changes.
+static constexpr std::int64_t cache_format_version{1};
+static constexpr const char* cache_file_name{"include_graph.json"};
+
+static llvm::json::Value to_json(const FileRecord&);
+static std::optional<FileRecord> file_record_from_json(const llvm::json::Object&);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace Tsepepe
+{
+
+struct IncludeGraphBuilderLibclangBasedImpl
+{
+    explicit IncludeGraphBuilderLibclangBasedImpl(std::shared_ptr<CompilationDatabase> comp_db,
+                                                  IncludeGraphParameters params) :
+        compilation_database{std::move(comp_db)},
+        parameters{std::move(params)},
+        root_directory{fs::weakly_canonical(fs::absolute(parameters.root_directory))}
+    {
+    }
+
+    IncludeGraph build()
+    {
+        // A single process at a time scans; the others wait, and then find its results cached.
+        std::optional<IndexWriterLock> writer_lock;
+        if (not parameters.cache_directory.empty())
+            writer_lock.emplace(fs::path{parameters.cache_directory / cache_file_name}.concat(".lock"));
+
+        cached_records = load_cache();
+        preload_cached_files();
+
+        auto translation_units{compilation_database->getAllFiles()};
+        std::vector<std::vector<IncludeGraph::Edge>> translation_unit_edges(translation_units.size());
+        utils::parallel_for(translation_units.size(), [&](std::size_t index) {
+            translation_unit_edges[index] = walk(translation_units[index]);
+        });
+
+        store_cache();
+
+        std::vector<IncludeGraph::Edge> edges;
+        for (auto& translation_unit_edge : translation_unit_edges)
+            std::ranges::move(translation_unit_edge, std::back_inserter(edges));
+        return IncludeGraph{edges};
+    }
+
+  private:
+    //! Follows the includes from the main file of the translation unit, resolving them with its search paths.
+    std::vector<IncludeGraph::Edge> walk(const std::string& translation_unit)
+    {
+        auto compile_commands{compilation_database->getCompileCommands(translation_unit)};
+        if (compile_commands.empty())
+            return {};
+
+        std::error_code error_code;
+        const auto& compile_command{compile_commands.front()};
+        auto main_file{fs::weakly_canonical(fs::path{compile_command.Directory} / translation_unit, error_code)};
+        if (error_code or not is_within_directory(main_file, root_directory))
+            return {};
+        auto search_paths{parse_include_search_paths(compile_command)};
+
+        std::vector<IncludeGraph::Edge> result;
+        std::set<fs::path> visited_files{main_file};
+        std::vector<fs::path> pending_files{main_file};
+        while (not pending_files.empty())
+        {
+            auto file{std::move(pending_files.back())};
+            pending_files.pop_back();
+
+            for (const auto& include_directive : get_include_directives(file))
+            {
+                auto header{resolve_include(include_directive, file, search_paths)};
+                if (not header or not is_within_directory(*header, root_directory))
+                    continue;
+
+                result.emplace_back(file, *header);
+                if (visited_files.insert(*header).second)
+                    pending_files.push_back(std::move(*header));
+            }
+        }
+        return result;
+    }
+
+    //! Each file is read once per build, no matter how many translation units include it.
+    std::vector<IncludeDirective> get_include_directives(const fs::path& file)
+    {
+        auto path{file.string()};
+        {
+            std::lock_guard lock{records_mutex};
+            if (auto it{records.find(path)}; it != std::end(records))
+                return it->second.include_directives;
+        }
+
+        std::optional<FileRecord> record;
+        if (auto it{preloaded_records.find(path)}; it != std::end(preloaded_records))
+            record = it->second;
+        else if (auto buffer{llvm::MemoryBuffer::getFile(path)}; buffer)
+            record = make_record(path, (*buffer)->getBuffer());
+        if (not record)
+            return {};
+
+        auto result{record->include_directives};
+        std::lock_guard lock{records_mutex};
+        records.insert_or_assign(std::move(path), std::move(*record));
+        return result;
+    }
+
+    //! The files walked by the previous build are read in bulk, up front; the new ones are read as they are found.
+    void preload_cached_files()
+    {
+        std::vector<fs::path> files;
+        files.reserve(cached_records.size());
+        for (const auto& [path, record] : cached_records)
+            files.emplace_back(path);
+
+        read_files_in_bulk(files, [&](std::size_t file_index, std::optional<llvm::StringRef> source_code) {
+            if (source_code)
+            {
+                auto path{files[file_index].string()};
+                auto record{make_record(path, *source_code)};
+                preloaded_records.emplace(std::move(path), std::move(record));
+            }
+        });
+    }
+
+    FileRecord make_record(const std::string& path, llvm::StringRef source_code) const
+    {
+        FileRecord result{.content_hash = llvm::xxHash64(source_code)};
+        if (auto it{cached_records.find(path)};
+            it != std::end(cached_records) and it->second.content_hash == result.content_hash)
+            result.include_directives = it->second.include_directives;
+        else
+            result.include_directives = scan_include_directives(source_code);
+        return result;
+    }
+
+    FileRecords load_cache() const
+    {
+        FileRecords result;
+        if (parameters.cache_directory.empty())
+            return result;
+
+        for (const auto& [path, value] :
+             load_cache_records(parameters.cache_directory / cache_file_name, cache_format_version, "files"))
+            if (auto object{value.getAsObject()}; object != nullptr)
+                if (auto record{file_record_from_json(*object)}; record)
+                    result.emplace(path.str(), std::move(*record));
+        return result;
+    }
+
+    //! Only the files walked by this build are stored, so the removed files drop out of the cache.
+    void store_cache() const
+    {
+        if (parameters.cache_directory.empty())
+            return;
+
+        llvm::json::Object files_json;
+        for (const auto& [path, record] : records)
+            files_json[path] = to_json(record);
+
+        store_cache_records(
+            parameters.cache_directory / cache_file_name, cache_format_version, "files", std::move(files_json));
+    }
+
+    std::shared_ptr<CompilationDatabase> compilation_database;
+    IncludeGraphParameters parameters;
+    fs::path root_directory;
+
+    FileRecords cached_records;
+    //! Read before the walk; only the files walked again get to the records, and thus to the cache.
+    FileRecords preloaded_records;
+    std::mutex records_mutex;
+    FileRecords records;
+};
+
+} // namespace Tsepepe
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::IncludeGraph::IncludeGraph(const std::vector<Edge>& edges)
+{
+    for (const auto& [includer, header] : edges)
+    {
+        paths.push_back(includer);
+        paths.push_back(header);
+    }
+    std::ranges::sort(paths);
+    auto duplicated_paths{std::ranges::unique(paths)};
+    paths.erase(std::begin(duplicated_paths), std::end(duplicated_paths));
+    paths.shrink_to_fit();
+
+    // Many translation units walk the same headers, so most of the edges are duplicated.
+    std::vector<std::pair<FileId, FileId>> file_id_edges;
+    file_id_edges.reserve(edges.size());
+    for (const auto& [includer, header] : edges)
+        file_id_edges.emplace_back(*find(includer), *find(header));
+    std::ranges::sort(file_id_edges);
+    auto duplicated_edges{std::ranges::unique(file_id_edges)};
+    file_id_edges.erase(std::begin(duplicated_edges), std::end(duplicated_edges));
+
+    include_offsets.assign(paths.size() + 1, 0);
+    for (const auto& edge : file_id_edges)
+        ++include_offsets[edge.first + 1];
+    std::partial_sum(std::begin(include_offsets), std::end(include_offsets), std::begin(include_offsets));
+
+    includes.reserve(file_id_edges.size());
+    for (const auto& edge : file_id_edges)
+        includes.push_back(edge.second);
+}
+
+std::size_t Tsepepe::IncludeGraph::size() const
+{
+    return paths.size();
+}
+
+const fs::path& Tsepepe::IncludeGraph::get_path(FileId id) const
+{
+    return paths[id];
+}
+
+std::optional<Tsepepe::IncludeGraph::FileId> Tsepepe::IncludeGraph::find(const fs::path& path) const
+{
+    auto it{std::ranges::lower_bound(paths, path)};
+    if (it == std::end(paths) or *it != path)
+        return std::nullopt;
+    return static_cast<FileId>(std::distance(std::begin(paths), it));
+}
+
+std::span<const Tsepepe::IncludeGraph::FileId> Tsepepe::IncludeGraph::get_direct_includes(FileId id) const
+{
+    return std::span{includes}.subspan(include_offsets[id], include_offsets[id + 1] - include_offsets[id]);
+}
+
+bool Tsepepe::IncludeGraph::is_included(const fs::path& header, const fs::path& includer) const
+{
+    auto header_id{find(header)};
+    auto includer_id{find(includer)};
+    if (not header_id or not includer_id)
+        return false;
+
+    std::vector<bool> visited(paths.size());
+    std::vector<FileId> pending{*includer_id};
+    visited[*includer_id] = true;
+    while (not pending.empty())
+    {
+        auto id{pending.back()};
+        pending.pop_back();
+        for (auto included_id : get_direct_includes(id))
+        {
+            if (included_id == *header_id)
+                return true;
+            if (not visited[included_id])
+            {
+                visited[included_id] = true;
+                pending.push_back(included_id);
+            }
+        }
+    }
+    return false;
+}
+
+Tsepepe::IncludeGraphBuilderLibclangBased::IncludeGraphBuilderLibclangBased(
+    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db) :
+    compilation_database{std::move(comp_db)}
+{
+}
+
+Tsepepe::IncludeGraph Tsepepe::IncludeGraphBuilderLibclangBased::build(IncludeGraphParameters params)
+{
+    return IncludeGraphBuilderLibclangBasedImpl{compilation_database, std::move(params)}.build();
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static llvm::json::Value to_json(const FileRecord& record)
+{
+    llvm::json::Array include_directives;
+    for (const auto& include_directive : record.include_directives)
+        include_directives.push_back(
+            llvm::json::Object{{"spelling", include_directive.spelling}, {"is_angled", include_directive.is_angled}});
+
+    // The hash is stored as a hex string, since the JSON integers are signed.
+    return llvm::json::Object{{"content_hash", llvm::utohexstr(record.content_hash)},
+                              {"include_directives", std::move(include_directives)}};
+}
+
+static std::optional<FileRecord> file_record_from_json(const llvm::json::Object& object)
+{
+    FileRecord result;
+    auto content_hash{object.getString("content_hash")};
+    if (not content_hash or content_hash->getAsInteger(16, result.content_hash))
+        return std::nullopt;
+
+    auto include_directives{object.getArray("include_directives")};
+    if (include_directives == nullptr)
+        return std::nullopt;
+    for (const auto& value : *include_directives)
+    {
+        auto include_directive{value.getAsObject()};
+        if (include_directive == nullptr)
+            return std::nullopt;
+        auto spelling{include_directive->getString("spelling")};
+        auto is_angled{include_directive->getBoolean("is_angled")};
+        if (not spelling or not is_angled)
+            return std::nullopt;
+        result.include_directives.push_back({.spelling = spelling->str(), .is_angled = *is_angled});
+    }
+    return result;
+}
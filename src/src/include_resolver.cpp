@@ -0,0 +1,195 @@
+/**
+ * @file	include_resolver.cpp
+ * @brief	Implements the include directives resolution and the include path spelling.
+ */
+#include "include_resolver.hpp"
+
+#include <array>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include <clang/Basic/LangOptions.h>
+#include <clang/Lex/Lexer.h>
+
+#include "translation_unit_cache.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+using SearchDirectories = std::vector<fs::path> Tsepepe::IncludeSearchPaths::*;
+
+//! The longer of the options sharing a prefix go first.
+static constexpr std::array<std::pair<std::string_view, SearchDirectories>, 5> search_path_options{
+    {{"--include-directory=", &Tsepepe::IncludeSearchPaths::angled_directories},
+     {"-I", &Tsepepe::IncludeSearchPaths::angled_directories},
+     {"-iquote", &Tsepepe::IncludeSearchPaths::quote_directories},
+     {"-isystem", &Tsepepe::IncludeSearchPaths::system_directories},
+     {"-idirafter", &Tsepepe::IncludeSearchPaths::system_directories}}};
+
+static bool is_include_keyword(llvm::StringRef);
+static std::optional<fs::path> find_regular_file(const fs::path& candidate);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::IncludeSearchPaths Tsepepe::parse_include_search_paths(const clang::tooling::CompileCommand& compile_command)
+{
+    IncludeSearchPaths result;
+    const auto& command_line{compile_command.CommandLine};
+    // The first argument is the compiler.
+    for (std::size_t i{1}; i < command_line.size(); ++i)
+    {
+        std::string_view argument{command_line[i]};
+        for (auto [option, directories] : search_path_options)
+        {
+            if (not argument.starts_with(option))
+                continue;
+
+            std::string_view directory{argument.substr(option.size())};
+            if (directory.empty() and i + 1 < command_line.size())
+                directory = command_line[++i];
+            if (not directory.empty())
+                (result.*directories).push_back((fs::path{compile_command.Directory} / directory).lexically_normal());
+            break;
+        }
+    }
+    return result;
+}
+
+std::vector<Tsepepe::IncludeDirective> Tsepepe::scan_include_directives(llvm::StringRef source_code)
+{
+    LangOptions lang_options;
+    lang_options.CPlusPlus = true;
+    lang_options.CPlusPlus11 = true;
+    lang_options.LineComment = true;
+
+    // A raw lexer needs no source manager, nor preprocessor; it just splits the code into tokens.
+    Lexer lexer{SourceLocation{}, lang_options, source_code.begin(), source_code.begin(), source_code.end()};
+
+    std::vector<IncludeDirective> result;
+    Token token;
+    lexer.LexFromRawLexer(token);
+    while (token.isNot(tok::eof))
+    {
+        if (token.isNot(tok::hash) or not token.isAtStartOfLine())
+        {
+            lexer.LexFromRawLexer(token);
+            continue;
+        }
+
+        // Each token starting a line may start the next directive, so it is not consumed on a mismatch.
+        lexer.LexFromRawLexer(token);
+        if (token.isAtStartOfLine() or token.isNot(tok::raw_identifier)
+            or not is_include_keyword(token.getRawIdentifier()))
+            continue;
+
+        lexer.LexFromRawLexer(token);
+        if (token.isAtStartOfLine())
+            continue;
+
+        if (token.is(tok::string_literal))
+        {
+            llvm::StringRef literal{token.getLiteralData(), token.getLength()};
+            if (literal.size() >= 2 and literal.front() == '"')
+                result.push_back({.spelling = literal.drop_front().drop_back().str(), .is_angled = false});
+            lexer.LexFromRawLexer(token);
+        } else if (token.is(tok::less))
+        {
+            // The header name is not a single token for the raw lexer, so it is taken straight from the code.
+            auto spelling_begin{lexer.getBufferLocation()};
+            do
+                lexer.LexFromRawLexer(token);
+            while (token.isNot(tok::greater) and token.isNot(tok::eof) and not token.isAtStartOfLine());
+
+            if (token.is(tok::greater) and not token.isAtStartOfLine())
+            {
+                auto spelling_end{lexer.getBufferLocation() - token.getLength()};
+                result.push_back({.spelling = std::string{spelling_begin, spelling_end}, .is_angled = true});
+                lexer.LexFromRawLexer(token);
+            }
+        }
+    }
+    return result;
+}
+
+std::optional<fs::path> Tsepepe::resolve_include(const IncludeDirective& directive,
+                                                 const fs::path& includer,
+                                                 const IncludeSearchPaths& search_paths)
+{
+    fs::path spelling{directive.spelling};
+    if (spelling.is_absolute())
+        return find_regular_file(spelling);
+
+    if (not directive.is_angled)
+    {
+        if (auto file{find_regular_file(includer.parent_path() / spelling)}; file)
+            return file;
+        for (const auto& directory : search_paths.quote_directories)
+            if (auto file{find_regular_file(directory / spelling)}; file)
+                return file;
+    }
+    for (const auto& directory : search_paths.angled_directories)
+        if (auto file{find_regular_file(directory / spelling)}; file)
+            return file;
+    for (const auto& directory : search_paths.system_directories)
+        if (auto file{find_regular_file(directory / spelling)}; file)
+            return file;
+    return std::nullopt;
+}
+
+std::optional<std::string> Tsepepe::spell_include(const fs::path& header,
+                                                  const fs::path& includer,
+                                                  const IncludeSearchPaths& search_paths)
+{
+    std::error_code error_code;
+    auto canonical_header{fs::weakly_canonical(header, error_code)};
+    if (error_code)
+        return std::nullopt;
+
+    std::optional<std::string> result;
+    auto try_directory{[&](const fs::path& directory, bool is_angled) {
+        auto canonical_directory{fs::weakly_canonical(directory, error_code)};
+        if (error_code or not is_within_directory(canonical_header, canonical_directory))
+            return;
+
+        auto spelling{canonical_header.lexically_relative(canonical_directory).generic_string()};
+        // On a tie the directory searched earlier wins, hence the quotes are preferred.
+        if (result and result->size() <= spelling.size() + 2)
+            return;
+        if (resolve_include({.spelling = spelling, .is_angled = is_angled}, includer, search_paths) != canonical_header)
+            return;
+        result = is_angled ? '<' + spelling + '>' : '"' + spelling + '"';
+    }};
+
+    try_directory(includer.parent_path(), false);
+    for (const auto& directory : search_paths.quote_directories)
+        try_directory(directory, false);
+    for (const auto& directory : search_paths.angled_directories)
+        try_directory(directory, false);
+    for (const auto& directory : search_paths.system_directories)
+        try_directory(directory, true);
+    return result;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static bool is_include_keyword(llvm::StringRef identifier)
+{
+    return identifier == "include" or identifier == "include_next" or identifier == "import";
+}
+
+static std::optional<fs::path> find_regular_file(const fs::path& candidate)
+{
+    std::error_code error_code;
+    if (not fs::is_regular_file(candidate, error_code))
+        return std::nullopt;
+    auto result{fs::weakly_canonical(candidate, error_code)};
+    if (error_code)
+        return std::nullopt;
+    return result;
+}
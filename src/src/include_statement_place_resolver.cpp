@@ -8,14 +8,15 @@
 #include <optional>
 #include <regex>
 #include <string>
+#include <string_view>
 
 using namespace Tsepepe;
 
 // --------------------------------------------------------------------------------------------------------------------
 // Helper declaration
 // --------------------------------------------------------------------------------------------------------------------
-static std::optional<unsigned> find_last_local_include_statement_end_offset(const std::string& cpp_file_content);
-static std::optional<unsigned> find_last_global_include_statement_end_offset(const std::string& cpp_file_content);
+static std::optional<unsigned> find_last_local_include_statement_end_offset(std::string_view cpp_file_content);
+static std::optional<unsigned> find_last_global_include_statement_end_offset(std::string_view cpp_file_content);
 
 /** @brief Finds the include guard heading end offset.
  *  @returns  The offset of the beginning of the line just below the include guard heading.
@@ -27,14 +28,14 @@ static std::optional<unsigned> find_last_global_include_statement_end_offset(con
  *
  *      #endif / * SOME_HEADER_HPP * /
  */
-static std::optional<unsigned> find_include_guard_heading_end_offset(const std::string& cpp_file_content);
-static std::optional<unsigned> find_pragma_once_end_offset(const std::string& cpp_file_content);
-static std::optional<unsigned> find_header_comment_end_offset(const std::string& cpp_file_content);
+static std::optional<unsigned> find_include_guard_heading_end_offset(std::string_view cpp_file_content);
+static std::optional<unsigned> find_pragma_once_end_offset(std::string_view cpp_file_content);
+static std::optional<unsigned> find_header_comment_end_offset(std::string_view cpp_file_content);
 
 // --------------------------------------------------------------------------------------------------------------------
 // Public stuff
 // --------------------------------------------------------------------------------------------------------------------
-Tsepepe::IncludeStatementPlace Tsepepe::resolve_include_statement_place(const std::string& cpp_file_content)
+Tsepepe::IncludeStatementPlace Tsepepe::resolve_include_statement_place(std::string_view cpp_file_content)
 {
     if (auto maybe_last_local_include_end_offset{find_last_local_include_statement_end_offset(cpp_file_content)};
         maybe_last_local_include_end_offset)
@@ -63,7 +64,7 @@ Tsepepe::IncludeStatementPlace Tsepepe::resolve_include_statement_place(const st
 // --------------------------------------------------------------------------------------------------------------------
 // Helper definition
 // --------------------------------------------------------------------------------------------------------------------
-static std::optional<unsigned> find_last_local_include_statement_end_offset(const std::string& cpp_file_content)
+static std::optional<unsigned> find_last_local_include_statement_end_offset(std::string_view cpp_file_content)
 {
     // FIXME: apply DRY "find_last_match()"
     std::regex re{"\n?[ \t\f\v]*\".*\"\\s+edulcni#"};
@@ -76,7 +77,7 @@ static std::optional<unsigned> find_last_local_include_statement_end_offset(cons
     return std::distance(std::begin(cpp_file_content), match[0].first.base());
 }
 
-static std::optional<unsigned> find_last_global_include_statement_end_offset(const std::string& cpp_file_content)
+static std::optional<unsigned> find_last_global_include_statement_end_offset(std::string_view cpp_file_content)
 {
     // FIXME: apply DRY "find_last_match()"
     std::regex re{"\n?[ \t\f\v]*>.*<\\s+edulcni#"};
@@ -89,12 +90,12 @@ static std::optional<unsigned> find_last_global_include_statement_end_offset(con
     return std::distance(std::begin(cpp_file_content), match[0].first.base());
 }
 
-static std::optional<unsigned> find_include_guard_heading_end_offset(const std::string& cpp_file_content)
+static std::optional<unsigned> find_include_guard_heading_end_offset(std::string_view cpp_file_content)
 {
     // FIXME: apply DRY "find_first_match()"
     std::regex re{"ifndef\\s+\\w+\n#define\\s+\\w+.*\n"};
-    std::smatch match;
-    auto is_match_found{std::regex_search(cpp_file_content, match, re)};
+    std::match_results<std::string_view::const_iterator> match;
+    auto is_match_found{std::regex_search(std::begin(cpp_file_content), std::end(cpp_file_content), match, re)};
     if (not is_match_found)
         return {};
 
@@ -102,12 +103,12 @@ static std::optional<unsigned> find_include_guard_heading_end_offset(const std::
     return std::distance(std::begin(cpp_file_content), end);
 }
 
-static std::optional<unsigned> find_pragma_once_end_offset(const std::string& cpp_file_content)
+static std::optional<unsigned> find_pragma_once_end_offset(std::string_view cpp_file_content)
 {
     // FIXME: apply DRY "find_first_match()"
     std::regex re{"#pragma\\s+once\n?"};
-    std::smatch match;
-    auto is_match_found{std::regex_search(cpp_file_content, match, re)};
+    std::match_results<std::string_view::const_iterator> match;
+    auto is_match_found{std::regex_search(std::begin(cpp_file_content), std::end(cpp_file_content), match, re)};
     if (not is_match_found)
         return {};
 
@@ -115,11 +116,11 @@ static std::optional<unsigned> find_pragma_once_end_offset(const std::string& cp
     return std::distance(std::begin(cpp_file_content), end);
 }
 
-static std::optional<unsigned> find_header_comment_end_offset(const std::string& cpp_file_content)
+static std::optional<unsigned> find_header_comment_end_offset(std::string_view cpp_file_content)
 {
     std::regex re{"\\s*/\\*.*?\\*/[[:blank:]]*\n?", std::regex::extended};
-    std::smatch match;
-    auto is_match_found{std::regex_search(cpp_file_content, match, re)};
+    std::match_results<std::string_view::const_iterator> match;
+    auto is_match_found{std::regex_search(std::begin(cpp_file_content), std::end(cpp_file_content), match, re)};
     if (not is_match_found)
         return {};
 
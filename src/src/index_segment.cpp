@@ -0,0 +1,150 @@
+/**
+ * @file	index_segment.cpp
+ * @brief	Implements the IndexSegment and the IndexWriterLock.
+ */
+#include "index_segment.hpp"
+
+#include <cstring>
+#include <iterator>
+#include <system_error>
+#include <vector>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "base_error.hpp"
+
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private data types
+// --------------------------------------------------------------------------------------------------------------------
+namespace
+{
+
+struct Header
+{
+    Tsepepe::IndexSegmentMagic magic;
+    std::uint32_t format_version;
+    std::uint64_t payload_size;
+};
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static void create_parent_directories(const fs::path&);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::replace_file_atomically(const fs::path& file_path, llvm::ArrayRef<llvm::StringRef> content_parts)
+{
+    create_parent_directories(file_path);
+
+    int file_descriptor;
+    llvm::SmallString<256> temporary_file_path;
+    auto temporary_file_model{file_path.string() + ".%%%%%%%%.tmp"};
+    if (auto error_code{llvm::sys::fs::createUniqueFile(temporary_file_model, file_descriptor, temporary_file_path)})
+        throw BaseError{"Failed to create a file next to: " + file_path.string() + ": " + error_code.message()};
+
+    {
+        llvm::raw_fd_ostream os{file_descriptor, /* shouldClose = */ true};
+        for (auto content_part : content_parts)
+            os << content_part;
+        os.close();
+        if (os.has_error())
+        {
+            auto error_message{os.error().message()};
+            os.clear_error();
+            llvm::sys::fs::remove(temporary_file_path);
+            throw BaseError{"Failed to write the file: " + temporary_file_path.str().str() + ": " + error_message};
+        }
+    }
+
+    if (auto error_code{llvm::sys::fs::rename(temporary_file_path, file_path.string())})
+    {
+        llvm::sys::fs::remove(temporary_file_path);
+        throw BaseError{"Failed to replace the file: " + file_path.string() + ": " + error_code.message()};
+    }
+}
+
+void Tsepepe::IndexSegment::publish(const fs::path& segment_file_path,
+                                    IndexSegmentMagic magic,
+                                    std::uint32_t format_version,
+                                    llvm::ArrayRef<llvm::StringRef> payload_parts)
+{
+    Header header{.magic = magic, .format_version = format_version, .payload_size = 0};
+    for (auto payload_part : payload_parts)
+        header.payload_size += payload_part.size();
+
+    std::vector<llvm::StringRef> segment_parts{llvm::StringRef{reinterpret_cast<const char*>(&header), sizeof(header)}};
+    segment_parts.insert(std::end(segment_parts), std::begin(payload_parts), std::end(payload_parts));
+    replace_file_atomically(segment_file_path, segment_parts);
+}
+
+Tsepepe::IndexSegment::IndexSegment(const fs::path& segment_file_path,
+                                    IndexSegmentMagic magic,
+                                    std::uint32_t format_version)
+{
+    // Big enough files get mapped, rather than read.
+    auto file_buffer{llvm::MemoryBuffer::getFile(segment_file_path.string(),
+                                                 /* IsText = */ false,
+                                                 /* RequiresNullTerminator = */ false)};
+    if (not file_buffer)
+        throw BaseError{"Failed to read the segment file: " + segment_file_path.string() + ": "
+                        + file_buffer.getError().message()};
+    buffer = std::move(*file_buffer);
+
+    Header header;
+    auto data{buffer->getBuffer()};
+    if (data.size() < sizeof(header))
+        throw BaseError{"Not a valid segment file: " + segment_file_path.string()};
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (header.magic != magic or header.format_version != format_version
+        or data.size() != sizeof(header) + header.payload_size)
+        throw BaseError{"Not a valid segment file, or of another version: " + segment_file_path.string()};
+
+    payload = data.drop_front(sizeof(header));
+}
+
+llvm::StringRef Tsepepe::IndexSegment::get_payload() const
+{
+    return payload;
+}
+
+Tsepepe::IndexWriterLock::IndexWriterLock(const fs::path& lock_file_path)
+{
+    create_parent_directories(lock_file_path);
+
+    if (auto error_code{llvm::sys::fs::openFileForReadWrite(
+            lock_file_path.string(), file_descriptor, llvm::sys::fs::CD_OpenAlways, llvm::sys::fs::OF_None)})
+        throw BaseError{"Failed to open the lock file: " + lock_file_path.string() + ": " + error_code.message()};
+
+    if (auto error_code{llvm::sys::fs::lockFile(file_descriptor)})
+    {
+        llvm::sys::fs::closeFile(file_descriptor);
+        throw BaseError{"Failed to lock the file: " + lock_file_path.string() + ": " + error_code.message()};
+    }
+}
+
+Tsepepe::IndexWriterLock::~IndexWriterLock()
+{
+    llvm::sys::fs::unlockFile(file_descriptor);
+    llvm::sys::fs::closeFile(file_descriptor);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static void create_parent_directories(const fs::path& file_path)
+{
+    std::error_code error_code;
+    fs::create_directories(file_path.parent_path(), error_code);
+    if (error_code)
+        throw Tsepepe::BaseError{"Failed to create the directory: " + file_path.parent_path().string() + ": "
+                                 + error_code.message()};
+}
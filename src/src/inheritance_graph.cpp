@@ -0,0 +1,227 @@
+/**
+ * @file	inheritance_graph.cpp
+ * @brief	Implements the InheritanceGraph.
+ */
+#include "inheritance_graph.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+using namespace Tsepepe;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+using Edge = std::pair<InheritanceGraph::ClassId, InheritanceGraph::ClassId>;
+
+static std::string_view get_bare_name(std::string_view qualified_name);
+
+//! Fills the adjacency arrays from the edges, sorted by the source node.
+static void make_adjacency(std::size_t nodes_count,
+                           const std::vector<Edge>& edges,
+                           std::vector<std::uint32_t>& offsets,
+                           std::vector<InheritanceGraph::ClassId>& targets);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::InheritanceGraph::InheritanceGraph(const std::vector<IndexedClass>& classes)
+{
+    for (const auto& indexed_class : classes)
+    {
+        qualified_names.push_back(indexed_class.qualified_name);
+        std::ranges::copy(indexed_class.bases, std::back_inserter(qualified_names));
+    }
+    std::ranges::sort(qualified_names);
+    auto duplicates{std::ranges::unique(qualified_names)};
+    qualified_names.erase(std::begin(duplicates), std::end(duplicates));
+    qualified_names.shrink_to_fit();
+
+    abstract_flags.resize(qualified_names.size());
+    std::vector<Edge> edges;
+    for (const auto& indexed_class : classes)
+    {
+        auto id{intern(indexed_class.qualified_name)};
+        if (indexed_class.is_abstract)
+            abstract_flags[id] = true;
+        for (const auto& base : indexed_class.bases)
+            edges.emplace_back(id, intern(base));
+    }
+
+    // A class, which is seen at many locations, has its edges recorded many times.
+    std::ranges::sort(edges);
+    auto duplicated_edges{std::ranges::unique(edges)};
+    edges.erase(std::begin(duplicated_edges), std::end(duplicated_edges));
+    make_adjacency(qualified_names.size(), edges, base_offsets, bases);
+
+    for (auto& [derived_class, base] : edges)
+        std::swap(derived_class, base);
+    std::ranges::sort(edges);
+    make_adjacency(qualified_names.size(), edges, derived_class_offsets, derived_classes);
+
+    ids_by_bare_name.resize(qualified_names.size());
+    std::iota(std::begin(ids_by_bare_name), std::end(ids_by_bare_name), ClassId{0});
+    std::ranges::stable_sort(ids_by_bare_name, {}, [&](ClassId id) { return get_bare_name(qualified_names[id]); });
+}
+
+std::size_t Tsepepe::InheritanceGraph::size() const
+{
+    return qualified_names.size();
+}
+
+std::string_view Tsepepe::InheritanceGraph::get_qualified_name(ClassId id) const
+{
+    return qualified_names[id];
+}
+
+bool Tsepepe::InheritanceGraph::is_abstract(ClassId id) const
+{
+    return abstract_flags[id];
+}
+
+std::vector<InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::find(std::string_view name) const
+{
+    std::vector<ClassId> result;
+    if (name.starts_with("::"))
+    {
+        name.remove_prefix(2);
+        auto it{std::ranges::lower_bound(qualified_names, name, std::less<>{})};
+        if (it != std::end(qualified_names) and *it == name)
+            result.push_back(static_cast<ClassId>(std::distance(std::begin(qualified_names), it)));
+        return result;
+    }
+
+    // The ids of the same bare name are kept in order, so the result is sorted already.
+    auto scoped_name{"::" + std::string{name}};
+    auto [begin, end]{std::ranges::equal_range(
+        ids_by_bare_name, get_bare_name(name), {}, [&](ClassId id) { return get_bare_name(qualified_names[id]); })};
+    for (auto it{begin}; it != end; ++it)
+        if (const auto& qualified_name{qualified_names[*it]};
+            qualified_name == name or qualified_name.ends_with(scoped_name))
+            result.push_back(*it);
+    return result;
+}
+
+std::span<const InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::get_direct_bases(ClassId id) const
+{
+    return std::span{bases}.subspan(base_offsets[id], base_offsets[id + 1] - base_offsets[id]);
+}
+
+std::span<const InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::get_direct_derived_classes(ClassId id) const
+{
+    return std::span{derived_classes}.subspan(derived_class_offsets[id],
+                                              derived_class_offsets[id + 1] - derived_class_offsets[id]);
+}
+
+std::vector<InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::find_derived_classes(ClassId id,
+                                                                                       ClassFilter filter) const
+{
+    return traverse(id, derived_class_offsets, derived_classes, filter);
+}
+
+std::vector<InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::find_bases(ClassId id, ClassFilter filter) const
+{
+    return traverse(id, base_offsets, bases, filter);
+}
+
+std::vector<InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::find_implementors(ClassId id) const
+{
+    return find_derived_classes(id, ClassFilter::concrete_only);
+}
+
+std::vector<InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::find_interfaces(ClassId id) const
+{
+    return find_bases(id, ClassFilter::abstract_only);
+}
+
+std::vector<InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::find_abstract_classes(std::string_view prefix) const
+{
+    std::vector<ClassId> result;
+    for (ClassId id{0}; id < qualified_names.size(); ++id)
+    {
+        if (not abstract_flags[id])
+            continue;
+        std::string_view qualified_name{qualified_names[id]};
+        if (qualified_name.starts_with(prefix) or get_bare_name(qualified_name).starts_with(prefix))
+            result.push_back(id);
+    }
+    return result;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+InheritanceGraph::ClassId Tsepepe::InheritanceGraph::intern(std::string_view qualified_name) const
+{
+    auto it{std::ranges::lower_bound(qualified_names, qualified_name, std::less<>{})};
+    return static_cast<ClassId>(std::distance(std::begin(qualified_names), it));
+}
+
+std::vector<InheritanceGraph::ClassId> Tsepepe::InheritanceGraph::traverse(ClassId id,
+                                                                            const Offsets& offsets,
+                                                                            const std::vector<ClassId>& targets,
+                                                                            ClassFilter filter) const
+{
+    // The inheritance graph is acyclic, but the diamonds make some nodes reachable many times.
+    std::vector<bool> visited(qualified_names.size());
+    std::vector<ClassId> pending{id};
+    std::vector<ClassId> result;
+    visited[id] = true;
+    while (not pending.empty())
+    {
+        auto current{pending.back()};
+        pending.pop_back();
+        for (auto i{offsets[current]}; i < offsets[current + 1]; ++i)
+        {
+            auto next{targets[i]};
+            if (visited[next])
+                continue;
+            visited[next] = true;
+            pending.push_back(next);
+            if (matches(next, filter))
+                result.push_back(next);
+        }
+    }
+    std::ranges::sort(result);
+    return result;
+}
+
+bool Tsepepe::InheritanceGraph::matches(ClassId id, ClassFilter filter) const
+{
+    switch (filter)
+    {
+    case ClassFilter::abstract_only:
+        return abstract_flags[id];
+    case ClassFilter::concrete_only:
+        return not abstract_flags[id];
+    case ClassFilter::all:
+        break;
+    }
+    return true;
+}
+
+static std::string_view get_bare_name(std::string_view qualified_name)
+{
+    auto separator_position{qualified_name.rfind("::")};
+    return separator_position == std::string_view::npos ? qualified_name
+                                                        : qualified_name.substr(separator_position + 2);
+}
+
+static void make_adjacency(std::size_t nodes_count,
+                           const std::vector<Edge>& edges,
+                           std::vector<std::uint32_t>& offsets,
+                           std::vector<InheritanceGraph::ClassId>& targets)
+{
+    offsets.assign(nodes_count + 1, 0);
+    for (const auto& edge : edges)
+        ++offsets[edge.first + 1];
+    std::partial_sum(std::begin(offsets), std::end(offsets), std::begin(offsets));
+
+    targets.clear();
+    targets.reserve(edges.size());
+    for (const auto& edge : edges)
+        targets.push_back(edge.second);
+}
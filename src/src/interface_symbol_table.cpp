@@ -0,0 +1,279 @@
+/**
+ * @file	interface_symbol_table.cpp
+ * @brief	Implements the InterfaceSymbolTable.
+ */
+#include "interface_symbol_table.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include <llvm/ADT/StringExtras.h>
+
+#include "base_error.hpp"
+
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private data types
+// --------------------------------------------------------------------------------------------------------------------
+namespace
+{
+
+struct Header
+{
+    std::uint32_t entries_count;
+    std::uint32_t arena_size;
+};
+
+struct Match
+{
+    std::size_t entry_index;
+    unsigned proximity;
+    int score;
+    std::size_t bare_name_size;
+};
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static constexpr Tsepepe::IndexSegmentMagic table_magic{'T', 'S', 'I', 'T'};
+//! Bump it whenever the table layout changes.
+static constexpr std::uint32_t table_format_version{2};
+
+static std::string_view strip_scope(std::string_view qualified_name);
+static unsigned count_common_leading_components(const fs::path&, const fs::path&);
+static bool is_word_start(std::string_view text, std::size_t position);
+static std::optional<int> compute_fuzzy_score(std::string_view text, std::string_view pattern);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::InterfaceSymbolTable::write(const ClassIndex& class_index, const fs::path& table_file_path)
+{
+    std::vector<const IndexedClass*> interfaces;
+    for (const auto& indexed_class : class_index.classes)
+        if (indexed_class.is_abstract)
+            interfaces.push_back(&indexed_class);
+    std::ranges::sort(interfaces, [](const IndexedClass* lhs, const IndexedClass* rhs) {
+        return std::pair{strip_scope(lhs->qualified_name), std::string_view{lhs->qualified_name}}
+               < std::pair{strip_scope(rhs->qualified_name), std::string_view{rhs->qualified_name}};
+    });
+
+    std::string arena;
+    std::map<std::string, std::uint32_t> file_offsets;
+    std::vector<Entry> entries;
+    entries.reserve(interfaces.size());
+    for (const auto* interface : interfaces)
+    {
+        auto file{interface->location.file.string()};
+        auto [it, is_inserted]{file_offsets.try_emplace(file, static_cast<std::uint32_t>(arena.size()))};
+        if (is_inserted)
+            arena += file;
+
+        const auto& qualified_name{interface->qualified_name};
+        auto bare_name_position{qualified_name.size() - strip_scope(qualified_name).size()};
+        entries.push_back({.qualified_name_offset = static_cast<std::uint32_t>(arena.size()),
+                           .qualified_name_size = static_cast<std::uint32_t>(qualified_name.size()),
+                           .bare_name_position = static_cast<std::uint32_t>(bare_name_position),
+                           .file_offset = it->second,
+                           .file_size = static_cast<std::uint32_t>(file.size()),
+                           .line = interface->location.line});
+        arena += qualified_name;
+    }
+
+    if (arena.size() > std::numeric_limits<std::uint32_t>::max())
+        throw BaseError{"Too many symbols to store within the table: " + table_file_path.string()};
+
+    Header header{.entries_count = static_cast<std::uint32_t>(entries.size()),
+                  .arena_size = static_cast<std::uint32_t>(arena.size())};
+    IndexSegment::publish(
+        table_file_path,
+        table_magic,
+        table_format_version,
+        {llvm::StringRef{reinterpret_cast<const char*>(&header), sizeof(header)},
+         llvm::StringRef{reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry)},
+         arena});
+}
+
+Tsepepe::InterfaceSymbolTable::InterfaceSymbolTable(const fs::path& table_file_path) :
+    segment{table_file_path, table_magic, table_format_version}
+{
+    Header header;
+    auto data{segment.get_payload()};
+    if (data.size() < sizeof(header))
+        throw BaseError{"Not a valid table file: " + table_file_path.string()};
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (data.size() != sizeof(header) + std::size_t{header.entries_count} * sizeof(Entry) + header.arena_size)
+        throw BaseError{"Not a valid table file: " + table_file_path.string()};
+
+    entries_count = header.entries_count;
+    entries = data.data() + sizeof(header);
+    arena = std::string_view{entries + entries_count * sizeof(Entry), header.arena_size};
+}
+
+std::size_t Tsepepe::InterfaceSymbolTable::size() const
+{
+    return entries_count;
+}
+
+std::vector<Tsepepe::InterfaceCandidate>
+Tsepepe::InterfaceSymbolTable::complete(const InterfaceCompletionParameters& params) const
+{
+    if (params.max_results == 0)
+        return {};
+
+    // Many interfaces share a file, so the proximity is computed once per file.
+    auto current_directory{params.current_file.parent_path()};
+    std::unordered_map<std::uint32_t, unsigned> proximities;
+    auto get_proximity{[&](const Entry& entry) {
+        auto [it, is_inserted]{proximities.try_emplace(entry.file_offset)};
+        if (is_inserted)
+            it->second = count_common_leading_components(fs::path{get_file(entry)}.parent_path(), current_directory);
+        return it->second;
+    }};
+
+    std::vector<Match> matches;
+    if (params.mode == CompletionMode::prefix)
+    {
+        std::size_t low{0};
+        std::size_t high{entries_count};
+        while (low < high)
+        {
+            auto middle{low + (high - low) / 2};
+            if (get_bare_name(get_entry(middle)) < params.pattern)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        for (auto index{low}; index < entries_count; ++index)
+        {
+            auto entry{get_entry(index)};
+            auto bare_name{get_bare_name(entry)};
+            if (not bare_name.starts_with(params.pattern))
+                break;
+            matches.push_back({index, get_proximity(entry), 0, bare_name.size()});
+        }
+    } else
+    {
+        bool is_qualified_name_matched{params.pattern.find("::") != std::string::npos};
+        for (std::size_t index{0}; index < entries_count; ++index)
+        {
+            auto entry{get_entry(index)};
+            auto bare_name{get_bare_name(entry)};
+            auto score{
+                compute_fuzzy_score(is_qualified_name_matched ? get_qualified_name(entry) : bare_name, params.pattern)};
+            if (score)
+                matches.push_back({index, get_proximity(entry), *score, bare_name.size()});
+        }
+    }
+
+    auto is_ranked_higher{[](const Match& lhs, const Match& rhs) {
+        return std::tuple{rhs.proximity, rhs.score, lhs.bare_name_size, lhs.entry_index}
+               < std::tuple{lhs.proximity, lhs.score, rhs.bare_name_size, rhs.entry_index};
+    }};
+    auto results_count{std::min(params.max_results, matches.size())};
+    std::ranges::partial_sort(matches, std::begin(matches) + results_count, is_ranked_higher);
+
+    std::vector<InterfaceCandidate> result;
+    result.reserve(results_count);
+    for (std::size_t i{0}; i < results_count; ++i)
+    {
+        auto entry{get_entry(matches[i].entry_index)};
+        result.push_back({.qualified_name = std::string{get_qualified_name(entry)},
+                          .location = {.file = get_file(entry), .line = entry.line}});
+    }
+    return result;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::InterfaceSymbolTable::Entry Tsepepe::InterfaceSymbolTable::get_entry(std::size_t index) const
+{
+    // Copied out, since the mapped memory gives no alignment guarantees for the entries.
+    Entry result;
+    std::memcpy(&result, entries + index * sizeof(Entry), sizeof(Entry));
+    return result;
+}
+
+std::string_view Tsepepe::InterfaceSymbolTable::get_qualified_name(const Entry& entry) const
+{
+    if (entry.qualified_name_offset > arena.size())
+        return {};
+    return arena.substr(entry.qualified_name_offset, entry.qualified_name_size);
+}
+
+std::string_view Tsepepe::InterfaceSymbolTable::get_bare_name(const Entry& entry) const
+{
+    auto qualified_name{get_qualified_name(entry)};
+    return qualified_name.substr(std::min<std::size_t>(entry.bare_name_position, qualified_name.size()));
+}
+
+std::string_view Tsepepe::InterfaceSymbolTable::get_file(const Entry& entry) const
+{
+    if (entry.file_offset > arena.size())
+        return {};
+    return arena.substr(entry.file_offset, entry.file_size);
+}
+
+static std::string_view strip_scope(std::string_view qualified_name)
+{
+    auto separator_position{qualified_name.rfind("::")};
+    return separator_position == std::string_view::npos ? qualified_name
+                                                        : qualified_name.substr(separator_position + 2);
+}
+
+static unsigned count_common_leading_components(const fs::path& lhs, const fs::path& rhs)
+{
+    unsigned result{0};
+    for (auto lhs_it{std::begin(lhs)}, rhs_it{std::begin(rhs)};
+         lhs_it != std::end(lhs) and rhs_it != std::end(rhs) and *lhs_it == *rhs_it;
+         ++lhs_it, ++rhs_it)
+        ++result;
+    return result;
+}
+
+static bool is_word_start(std::string_view text, std::size_t position)
+{
+    if (position == 0)
+        return true;
+    auto previous{text[position - 1]};
+    return previous == '_' or previous == ':'
+           or (std::islower(static_cast<unsigned char>(previous))
+               and std::isupper(static_cast<unsigned char>(text[position])));
+}
+
+static std::optional<int> compute_fuzzy_score(std::string_view text, std::string_view pattern)
+{
+    // Each matched character scores; the consecutive ones, and the ones starting a word, score more.
+    int score{0};
+    std::size_t position{0};
+    std::optional<std::size_t> previous_match_position;
+    for (auto pattern_character : pattern)
+    {
+        auto lowered_character{llvm::toLower(pattern_character)};
+        while (position < text.size() and llvm::toLower(text[position]) != lowered_character)
+            ++position;
+        if (position == text.size())
+            return std::nullopt;
+
+        score += 1;
+        if (previous_match_position and *previous_match_position + 1 == position)
+            score += 5;
+        if (is_word_start(text, position))
+            score += 10;
+        previous_match_position = position++;
+    }
+    return score;
+}
@@ -5,7 +5,10 @@
 
 #include "libclang_utils/base_specifier_resolver.hpp"
 
+#include <algorithm>
+
 #include <clang/Lex/Lexer.h>
+#include <llvm/ADT/StringSet.h>
 
 #include "base_error.hpp"
 #include "common_types.hpp"
@@ -18,33 +21,60 @@ using namespace Tsepepe;
 // Private declarations
 // --------------------------------------------------------------------------------------------------------------------
 static SourceLocation get_end_of_token_before_opening_bracket(const CXXRecordDecl*, const SourceManager&);
-static bool is_already_deriving(const CXXRecordDecl* potentially_deriving_class, const CXXRecordDecl* base_class);
+//! The deriving class and the base classes may come from different ASTs, so they are compared by the qualified names.
+static llvm::StringSet<> get_all_base_names(const CXXRecordDecl*);
 
 // --------------------------------------------------------------------------------------------------------------------
 // Public stuff
 // --------------------------------------------------------------------------------------------------------------------
-CodeInsertionByOffset Tsepepe::resolve_base_specifier(const std::string& cpp_file_content,
+CodeInsertionByOffset Tsepepe::resolve_base_specifier(std::string_view cpp_file_content,
                                                       ClangClassRecord deriving_class_record,
                                                       const clang::CXXRecordDecl* base_class)
+{
+    return resolve_base_specifiers(cpp_file_content, deriving_class_record, {base_class});
+}
+
+CodeInsertionByOffset Tsepepe::resolve_base_specifiers(std::string_view cpp_file_content,
+                                                       ClangClassRecord deriving_class_record,
+                                                       const std::vector<const clang::CXXRecordDecl*>& base_classes)
 {
     const auto& deriving_class{deriving_class_record.node};
     const auto& source_manager{*deriving_class_record.source_manager};
 
-    if (is_already_deriving(deriving_class, base_class))
+    // The names of the bases are gathered once, rather than once per the base class to add.
+    auto existing_base_names{get_all_base_names(deriving_class)};
+    std::vector<std::string> base_class_names;
+    base_class_names.reserve(base_classes.size());
+    for (auto base_class : base_classes)
+    {
+        auto base_class_name{base_class->getQualifiedNameAsString()};
+        if (existing_base_names.contains(base_class_name))
+            continue;
+        if (std::ranges::find(base_class_names, base_class_name) == std::end(base_class_names))
+            base_class_names.emplace_back(std::move(base_class_name));
+    }
+
+    if (base_class_names.empty())
         return {};
 
     std::string code;
-    code.reserve(80);
+    code.reserve(80 * base_class_names.size());
 
     if (deriving_class->bases().empty())
         code.append(" : ");
     else
         code.append(", ");
 
-    if (not deriving_class->isStruct())
-        code.append("public ");
+    for (const auto& base_class_name : base_class_names)
+    {
+        if (&base_class_name != &base_class_names.front())
+            code.append(", ");
 
-    code.append(base_class->getQualifiedNameAsString());
+        if (not deriving_class->isStruct())
+            code.append("public ");
+
+        code.append(base_class_name);
+    }
     code = AllScopeRemover{FullyQualifiedName{deriving_class->getQualifiedNameAsString()}}.remove_from(code);
 
     auto placement{get_end_of_token_before_opening_bracket(deriving_class, source_manager)};
@@ -81,17 +111,12 @@ static SourceLocation get_end_of_token_before_opening_bracket(const CXXRecordDec
     throw BaseError{"Could not find the class' opening bracket!"};
 }
 
-static bool is_already_deriving(const CXXRecordDecl* potentially_deriving_class, const CXXRecordDecl* base_class)
+static llvm::StringSet<> get_all_base_names(const CXXRecordDecl* record)
 {
-    const auto& base_class_name_searched{base_class->getQualifiedNameAsString()};
-    bool is_found{false};
-    potentially_deriving_class->forallBases([&](const CXXRecordDecl* base) {
-        if (base_class_name_searched == base->getQualifiedNameAsString())
-        {
-            is_found = true;
-            return false;
-        }
+    llvm::StringSet<> result;
+    record->forallBases([&](const CXXRecordDecl* base) {
+        result.insert(base->getQualifiedNameAsString());
         return true;
     });
-    return is_found;
+    return result;
 }
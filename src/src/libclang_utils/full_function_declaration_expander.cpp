@@ -2,9 +2,7 @@
  * @file	full_function_declaration_expander.cpp
  * @brief	Implements the full expanding of the the function declaration.
  */
-#include <algorithm>
-#include <iterator>
-#include <numeric>
+#include <string_view>
 
 #include "libclang_utils/full_function_declaration_expander.hpp"
 
@@ -16,11 +14,14 @@
 #include <clang/Basic/LangOptions.h>
 #include <clang/Basic/SourceLocation.h>
 #include <clang/Lex/Lexer.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/raw_ostream.h>
 
 #include "scope_remover.hpp"
 
+#include "string_builder.hpp"
+
 #include "libclang_utils/misc_utils.hpp"
-#include "string_utils.hpp"
 
 using namespace clang;
 
@@ -36,131 +37,119 @@ namespace FullFunctionDeclarationExpander
 
 struct Expander
 {
-    explicit Expander(const SourceManager& sm, Tsepepe::FullFunctionDeclarationExpanderOptions opts) :
-        printing_policy{lang_options}, source_manager{sm}, options{std::move(opts)}
+    explicit Expander(const SourceManager& sm,
+                      Tsepepe::FullFunctionDeclarationExpanderOptions opts,
+                      Tsepepe::AstPrintingMemo* shared_memo) :
+        printing_policy{lang_options},
+        source_manager{sm},
+        options{std::move(opts)},
+        memo{shared_memo != nullptr ? shared_memo : &local_memo}
     {
         printing_policy.adjustForCPlusPlus();
     }
 
     std::string expand(const FunctionDecl* function) const
     {
-        std::vector<std::string> result_parted;
-        result_parted.reserve(8);
+        Tsepepe::StringBuilder result{declaration_reserved_size};
 
         if (not options.ignore_attribute_specifiers)
-            result_parted.emplace_back(get_standard_attributes(function));
+            append_standard_attributes(result, function);
+
+        if (has_explicit_return_type(function))
+            result.append_word(type_to_string(function->getReturnType(), function->getASTContext()));
 
-        result_parted.emplace_back(get_return_type(function));
-        result_parted.emplace_back(function->getQualifiedNameAsString() + get_parameters(function));
+        result.append_word(memo->get_qualified_name(function));
+        append_parameters(result, function);
 
         if (auto method{dynamic_cast<const CXXMethodDecl*>(function)}; method != nullptr)
         {
-            result_parted.emplace_back(method->isConst() ? "const" : "");
-            result_parted.emplace_back(get_ref_qualifier(method));
-            result_parted.emplace_back(get_noexcept_qualifier(method));
+            result.append_word(method->isConst() ? "const" : "");
+            result.append_word(get_ref_qualifier(method));
+            result.append_word(get_noexcept_qualifier(method));
         }
 
-        auto [end, _] = std::ranges::remove_if(result_parted, [](const auto& s) { return s.empty(); });
-        auto begin{std::begin(result_parted)};
-        return Tsepepe::utils::join(begin, end, " ");
+        return result.take();
     }
 
   private:
-    std::string get_standard_attributes(const FunctionDecl* node) const
-    {
-        std::vector<std::string> standard_attributes_as_strings;
-        standard_attributes_as_strings.reserve(4);
+    //! Most of the declarations fit, so that the expansion allocates once.
+    static constexpr std::size_t declaration_reserved_size{256};
 
-        auto attrs{node->getAttrs()};
-        for (const auto& attr : attrs)
+    void append_standard_attributes(Tsepepe::StringBuilder& result, const FunctionDecl* node) const
+    {
+        for (const auto& attr : node->getAttrs())
         {
-            if (attr->isStandardAttributeSyntax())
-            {
-                auto attribute_as_string{
-                    "[["                                                                                      //
-                    + Tsepepe::source_range_content_to_string(attr->getRange(), source_manager, lang_options) //
-                    + "]]"};
-                standard_attributes_as_strings.emplace_back(std::move(attribute_as_string));
-            }
-        }
+            if (not attr->isStandardAttributeSyntax())
+                continue;
 
-        return Tsepepe::utils::join(standard_attributes_as_strings, " ");
+            result.append_word("[[");
+            result.append(Tsepepe::source_range_content_to_string(attr->getRange(), source_manager, lang_options));
+            result.append("]]");
+        }
     }
 
-    std::string get_return_type(const FunctionDecl* node) const
+    bool has_explicit_return_type(const FunctionDecl* node) const
     {
-        auto has_explicit_return_type{[&](const FunctionDecl* node) {
-            auto return_type_as_written_in_code{Tsepepe::source_range_content_to_string(
-                node->getReturnTypeSourceRange(), source_manager, node->getLangOpts())};
-            return not return_type_as_written_in_code.empty();
-        }};
-
-        if (not has_explicit_return_type(node))
-            return "";
-
-        return type_to_string(node->getReturnType(), node->getASTContext());
+        auto return_type_as_written_in_code{Tsepepe::source_range_content_to_string(
+            node->getReturnTypeSourceRange(), source_manager, node->getLangOpts())};
+        return not return_type_as_written_in_code.empty();
     }
 
     std::string stringify_template_specialization(const TemplateSpecializationType* template_spec_type) const
     {
         const auto& ast_context{template_spec_type->getAsRecordDecl()->getASTContext()};
-        auto template_arg_to_string{[&](const TemplateArgument& template_arg) {
-            return type_to_string(template_arg.getAsType(), ast_context);
-        }};
-
-        std::string result;
-        result.reserve(100);
 
-        llvm::raw_string_ostream os{result};
-
-        auto template_name{template_spec_type->getTemplateName()};
-        template_name.print(os, printing_policy, TemplateName::Qualified::Fully);
+        llvm::SmallString<64> template_name_string;
+        llvm::raw_svector_ostream os{template_name_string};
+        template_spec_type->getTemplateName().print(os, printing_policy, TemplateName::Qualified::Fully);
 
         const auto& template_args{template_spec_type->template_arguments()};
-        std::vector<std::string> template_args_as_string;
-        template_args_as_string.reserve(template_args.size());
-        std::ranges::transform(template_args, std::back_inserter(template_args_as_string), template_arg_to_string);
-
-        os << '<' << Tsepepe::utils::join(template_args_as_string) << '>';
+        Tsepepe::StringBuilder result{template_name_string.size() + 2 + template_args.size() * 32};
+        result.append(template_name_string.str()).append('<');
+        for (unsigned i{0}; i < template_args.size(); ++i)
+        {
+            if (i != 0)
+                result.append(", ");
+            result.append(type_to_string(template_args[i].getAsType(), ast_context));
+        }
+        result.append('>');
 
-        return result;
+        return result.take();
     }
 
-    std::string get_parameters(const FunctionDecl* node) const
+    void append_parameters(Tsepepe::StringBuilder& result, const FunctionDecl* node) const
     {
-        auto result{get_parameters_with_fully_qualified_types(node)};
-
-        if (options.remove_scope_from_parameters)
+        if (not options.remove_scope_from_parameters)
         {
-            Tsepepe::FullyQualifiedName scope{node->getQualifiedNameAsString()};
-            result = Tsepepe::AllScopeRemover{std::move(scope)}.remove_from(result);
+            append_parameters_with_fully_qualified_types(result, node);
+            return;
         }
 
-        return result;
+        Tsepepe::StringBuilder parameters{declaration_reserved_size};
+        append_parameters_with_fully_qualified_types(parameters, node);
+        Tsepepe::FullyQualifiedName scope{std::string{memo->get_qualified_name(node)}};
+        result.append(Tsepepe::AllScopeRemover{std::move(scope)}.remove_from(parameters.take()));
     }
 
-    std::string get_parameters_with_fully_qualified_types(const FunctionDecl* node) const
+    void append_parameters_with_fully_qualified_types(Tsepepe::StringBuilder& result, const FunctionDecl* node) const
     {
-        auto param_to_string{[&](const ParmVarDecl* param) {
-            auto result{type_to_string(param->getType(), node->getASTContext())};
-            auto name{param->getQualifiedNameAsString()};
-            if (not name.empty())
-            {
-                result += ' ';
-                result += std::move(name);
-            }
-            return result;
-        }};
-
-        const auto& params{node->parameters()};
-        std::vector<std::string> params_as_string;
-        params_as_string.reserve(params.size());
-        std::ranges::transform(params, std::back_inserter(params_as_string), param_to_string);
-
-        return '(' + Tsepepe::utils::join(params_as_string) + ')';
+        result.append('(');
+        bool is_first{true};
+        for (const auto param : node->parameters())
+        {
+            if (not is_first)
+                result.append(", ");
+            is_first = false;
+
+            result.append(type_to_string(param->getType(), node->getASTContext()));
+            // A parameter is not qualified with the scope of its function, so its name is printed as is.
+            if (auto name{param->getName()}; not name.empty())
+                result.append(' ').append(name);
+        }
+        result.append(')');
     }
 
-    std::string get_ref_qualifier(const CXXMethodDecl* node) const
+    std::string_view get_ref_qualifier(const CXXMethodDecl* node) const
     {
         auto ref_qualifier{node->getRefQualifier()};
         if (ref_qualifier == RefQualifierKind::RQ_LValue)
@@ -179,7 +168,12 @@ struct Expander
         return Tsepepe::source_range_content_to_string(source_range, source_manager, node->getLangOpts());
     }
 
-    std::string type_to_string(QualType qual_type, const ASTContext& ast_context) const
+    std::string_view type_to_string(QualType qual_type, const ASTContext& ast_context) const
+    {
+        return memo->get_type_string(qual_type, [&](QualType type) { return print_type(type, ast_context); });
+    }
+
+    std::string print_type(QualType qual_type, const ASTContext& ast_context) const
     {
         auto is_elaborated_type{[&](const QualType& qual_type) {
             return qual_type.getTypePtr()->getAs<ElaboratedType>() != nullptr;
@@ -205,6 +199,9 @@ struct Expander
     PrintingPolicy printing_policy{lang_options};
     const SourceManager& source_manager;
     const Tsepepe::FullFunctionDeclarationExpanderOptions options;
+    //! Used when no memo is shared; still, the types repeated within the declaration are printed once.
+    mutable Tsepepe::AstPrintingMemo local_memo;
+    Tsepepe::AstPrintingMemo* memo;
 };
 
 } // namespace FullFunctionDeclarationExpander
@@ -212,11 +209,34 @@ struct Expander
 // --------------------------------------------------------------------------------------------------------------------
 // Public stuff
 // --------------------------------------------------------------------------------------------------------------------
+std::string_view Tsepepe::AstPrintingMemo::get_type_string(QualType qual_type,
+                                                           llvm::function_ref<std::string(QualType)> printer)
+{
+    auto key{qual_type.getAsOpaquePtr()};
+    if (auto it{type_strings.find(key)}; it != std::end(type_strings))
+        return it->second;
+
+    // The printer may recurse, e.g. for the template arguments, inserting to the map, so no iterator is kept.
+    auto saved{string_saver.save(printer(qual_type))};
+    std::string_view result{saved};
+    type_strings.try_emplace(key, result);
+    return result;
+}
+
+std::string_view Tsepepe::AstPrintingMemo::get_qualified_name(const NamedDecl* declaration)
+{
+    auto [it, is_inserted]{qualified_names.try_emplace(declaration->getCanonicalDecl())};
+    if (is_inserted)
+        it->second = string_saver.save(declaration->getQualifiedNameAsString());
+    return it->second;
+}
+
 std::string Tsepepe::fully_expand_function_declaration(const FunctionDecl* function,
                                                        const SourceManager& source_manager,
-                                                       FullFunctionDeclarationExpanderOptions options)
+                                                       FullFunctionDeclarationExpanderOptions options,
+                                                       AstPrintingMemo* memo)
 {
-    return FullFunctionDeclarationExpander::Expander{source_manager, std::move(options)}.expand(function);
+    return FullFunctionDeclarationExpander::Expander{source_manager, std::move(options), memo}.expand(function);
 }
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -7,10 +7,15 @@
 #include "clang/Basic/LangOptions.h"
 
 #include <iostream>
+#include <memory>
 #include <regex>
 
+#include <clang/Basic/FileEntry.h>
 #include <clang/Basic/SourceManager.h>
+#include <clang/Index/USRGeneration.h>
 #include <clang/Lex/Lexer.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/VirtualFileSystem.h>
 
 using namespace clang;
 
@@ -83,3 +88,46 @@ void Tsepepe::dump_token(const clang::Token& token)
         std::cout << ", any identifier: " << token.getRawIdentifier().str() << std::endl;
     }
 }
+
+std::filesystem::path Tsepepe::get_absolute_file_path(clang::SourceLocation location,
+                                                      const clang::SourceManager& source_manager)
+{
+    auto file_id{source_manager.getFileID(source_manager.getSpellingLoc(location))};
+    auto file_entry{source_manager.getFileEntryForID(file_id)};
+    if (file_entry == nullptr)
+        return {};
+
+    // The real path is resolved by the file manager when the file gets opened; it is absolute.
+    auto real_path{file_entry->tryGetRealPathName()};
+    if (not real_path.empty())
+        return real_path.str();
+    return std::filesystem::absolute(file_entry->getName().str()).lexically_normal();
+}
+
+bool Tsepepe::is_definable_out_of_line(const clang::FunctionDecl* function)
+{
+    if (function->isImplicit() or function->isDeleted() or function->isDefaulted() or function->isPure())
+        return false;
+    if (function->isInlineSpecified() or function->isConstexpr() or function->getFriendObjectKind() != Decl::FOK_None)
+        return false;
+    return function->getTemplatedKind() == FunctionDecl::TK_NonTemplate and not function->isDependentContext();
+}
+
+std::string Tsepepe::generate_usr(const clang::Decl* decl)
+{
+    llvm::SmallString<128> usr;
+    // Returns true when the USR shall be ignored.
+    if (clang::index::generateUSRForDecl(decl, usr))
+        return "";
+    return usr.str().str();
+}
+
+clang::tooling::ClangTool Tsepepe::make_clang_tool(const clang::tooling::CompilationDatabase& compilation_database,
+                                                   const std::vector<std::string>& source_paths)
+{
+    // Unlike the real file system, the physical one keeps its working directory, instead of changing the process one.
+    return clang::tooling::ClangTool{compilation_database,
+                                     source_paths,
+                                     std::make_shared<PCHContainerOperations>(),
+                                     llvm::vfs::createPhysicalFileSystem()};
+}
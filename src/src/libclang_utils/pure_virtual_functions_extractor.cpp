@@ -5,6 +5,9 @@
 
 #include <regex>
 
+#include <clang/AST/CXXInheritance.h>
+#include <llvm/ADT/SmallPtrSet.h>
+
 #include "libclang_utils/full_function_declaration_expander.hpp"
 #include "libclang_utils/pure_virtual_functions_extractor.hpp"
 
@@ -16,6 +19,41 @@ using namespace Tsepepe;
 // --------------------------------------------------------------------------------------------------------------------
 // Private declarations
 // --------------------------------------------------------------------------------------------------------------------
+static std::string expand_pure_virtual_function(const CXXMethodDecl*,
+                                                const SourceManager&,
+                                                PureVirtualFunctionExpansionCache&,
+                                                AstPrintingMemo&);
+
+static std::string make_override_declaration(const std::string& expanded_declaration,
+                                             AllScopeRemover& implementor_scopes_remover);
+
+//! The interface itself, or any of its bases.
+static bool is_within_interface_hierarchy(const CXXRecordDecl* interface_node, const CXXRecordDecl*);
+
+/**
+ * Calls the callback once for each distinct pure virtual function, which is the final overrider of any virtual function
+ * of the record. The callback gets the overridden function, and its pure final overrider. The functions come in the
+ * order of the class hierarchy traversal: the bases go first.
+ */
+template<typename Callback>
+static void for_each_pure_final_overrider(const CXXRecordDecl* record, Callback callback)
+{
+    CXXFinalOverriderMap final_overriders;
+    record->getFinalOverriders(final_overriders);
+
+    // Shared bases (e.g. within a diamond) yield the same final overrider many times.
+    llvm::SmallPtrSet<const CXXMethodDecl*, 16> visited;
+    for (const auto& [overridden_method, overriding_methods] : final_overriders)
+        for (const auto& [subobject_number, overriders] : overriding_methods)
+            for (const auto& overrider : overriders)
+            {
+                const CXXMethodDecl* method{overrider.Method};
+                if (not method->isPure() or isa<CXXDestructorDecl>(method))
+                    continue;
+                if (visited.insert(method->getCanonicalDecl()).second)
+                    callback(overridden_method, method);
+            }
+}
 
 // --------------------------------------------------------------------------------------------------------------------
 // Public stuff
@@ -27,33 +65,106 @@ Tsepepe::pure_virtual_functions_to_override_declarations(const clang::CXXRecordD
 {
     OverrideDeclarations override_declarations;
     AllScopeRemover implementor_scopes_remover{FullyQualifiedName{implementor_fully_qualified_name}};
+    PureVirtualFunctionExpansionCache cache;
+    AstPrintingMemo printing_memo;
 
-    auto append_override_declaration{[&](const CXXMethodDecl* method) {
-        const auto& interface_name{method->getParent()->getQualifiedNameAsString()};
+    // The actual story begins here ...
+    for_each_pure_final_overrider(node, [&](const CXXMethodDecl*, const CXXMethodDecl* pure_method) {
+        auto expanded_declaration{expand_pure_virtual_function(pure_method, source_manager, cache, printing_memo)};
+        override_declarations.emplace_back(make_override_declaration(expanded_declaration, implementor_scopes_remover));
+    });
+    return override_declarations;
+}
 
-        auto declaration{Tsepepe::fully_expand_function_declaration(method, source_manager)};
-        declaration = ScopeRemover{FullyQualifiedName{interface_name}}.remove_from(declaration);
-        declaration = implementor_scopes_remover.remove_from(declaration);
-        declaration.append(" override;");
+OverrideDeclarations Tsepepe::missing_override_declarations(const clang::CXXRecordDecl* interface_node,
+                                                            const clang::CXXRecordDecl* implementor_node,
+                                                            const clang::SourceManager& source_manager,
+                                                            PureVirtualFunctionExpansionCache* cache)
+{
+    OverrideDeclarations override_declarations;
+    AllScopeRemover implementor_scopes_remover{FullyQualifiedName{implementor_node->getQualifiedNameAsString()}};
+    PureVirtualFunctionExpansionCache local_cache;
+    auto& expansion_cache{cache != nullptr ? *cache : local_cache};
+    AstPrintingMemo printing_memo;
 
-        override_declarations.emplace_back(std::move(declaration));
-    }};
+    // The final overriders are resolved within the implementor, so anything overridden already, either by the
+    // implementor itself, or by any of its bases, is skipped.
+    for_each_pure_final_overrider(
+        implementor_node, [&](const CXXMethodDecl* overridden_method, const CXXMethodDecl* pure_method) {
+            if (not is_within_interface_hierarchy(interface_node, overridden_method->getParent()))
+                return;
+            auto expanded_declaration{
+                expand_pure_virtual_function(pure_method, source_manager, expansion_cache, printing_memo)};
+            override_declarations.emplace_back(
+                make_override_declaration(expanded_declaration, implementor_scopes_remover));
+        });
+    return override_declarations;
+}
 
-    auto collect_override_declarations{[&](const clang::CXXRecordDecl* record) {
-        for (auto method : record->methods())
-            if (method->isPure())
-                append_override_declaration(method);
-    }};
+bool Tsepepe::has_pure_virtual_functions_beyond_interface(const clang::CXXRecordDecl* interface_node,
+                                                          const clang::CXXRecordDecl* record_node)
+{
+    bool result{false};
+    for_each_pure_final_overrider(record_node, [&](const CXXMethodDecl* overridden_method, const CXXMethodDecl*) {
+        if (not is_within_interface_hierarchy(interface_node, overridden_method->getParent()))
+            result = true;
+    });
+    return result;
+}
 
-    // The actual story begins here ...
-    node->forallBases([&](const CXXRecordDecl* base) {
-        collect_override_declarations(base);
-        return true;
+bool Tsepepe::implements_pure_virtual_functions_of(const clang::CXXRecordDecl* base_node,
+                                                   const clang::CXXRecordDecl* derived_node)
+{
+    llvm::SmallPtrSet<const CXXMethodDecl*, 16> unimplemented_methods;
+    for_each_pure_final_overrider(base_node, [&](const CXXMethodDecl* overridden_method, const CXXMethodDecl*) {
+        unimplemented_methods.insert(overridden_method->getCanonicalDecl());
     });
-    collect_override_declarations(node);
-    return override_declarations;
+    if (unimplemented_methods.empty())
+        return false;
+
+    // The overridden functions of the base are the overridden functions of the derived class too.
+    CXXFinalOverriderMap final_overriders;
+    derived_node->getFinalOverriders(final_overriders);
+    for (const auto& [overridden_method, overriding_methods] : final_overriders)
+    {
+        if (unimplemented_methods.count(overridden_method->getCanonicalDecl()) == 0)
+            continue;
+        for (const auto& [subobject_number, overriders] : overriding_methods)
+            for (const auto& overrider : overriders)
+                if (not overrider.Method->isPure())
+                    return true;
+    }
+    return false;
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 // Private definitions
 // --------------------------------------------------------------------------------------------------------------------
+static std::string expand_pure_virtual_function(const CXXMethodDecl* method,
+                                                const SourceManager& source_manager,
+                                                PureVirtualFunctionExpansionCache& cache,
+                                                AstPrintingMemo& printing_memo)
+{
+    auto [it, is_inserted]{cache.try_emplace(method->getCanonicalDecl())};
+    if (not is_inserted)
+        return it->second;
+
+    // The methods of an interface share the interface name, and often the types.
+    auto interface_name{printing_memo.get_qualified_name(method->getParent())};
+    auto declaration{Tsepepe::fully_expand_function_declaration(method, source_manager, {}, &printing_memo)};
+    it->second = ScopeRemover{FullyQualifiedName{std::string{interface_name}}}.remove_from(declaration);
+    return it->second;
+}
+
+static std::string make_override_declaration(const std::string& expanded_declaration,
+                                             AllScopeRemover& implementor_scopes_remover)
+{
+    auto declaration{implementor_scopes_remover.remove_from(expanded_declaration)};
+    declaration.append(" override;");
+    return declaration;
+}
+
+static bool is_within_interface_hierarchy(const CXXRecordDecl* interface_node, const CXXRecordDecl* record)
+{
+    return record->getCanonicalDecl() == interface_node->getCanonicalDecl() or interface_node->isDerivedFrom(record);
+}
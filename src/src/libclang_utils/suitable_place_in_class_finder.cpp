@@ -30,7 +30,7 @@ using namespace Tsepepe;
 struct SuitablePlaceInClassFinder
 {
     //! Beware: None of the parameters are owned, thus they must outlive the SuitablePlaceInClassFinder.
-    explicit SuitablePlaceInClassFinder(const std::string& cpp_file_content,
+    explicit SuitablePlaceInClassFinder(std::string_view cpp_file_content,
                                         const clang::CXXRecordDecl* node,
                                         const clang::SourceManager& source_manager) :
         cpp_file_content{cpp_file_content},
@@ -140,7 +140,7 @@ struct SuitablePlaceInClassFinder
         auto offset{source_manager.getFileOffset(it->getLocation())};
         auto newline_offset{cpp_file_content.find('\n', beg_offset)};
 
-        if (newline_offset != std::string::npos and newline_offset <= offset)
+        if (newline_offset != std::string_view::npos and newline_offset <= offset)
             return newline_offset + 1;
         else
             return source_manager.getFileOffset(beg->getLocation());
@@ -176,7 +176,7 @@ struct SuitablePlaceInClassFinder
         return LexedRange{record->getSourceRange(), &source_manager, &record->getLangOpts()};
     }
 
-    const std::string& cpp_file_content;
+    std::string_view cpp_file_content;
     const CXXRecordDecl* record;
     const SourceManager& source_manager;
     const LangOptions& lang_options;
@@ -186,7 +186,7 @@ struct SuitablePlaceInClassFinder
 // Public stuff
 // --------------------------------------------------------------------------------------------------------------------
 Tsepepe::SuitablePublicMethodPlaceInCppFile Tsepepe::find_suitable_place_in_class_for_public_method(
-    const std::string& cpp_file_content, const clang::CXXRecordDecl* node, const clang::SourceManager& source_manager)
+    std::string_view cpp_file_content, const clang::CXXRecordDecl* node, const clang::SourceManager& source_manager)
 {
     return SuitablePlaceInClassFinder{cpp_file_content, node, source_manager}.find();
 }
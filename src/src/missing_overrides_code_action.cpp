@@ -0,0 +1,304 @@
+/**
+ * @file	missing_overrides_code_action.cpp
+ * @brief	Implements the Missing Overrides code action.
+ */
+
+#include "missing_overrides_code_action.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <clang/ASTMatchers/ASTMatchFinder.h>
+#include <clang/ASTMatchers/ASTMatchers.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Lex/Lexer.h>
+#include <clang/Tooling/Tooling.h>
+
+#include "class_index.hpp"
+#include "code_formatter.hpp"
+#include "codebase_grepper.hpp"
+#include "common_types.hpp"
+#include "include_graph.hpp"
+#include "inheritance_graph.hpp"
+#include "parallel_utils.hpp"
+#include "string_builder.hpp"
+#include "translation_unit_cache.hpp"
+
+#include "libclang_utils/misc_utils.hpp"
+#include "libclang_utils/pure_virtual_functions_extractor.hpp"
+#include "libclang_utils/suitable_place_in_class_finder.hpp"
+
+using namespace Tsepepe;
+using namespace clang;
+using namespace clang::tooling;
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace Tsepepe
+{
+
+struct MissingOverridesCodeActionLibclangBasedImpl
+{
+    explicit MissingOverridesCodeActionLibclangBasedImpl(std::shared_ptr<CompilationDatabase> comp_db,
+                                                         MissingOverridesCodeActionParameters params) :
+        compilation_database{std::move(comp_db)},
+        parameters{std::move(params)},
+        root_directory{fs::weakly_canonical(fs::absolute(parameters.root_directory))}
+    {
+    }
+
+    MultiFileEdit apply()
+    {
+        auto translation_units{parameters.cache_directory.empty() ? find_translation_units_seeing_interface()
+                                                                  : find_translation_units_seeing_implementors()};
+        utils::parallel_for_each(translation_units, [&](const std::string& translation_unit) {
+            process_translation_unit(translation_unit);
+        });
+
+        MultiFileEdit result;
+        for (auto& [path, file_edit] : file_edits)
+        {
+            // The intermediate bases are known only once all the translation units are visited.
+            std::vector<CodeInsertionByOffset> insertions;
+            for (auto& [implementor_name, insertion] : file_edit.insertions)
+                if (not intermediate_bases.contains({path, implementor_name}))
+                    insertions.push_back(std::move(insertion));
+            if (insertions.empty())
+                continue;
+            result.emplace(path,
+                           apply_and_format_insertions(
+                               file_edit.content, std::move(insertions), path, parameters.code_formatting));
+        }
+        return result;
+    }
+
+  private:
+    struct DerivedClass
+    {
+        const CXXRecordDecl* node;
+        //! The interface, which the class derives from.
+        const CXXRecordDecl* interface;
+    };
+
+    struct FileEdit
+    {
+        std::string content;
+        //! Keyed by the qualified name of the implementor.
+        std::map<std::string, CodeInsertionByOffset> insertions;
+    };
+
+    //! Only the translation units including the definition of the interface, directly or not, may see implementors.
+    std::vector<std::string> find_translation_units_seeing_interface() const
+    {
+        auto translation_units{compilation_database->getAllFiles()};
+
+        std::string class_definition_regex{"\\b(struct|class)\\s+" + parameters.interface_name + "\\b"};
+        std::set<fs::path> interface_files;
+        for (const auto& file_match :
+             codebase_grep(RootDirectory(root_directory), EcmaScriptPattern{class_definition_regex}))
+            interface_files.insert(fs::weakly_canonical(file_match.path));
+        // The interface defined outside the project may be seen by any of the translation units.
+        if (interface_files.empty())
+            return translation_units;
+
+        // Walking the includes lexically is cheap, compared to parsing the translation units, which do not need it.
+        auto include_graph{
+            IncludeGraphBuilderLibclangBased{compilation_database}.build({.root_directory = root_directory})};
+        std::erase_if(translation_units, [&](const std::string& translation_unit) {
+            auto main_file{fs::weakly_canonical(fs::absolute(translation_unit))};
+            return std::ranges::none_of(interface_files, [&](const fs::path& interface_file) {
+                return interface_file == main_file or include_graph.is_included(interface_file, main_file);
+            });
+        });
+        return translation_units;
+    }
+
+    std::vector<std::string> find_translation_units_seeing_implementors() const
+    {
+        auto class_index{ClassIndexerLibclangBased{compilation_database}.index(
+            {.root_directory = root_directory, .cache_directory = parameters.cache_directory})};
+        InheritanceGraph inheritance_graph{class_index.classes};
+
+        std::set<std::string_view> derived_class_names;
+        for (auto interface : inheritance_graph.find(parameters.interface_name))
+            for (auto derived_class : inheritance_graph.find_derived_classes(interface))
+                derived_class_names.insert(inheritance_graph.get_qualified_name(derived_class));
+
+        std::set<fs::path> implementor_files;
+        for (const auto& indexed_class : class_index.classes)
+            if (derived_class_names.contains(indexed_class.qualified_name))
+                implementor_files.insert(indexed_class.location.file);
+
+        // Any translation unit, which sees a file, will do to edit all the implementors defined within that file.
+        std::vector<std::string> result;
+        for (const auto& [translation_unit, files] : class_index.translation_unit_files)
+        {
+            bool is_seeing_implementor{false};
+            for (const auto& file : files)
+                if (implementor_files.erase(file) > 0)
+                    is_seeing_implementor = true;
+            if (is_seeing_implementor)
+                result.push_back(translation_unit);
+        }
+        return result;
+    }
+
+    void process_translation_unit(const std::string& translation_unit)
+    {
+        auto ast_unit{build_ast_unit(translation_unit)};
+        if (ast_unit == nullptr)
+            return;
+
+        using namespace ast_matchers;
+        auto derived_class_matcher{
+            cxxRecordDecl(isDefinition(),
+                          isDerivedFrom(cxxRecordDecl(hasName(parameters.interface_name)).bind("interface")),
+                          unless(isExpansionInSystemHeader()),
+                          unless(isTemplateInstantiation()))
+                .bind("derived class")};
+
+        const auto& source_manager{ast_unit->getSourceManager()};
+        std::vector<DerivedClass> derived_classes;
+        for (const auto& match : ast_matchers::match(derived_class_matcher, ast_unit->getASTContext()))
+        {
+            auto derived_class{match.getNodeAs<CXXRecordDecl>("derived class")};
+            auto interface{match.getNodeAs<CXXRecordDecl>("interface")};
+            if (derived_class != nullptr and interface != nullptr and not derived_class->isDependentContext())
+                derived_classes.push_back({.node = derived_class, .interface = interface});
+        }
+
+        mark_intermediate_bases(derived_classes, source_manager);
+
+        PureVirtualFunctionExpansionCache expansion_cache;
+        for (const auto& [implementor, interface] : derived_classes)
+        {
+            // E.g. an interface extending the interface, or a class deriving from such an extending interface.
+            if (has_pure_virtual_functions_beyond_interface(interface, implementor))
+                continue;
+
+            auto implementor_file_path{get_absolute_file_path(implementor->getLocation(), source_manager)};
+            if (not is_within_directory(implementor_file_path, root_directory))
+                continue;
+
+            if (not mark_as_visited(implementor_file_path, implementor->getQualifiedNameAsString()))
+                continue;
+
+            process_implementor(implementor_file_path, interface, implementor, source_manager, expansion_cache);
+        }
+    }
+
+    std::unique_ptr<ASTUnit> build_ast_unit(const std::string& path) const
+    {
+        parameters.cancellation.throw_if_cancelled();
+
+        std::vector<std::unique_ptr<ASTUnit>> ast_units;
+        auto tool{make_clang_tool(*compilation_database, {path})};
+        tool.buildASTs(ast_units);
+        if (ast_units.empty())
+            return nullptr;
+        return std::move(ast_units.back());
+    }
+
+    /**
+     * A class, which leaves some pure virtual functions of the interface for its derived classes to implement, is an
+     * intermediate base, not an implementor, so it is not completed; its derived classes are.
+     */
+    void mark_intermediate_bases(const std::vector<DerivedClass>& derived_classes, const SourceManager& source_manager)
+    {
+        for (const auto& base : derived_classes)
+            for (const auto& derived : derived_classes)
+                if (derived.node->isDerivedFrom(base.node)
+                    and implements_pure_virtual_functions_of(base.node, derived.node))
+                {
+                    auto base_file_path{get_absolute_file_path(base.node->getLocation(), source_manager)};
+                    std::lock_guard lock{mutex};
+                    intermediate_bases.emplace(std::move(base_file_path), base.node->getQualifiedNameAsString());
+                    break;
+                }
+    }
+
+    //! Returns false if the class has already been visited, from within another translation unit.
+    bool mark_as_visited(const fs::path& file_path, std::string class_qualified_name)
+    {
+        std::lock_guard lock{mutex};
+        return visited_classes.emplace(file_path, std::move(class_qualified_name)).second;
+    }
+
+    void process_implementor(const fs::path& implementor_file_path,
+                             const CXXRecordDecl* interface,
+                             const CXXRecordDecl* implementor,
+                             const SourceManager& source_manager,
+                             PureVirtualFunctionExpansionCache& expansion_cache)
+    {
+        auto method_overrides{
+            Tsepepe::missing_override_declarations(interface, implementor, source_manager, &expansion_cache)};
+        if (method_overrides.empty())
+            return;
+
+        auto file_id{source_manager.getFileID(source_manager.getSpellingLoc(implementor->getLocation()))};
+        // Copied only once per file, when its first insertion is collected.
+        auto file_content{source_manager.getBufferData(file_id)};
+
+        auto class_indentation{Lexer::getIndentationForLine(implementor->getLocation(), source_manager)};
+        auto method_overrides_place{
+            Tsepepe::find_suitable_place_in_class_for_public_method(
+                {file_content.data(), file_content.size()}, implementor, source_manager)};
+
+        std::string_view public_section{method_overrides_place.is_public_section_needed ? "public:\n" : ""};
+        std::size_t code_size{public_section.size()};
+        for (const auto& override_ : method_overrides)
+            code_size += class_indentation.size() + method_indentation.size() + override_.size() + 1;
+
+        StringBuilder code{code_size};
+        code.append(public_section);
+        for (const auto& override_ : method_overrides)
+            code.append(class_indentation).append(method_indentation).append(override_).append('\n');
+
+        std::lock_guard lock{mutex};
+        auto& file_edit{file_edits[implementor_file_path]};
+        if (file_edit.insertions.empty())
+            file_edit.content = file_content.str();
+        file_edit.insertions.emplace(
+            implementor->getQualifiedNameAsString(),
+            CodeInsertionByOffset{.code = code.take(), .offset = method_overrides_place.offset});
+    }
+
+    //! The overrides are indented by one level, relative to the class.
+    static constexpr std::string_view method_indentation{"    "};
+
+    std::shared_ptr<CompilationDatabase> compilation_database;
+    MissingOverridesCodeActionParameters parameters;
+    fs::path root_directory;
+
+    std::mutex mutex;
+    std::set<std::pair<fs::path, std::string>> visited_classes;
+    //! Keyed by the file path, and the qualified name of the class.
+    std::set<std::pair<fs::path, std::string>> intermediate_bases;
+    std::map<fs::path, FileEdit> file_edits;
+};
+} // namespace Tsepepe
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::MissingOverridesCodeActionLibclangBased::MissingOverridesCodeActionLibclangBased(
+    std::shared_ptr<clang::tooling::CompilationDatabase> comp_db) :
+    compilation_database(std::move(comp_db))
+{
+}
+
+Tsepepe::MultiFileEdit
+Tsepepe::MissingOverridesCodeActionLibclangBased::apply(MissingOverridesCodeActionParameters params)
+{
+    return MissingOverridesCodeActionLibclangBasedImpl{compilation_database, std::move(params)}.apply();
+}
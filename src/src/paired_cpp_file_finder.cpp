@@ -1,12 +1,14 @@
 /**
- * @file	finder.cpp
- * @brief	Implements the paired C++ file finder core.
+ * @file	paired_cpp_file_finder.cpp
+ * @brief	Implements the paired C++ file finder.
  */
 
 #include <algorithm>
+#include <iterator>
 #include <ranges>
+#include <string>
 
-#include "finder.hpp"
+#include "paired_cpp_file_finder.hpp"
 
 namespace fs = std::filesystem;
 
@@ -33,10 +35,14 @@ static const std::vector<std::string> header_file_extensions{".hpp", ".hxx", ".h
 // --------------------------------------------------------------------------------------------------------------------
 // Public stuff
 // --------------------------------------------------------------------------------------------------------------------
-std::vector<std::filesystem::path> Tsepepe::PairedCppFileFinder::find(const Input& input)
+bool Tsepepe::is_cpp_source_file(const fs::path& cpp_file_path)
 {
-    const auto& [project_root, cpp_file_path] = input;
+    return std::find(std::begin(source_file_extensions), std::end(source_file_extensions), cpp_file_path.extension())
+           != std::end(source_file_extensions);
+}
 
+std::vector<fs::path> Tsepepe::find_paired_cpp_files(const fs::path& project_root, const fs::path& cpp_file_path)
+{
     auto paired_file_names{get_potential_paired_file_names(cpp_file_path)};
     auto is_paired_cpp_file{[&](const fs::path& path) {
         return std::ranges::find(paired_file_names, path.filename()) != std::end(paired_file_names);
@@ -58,14 +64,9 @@ std::vector<std::filesystem::path> Tsepepe::PairedCppFileFinder::find(const Inpu
 // --------------------------------------------------------------------------------------------------------------------
 static std::vector<fs::path> get_potential_paired_file_names(const fs::path& cpp_file_path)
 {
-    auto is_source_file{[](const fs::path& cpp_file_path) {
-        return std::find(
-                   std::begin(source_file_extensions), std::end(source_file_extensions), cpp_file_path.extension())
-               != std::end(source_file_extensions);
-    }};
-
     auto stem{cpp_file_path.stem()};
-    const auto& extensions{is_source_file(cpp_file_path) ? header_file_extensions : source_file_extensions};
+    const auto& extensions{Tsepepe::is_cpp_source_file(cpp_file_path) ? header_file_extensions
+                                                                       : source_file_extensions};
 
     std::vector<fs::path> result;
     result.reserve(extensions.size());
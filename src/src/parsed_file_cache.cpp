@@ -0,0 +1,377 @@
+/**
+ * @file	parsed_file_cache.cpp
+ * @brief	Implements the ParsedFileCache.
+ */
+#include "parsed_file_cache.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <regex>
+#include <set>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <clang/Basic/Diagnostic.h>
+#include <clang/Basic/DiagnosticOptions.h>
+#include <clang/Basic/FileEntry.h>
+#include <clang/Basic/FileSystemOptions.h>
+#include <clang/Basic/SourceManager.h>
+#include <clang/Basic/Version.h>
+#include <clang/Lex/HeaderSearchOptions.h>
+#include <clang/Serialization/PCHContainerOperations.h>
+#include <clang/Tooling/Tooling.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/xxhash.h>
+
+#include "index_segment.hpp"
+#include "paired_cpp_file_finder.hpp"
+#include "parallel_utils.hpp"
+
+#include "libclang_utils/misc_utils.hpp"
+
+namespace fs = std::filesystem;
+using namespace clang;
+using namespace clang::tooling;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static constexpr std::int64_t snapshot_format_version{1};
+static constexpr char snapshot_manifest_file_name[]{"parsed_files.json"};
+static constexpr llvm::StringLiteral snapshot_records_key{"parsed_files"};
+static constexpr char ast_file_extension[]{".ast"};
+
+//! The path, together with the hash of the parsed content, if any.
+static std::string make_entry_key(const fs::path&, const std::optional<Tsepepe::SourceFileContent>&);
+
+//! The headers under the root directory, seen by the parse, which declare pure virtual functions.
+static std::vector<fs::path> find_interface_headers(const SourceManager&, const fs::path& root_directory);
+
+static std::string make_ast_file_name(const std::string& entry_key);
+
+//! Returns null if the AST file cannot be loaded, e.g. is written by another version of clang.
+static std::unique_ptr<ASTUnit> load_ast_file(const fs::path&);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::ParsedFile Tsepepe::parse_file(const CompilationDatabase& compilation_database,
+                                        fs::path path,
+                                        std::optional<SourceFileContent> content)
+{
+    std::vector<std::unique_ptr<ASTUnit>> ast_units;
+    auto tool{make_clang_tool(compilation_database, {path.string()})};
+    if (content)
+        tool.mapVirtualFile(path.string(), content->get_ref());
+    tool.buildASTs(ast_units);
+
+    ParsedFile result{.path = std::move(path), .content = std::move(content)};
+    if (not ast_units.empty())
+        result.ast_unit = std::move(ast_units.back());
+    return result;
+}
+
+Tsepepe::ParsedFileCache::ParsedFileCache(std::shared_ptr<CompilationDatabase> comp_db,
+                                          fs::path root_directory_,
+                                          std::size_t capacity_,
+                                          fs::path snapshot_directory_) :
+    compilation_database{std::move(comp_db)},
+    // Compared with the real paths of the parsed files.
+    root_directory{fs::weakly_canonical(fs::absolute(root_directory_))},
+    capacity{capacity_},
+    snapshot_directory{std::move(snapshot_directory_)}
+{
+    if (snapshot_directory.empty())
+        return;
+
+    auto manifest_path{snapshot_directory / snapshot_manifest_file_name};
+    auto records{load_cache_records(manifest_path, snapshot_format_version, snapshot_records_key)};
+    for (const auto& [key, value] : records)
+    {
+        auto record{value.getAsObject()};
+        if (record == nullptr)
+            continue;
+
+        auto path{record->getString("path")};
+        auto ast_file_name{record->getString("ast_file")};
+        auto fingerprint{fingerprint_from_json(*record)};
+        if (not path or not ast_file_name or not fingerprint)
+            continue;
+        snapshot_records.insert_or_assign(
+            key.str(),
+            SnapshotRecord{.path = path->str(), .ast_file_name = ast_file_name->str(), .fingerprint = *fingerprint});
+    }
+}
+
+Tsepepe::ParsedFile Tsepepe::ParsedFileCache::take(const fs::path& path, std::optional<SourceFileContent> content)
+{
+    auto key{make_entry_key(path, content)};
+
+    std::list<Entry> taken;
+    std::optional<SnapshotRecord> snapshot_record;
+    {
+        std::lock_guard lock{entries_mutex};
+        if (auto it{std::ranges::find(entries, key, &Entry::key)}; it != std::end(entries))
+            taken.splice(std::end(taken), entries, it);
+        else if (auto record_it{snapshot_records.find(key)}; record_it != std::end(snapshot_records))
+            snapshot_record = std::move(snapshot_records.extract(record_it).mapped());
+    }
+
+    // The fingerprints are checked out of the lock, since they read the files.
+    if (not taken.empty() and is_up_to_date(taken.front().fingerprint, taken.front().parsed_file.path))
+        return std::move(taken.front().parsed_file);
+
+    if (snapshot_record and is_up_to_date(snapshot_record->fingerprint, path))
+        if (auto ast_unit{load_ast_file(snapshot_directory / snapshot_record->ast_file_name)}; ast_unit != nullptr)
+            return {.path = path,
+                    .snapshot_fingerprint = std::move(snapshot_record->fingerprint),
+                    .ast_unit = std::move(ast_unit)};
+
+    return parse_file(*compilation_database, path, std::move(content));
+}
+
+void Tsepepe::ParsedFileCache::put(ParsedFile parsed_file)
+{
+    if (parsed_file.ast_unit == nullptr)
+        return;
+
+    // The source manager of a loaded AST knows only the files, which have been deserialized so far.
+    bool is_in_snapshot{parsed_file.snapshot_fingerprint.has_value()};
+    auto fingerprint{is_in_snapshot ? *parsed_file.snapshot_fingerprint
+                                    : fingerprint_translation_unit(
+                                        parsed_file.ast_unit->getSourceManager(),
+                                        hash_compile_commands(*compilation_database, parsed_file.path.string()),
+                                        root_directory)};
+    Entry entry{.key = make_entry_key(parsed_file.path, parsed_file.content),
+                .fingerprint = std::move(fingerprint),
+                .parsed_file = std::move(parsed_file),
+                .is_in_snapshot = is_in_snapshot};
+
+    // Declared before the lock, so that the dropped ASTs are destroyed once the lock is released.
+    std::list<Entry> dropped;
+    std::lock_guard lock{entries_mutex};
+    if (auto it{std::ranges::find(entries, entry.key, &Entry::key)}; it != std::end(entries))
+        dropped.splice(std::end(dropped), entries, it);
+    entries.push_front(std::move(entry));
+    while (entries.size() > capacity)
+        dropped.splice(std::end(dropped), entries, std::prev(std::end(entries)));
+}
+
+Tsepepe::TakenParsedFile::TakenParsedFile(ParsedFile parsed_file, ParsedFileCache* parsed_file_cache) :
+    parsed_file{std::move(parsed_file)}, parsed_file_cache{parsed_file_cache}
+{
+}
+
+Tsepepe::TakenParsedFile::TakenParsedFile(TakenParsedFile&& other) noexcept :
+    parsed_file{std::move(other.parsed_file)}, parsed_file_cache{std::exchange(other.parsed_file_cache, nullptr)}
+{
+}
+
+Tsepepe::TakenParsedFile& Tsepepe::TakenParsedFile::operator=(TakenParsedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        put_back();
+        parsed_file = std::move(other.parsed_file);
+        parsed_file_cache = std::exchange(other.parsed_file_cache, nullptr);
+    }
+    return *this;
+}
+
+Tsepepe::TakenParsedFile::~TakenParsedFile()
+{
+    put_back();
+}
+
+void Tsepepe::TakenParsedFile::put_back() noexcept
+{
+    if (parsed_file_cache == nullptr)
+        return;
+
+    try
+    {
+        std::exchange(parsed_file_cache, nullptr)->put(std::move(parsed_file));
+    } catch (...)
+    {
+        // The file is parsed again by the next take.
+    }
+}
+
+Tsepepe::TakenParsedFile Tsepepe::take_parsed_file(ParsedFileCache* parsed_file_cache,
+                                                   const CompilationDatabase& compilation_database,
+                                                   const fs::path& path,
+                                                   std::optional<SourceFileContent> content)
+{
+    if (parsed_file_cache != nullptr)
+        return {parsed_file_cache->take(path, std::move(content)), parsed_file_cache};
+    return {parse_file(compilation_database, path, std::move(content)), nullptr};
+}
+
+void Tsepepe::ParsedFileCache::warm_up(const fs::path& file_path,
+                                       std::optional<SourceFileContent> content,
+                                       const CancellationToken& cancellation)
+{
+    cancellation.throw_if_cancelled();
+    auto parse_path{content ? make_virtual_source_file_path(file_path, "warm_up") : file_path};
+    auto opened_file{take(parse_path, std::move(content))};
+
+    auto file_paths{find_paired_cpp_files(root_directory, file_path)};
+    if (opened_file.ast_unit != nullptr)
+        for (auto& header_path : find_interface_headers(opened_file.ast_unit->getSourceManager(), root_directory))
+            if (std::ranges::find(file_paths, header_path) == std::end(file_paths))
+                file_paths.emplace_back(std::move(header_path));
+    put(std::move(opened_file));
+
+    // The files beyond the capacity would only push the others out.
+    file_paths.resize(std::min(file_paths.size(), std::max<std::size_t>(capacity, 1) - 1));
+
+    utils::parallel_for(file_paths.size(), [&](std::size_t index) {
+        cancellation.throw_if_cancelled();
+        put(take(file_paths[index]));
+    });
+}
+
+void Tsepepe::ParsedFileCache::store_snapshot()
+{
+    if (snapshot_directory.empty())
+        return;
+
+    std::lock_guard lock{entries_mutex};
+    auto manifest_path{snapshot_directory / snapshot_manifest_file_name};
+    IndexWriterLock writer_lock{manifest_path.string() + ".lock"};
+
+    llvm::json::Object records;
+    auto add_record{[&](const std::string& key,
+                        const fs::path& path,
+                        const std::string& ast_file_name,
+                        const TranslationUnitFingerprint& fingerprint) {
+        if (records.size() >= capacity or records.find(key) != std::end(records))
+            return;
+        llvm::json::Object record{{"path", path.string()}, {"ast_file", ast_file_name}};
+        add_to_json(fingerprint, record);
+        records[key] = std::move(record);
+    }};
+
+    for (auto& entry : entries)
+    {
+        // The content, given in place of the file on the disk, is gone with the process.
+        if (entry.parsed_file.content)
+            continue;
+
+        auto ast_file_name{make_ast_file_name(entry.key)};
+        if (not entry.is_in_snapshot)
+        {
+            // Saved aside, and renamed then; returns true on failure.
+            if (entry.parsed_file.ast_unit->Save((snapshot_directory / ast_file_name).string()))
+                continue;
+            entry.is_in_snapshot = true;
+        }
+        add_record(entry.key, entry.parsed_file.path, ast_file_name, entry.fingerprint);
+    }
+    for (const auto& [key, record] : snapshot_records)
+        add_record(key, record.path, record.ast_file_name, record.fingerprint);
+
+    // The ASTs stored meanwhile by the others are kept, as long as the capacity allows.
+    for (auto& [key, record] : load_cache_records(manifest_path, snapshot_format_version, snapshot_records_key))
+        if (records.size() < capacity and records.find(key) == std::end(records))
+            records[key] = std::move(record);
+
+    std::set<std::string> ast_file_names;
+    for (const auto& [key, record] : records)
+        if (auto record_object{record.getAsObject()}; record_object != nullptr)
+            if (auto ast_file_name{record_object->getString("ast_file")}; ast_file_name)
+                ast_file_names.emplace(ast_file_name->str());
+
+    store_cache_records(manifest_path, snapshot_format_version, snapshot_records_key, std::move(records));
+
+    // The AST files, which are no longer listed, are removed; a failure leaves just a stale file behind.
+    std::error_code error_code;
+    for (const auto& directory_entry : fs::directory_iterator{snapshot_directory, error_code})
+    {
+        const auto& path{directory_entry.path()};
+        if (path.extension() == ast_file_extension and not ast_file_names.contains(path.filename().string()))
+            fs::remove(path, error_code);
+    }
+}
+
+std::size_t Tsepepe::ParsedFileCache::size() const
+{
+    std::lock_guard lock{entries_mutex};
+    return entries.size();
+}
+
+bool Tsepepe::ParsedFileCache::is_up_to_date(const TranslationUnitFingerprint& fingerprint,
+                                             const fs::path& parsed_file_path) const
+{
+    std::vector<fs::path> dependencies;
+    dependencies.reserve(fingerprint.dependencies.size());
+    for (const auto& [path, content_hash] : fingerprint.dependencies)
+        dependencies.emplace_back(path);
+
+    return Tsepepe::is_up_to_date(fingerprint,
+                                  hash_compile_commands(*compilation_database, parsed_file_path.string()),
+                                  hash_files(dependencies));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static std::string make_entry_key(const fs::path& path, const std::optional<Tsepepe::SourceFileContent>& content)
+{
+    auto key{fs::absolute(path).lexically_normal().string()};
+    if (content)
+        key += '\n' + std::to_string(llvm::xxHash64(content->get_ref()));
+    return key;
+}
+
+static std::vector<fs::path> find_interface_headers(const SourceManager& source_manager,
+                                                    const fs::path& root_directory)
+{
+    static const std::regex pure_virtual_function_regex{"\\bvirtual\\b[^;{}]*=\\s*0\\s*;"};
+
+    std::vector<fs::path> result;
+    for (auto it{source_manager.fileinfo_begin()}; it != source_manager.fileinfo_end(); ++it)
+    {
+        const FileEntry* file_entry{it->first};
+        fs::path path{file_entry->tryGetRealPathName().str()};
+        if (path.empty() or Tsepepe::is_cpp_source_file(path) or not Tsepepe::is_within_directory(path, root_directory))
+            continue;
+
+        auto buffer{llvm::MemoryBuffer::getFile(path.string())};
+        if (not buffer)
+            continue;
+        auto content{(*buffer)->getBuffer()};
+        if (std::regex_search(std::begin(content), std::end(content), pure_virtual_function_regex))
+            result.emplace_back(std::move(path));
+    }
+    return result;
+}
+
+static std::string make_ast_file_name(const std::string& entry_key)
+{
+    return llvm::utohexstr(llvm::xxHash64(entry_key)) + ast_file_extension;
+}
+
+static std::unique_ptr<ASTUnit> load_ast_file(const fs::path& ast_file_path)
+{
+    // Stateless, but referred to by the loaded ASTs, thus it lives as long as the program.
+    static const RawPCHContainerReader pch_container_reader;
+    IntrusiveRefCntPtr<DiagnosticsEngine> diagnostics{
+        new DiagnosticsEngine{new DiagnosticIDs, new DiagnosticOptions, new IgnoringDiagConsumer}};
+
+#if CLANG_VERSION_MAJOR >= 17
+    // Since clang 17, the header search options are given by the caller.
+    return ASTUnit::LoadFromASTFile(ast_file_path.string(),
+                                    pch_container_reader,
+                                    ASTUnit::LoadEverything,
+                                    diagnostics,
+                                    FileSystemOptions{},
+                                    std::make_shared<HeaderSearchOptions>());
+#else
+    return ASTUnit::LoadFromASTFile(
+        ast_file_path.string(), pch_container_reader, ASTUnit::LoadEverything, diagnostics, FileSystemOptions{});
+#endif
+}
@@ -0,0 +1,106 @@
+/**
+ * @file	sharded_class_index.cpp
+ * @brief	Implements the ShardedClassIndex.
+ */
+#include "sharded_class_index.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "translation_unit_cache.hpp"
+
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static fs::path make_canonical(const fs::path&);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::ShardedClassIndex::ShardedClassIndex(std::shared_ptr<clang::tooling::CompilationDatabase> comp_db,
+                                              ShardedClassIndexParameters params) :
+    compilation_database{std::move(comp_db)}
+{
+    std::ranges::transform(params.shard_directories, std::back_inserter(shard_directories), make_canonical);
+    std::ranges::sort(shard_directories);
+    auto duplicates{std::ranges::unique(shard_directories)};
+    shard_directories.erase(std::begin(duplicates), std::end(duplicates));
+    shards = std::vector<Shard>(shard_directories.size() + 1);
+
+    for (std::size_t i{0}; i < shard_directories.size(); ++i)
+    {
+        auto& shard_parameters{shards[i].parameters};
+        shard_parameters = {.root_directory = params.root_directory,
+                            .cache_directory = params.cache_directory,
+                            .shard_directory = shard_directories[i]};
+        for (const auto& other_directory : shard_directories)
+            if (other_directory != shard_directories[i] and is_within_directory(other_directory, shard_directories[i]))
+                shard_parameters.excluded_directories.push_back(other_directory);
+    }
+
+    // Without any shard directory, the rest of the project is the whole project, cached as the unsharded index is.
+    shards.back().parameters = {.root_directory = params.root_directory,
+                                .cache_directory = params.cache_directory,
+                                .excluded_directories = shard_directories};
+}
+
+std::size_t Tsepepe::ShardedClassIndex::get_shards_count() const
+{
+    return shards.size();
+}
+
+Tsepepe::ShardedClassIndex::ShardId Tsepepe::ShardedClassIndex::find_shard(const fs::path& path) const
+{
+    auto canonical_path{make_canonical(path)};
+
+    // All the shard directories containing the path are its ancestors, so the deepest one has the longest path.
+    ShardId result{shards.size() - 1};
+    for (ShardId id{0}; id < shard_directories.size(); ++id)
+        if (is_within_directory(canonical_path, shard_directories[id])
+            and (result == shards.size() - 1
+                 or shard_directories[id].native().size() > shard_directories[result].native().size()))
+            result = id;
+    return result;
+}
+
+const Tsepepe::ClassIndex& Tsepepe::ShardedClassIndex::get_shard(ShardId id)
+{
+    auto& shard{shards[id]};
+    std::call_once(shard.is_indexed, [&] {
+        shard.index = ClassIndexerLibclangBased{compilation_database}.index(shard.parameters);
+    });
+    return shard.index;
+}
+
+Tsepepe::ClassIndex Tsepepe::ShardedClassIndex::merge(std::span<const ShardId> ids)
+{
+    ClassIndex result;
+    for (auto id : ids)
+    {
+        const auto& shard_index{get_shard(id)};
+        std::ranges::copy(shard_index.classes, std::back_inserter(result.classes));
+        result.translation_unit_files.insert(std::begin(shard_index.translation_unit_files),
+                                             std::end(shard_index.translation_unit_files));
+    }
+
+    // The classes from the headers are seen by the translation units of many shards.
+    auto is_same_class{[](const IndexedClass& lhs, const IndexedClass& rhs) {
+        return lhs.qualified_name == rhs.qualified_name and lhs.location == rhs.location;
+    }};
+    std::ranges::sort(result.classes);
+    auto duplicates{std::ranges::unique(result.classes, is_same_class)};
+    result.classes.erase(std::begin(duplicates), std::end(duplicates));
+    return result;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static fs::path make_canonical(const fs::path& path)
+{
+    // Drops the trailing separator, so that 'dir/' and 'dir' make up the same shard.
+    auto result{fs::weakly_canonical(fs::absolute(path))};
+    return result.has_filename() ? result : result.parent_path();
+}
@@ -0,0 +1,94 @@
+/**
+ * @file	source_file_content.cpp
+ * @brief	Implements the SourceFileContent.
+ */
+#include "source_file_content.hpp"
+
+#include "base_error.hpp"
+
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+namespace
+{
+
+//! Owns the string, and exposes its characters as the buffer.
+class StringMemoryBuffer : public llvm::MemoryBuffer
+{
+  public:
+    explicit StringMemoryBuffer(std::string content_) : content{std::move(content_)}
+    {
+        init(content.data(), content.data() + content.size(), /* RequiresNullTerminator = */ true);
+    }
+
+    BufferKind getBufferKind() const override
+    {
+        return MemoryBuffer_Malloc;
+    }
+
+  private:
+    std::string content;
+};
+
+} // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+Tsepepe::SourceFileContent::SourceFileContent() : SourceFileContent{std::string{}}
+{
+}
+
+Tsepepe::SourceFileContent::SourceFileContent(std::string content) :
+    buffer{std::make_shared<StringMemoryBuffer>(std::move(content))}
+{
+}
+
+Tsepepe::SourceFileContent::SourceFileContent(const char* content) : SourceFileContent{std::string{content}}
+{
+}
+
+Tsepepe::SourceFileContent::SourceFileContent(std::unique_ptr<llvm::MemoryBuffer> buffer_) : buffer{std::move(buffer_)}
+{
+}
+
+Tsepepe::SourceFileContent Tsepepe::SourceFileContent::from_file(const fs::path& file_path)
+{
+    // Big enough files get mapped, rather than read.
+    auto file_buffer{llvm::MemoryBuffer::getFile(file_path.string())};
+    if (not file_buffer)
+        throw BaseError{"Failed to read the file: " + file_path.string() + ": " + file_buffer.getError().message()};
+    return SourceFileContent{std::move(*file_buffer)};
+}
+
+Tsepepe::SourceFileContent Tsepepe::SourceFileContent::from_standard_input()
+{
+    auto input_buffer{llvm::MemoryBuffer::getSTDIN()};
+    if (not input_buffer)
+        throw BaseError{"Failed to read the standard input: " + input_buffer.getError().message()};
+    return SourceFileContent{std::move(*input_buffer)};
+}
+
+std::string_view Tsepepe::SourceFileContent::view() const
+{
+    auto data{buffer->getBuffer()};
+    return {data.data(), data.size()};
+}
+
+llvm::StringRef Tsepepe::SourceFileContent::get_ref() const
+{
+    return buffer->getBuffer();
+}
+
+fs::path Tsepepe::make_virtual_source_file_path(const fs::path& path, const std::string& id)
+{
+    fs::path result;
+    if (not fs::is_directory(path))
+        // Assume the path is a path to a file.
+        result = path.parent_path() / (".tsepepe_" + path.filename().string());
+    else
+        result = path / (".tsepepe_" + id + "_temp.hpp");
+    return fs::absolute(result).lexically_normal();
+}
@@ -0,0 +1,183 @@
+/**
+ * @file	translation_unit_cache.cpp
+ * @brief	Implements the building blocks of the per translation unit caches.
+ */
+#include "translation_unit_cache.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/xxhash.h>
+
+#include "bulk_file_reader.hpp"
+#include "index_segment.hpp"
+
+namespace fs = std::filesystem;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static std::optional<std::uint64_t> parse_hash(std::optional<llvm::StringRef> hex);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+std::uint64_t Tsepepe::hash_compile_commands(const clang::tooling::CompilationDatabase& compilation_database,
+                                             const std::string& translation_unit)
+{
+    std::string compile_commands;
+    for (const auto& compile_command : compilation_database.getCompileCommands(translation_unit))
+    {
+        compile_commands += compile_command.Directory;
+        for (const auto& argument : compile_command.CommandLine)
+        {
+            compile_commands += '\0';
+            compile_commands += argument;
+        }
+        compile_commands += '\n';
+    }
+    // Zero is reserved for the results, which shall not be cached.
+    return std::max<std::uint64_t>(llvm::xxHash64(compile_commands), 1);
+}
+
+Tsepepe::FileHashes Tsepepe::hash_files(const std::vector<fs::path>& file_paths)
+{
+    FileHashes result;
+    read_files_in_bulk(file_paths, [&](std::size_t file_index, std::optional<llvm::StringRef> content) {
+        if (content)
+            result.try_emplace(file_paths[file_index].string(), llvm::xxHash64(*content));
+    });
+    return result;
+}
+
+bool Tsepepe::is_within_directory(const fs::path& path, const fs::path& directory)
+{
+    auto relative_path{path.lexically_relative(directory)};
+    return not relative_path.empty() and *std::begin(relative_path) != "..";
+}
+
+Tsepepe::TranslationUnitFingerprint Tsepepe::fingerprint_translation_unit(const clang::SourceManager& source_manager,
+                                                                          std::uint64_t compile_command_hash,
+                                                                          const fs::path& root_directory)
+{
+    TranslationUnitFingerprint result{.compile_command_hash = compile_command_hash};
+    for (auto it{source_manager.fileinfo_begin()}; it != source_manager.fileinfo_end(); ++it)
+    {
+        const clang::FileEntry* file_entry{it->first};
+        fs::path path{file_entry->tryGetRealPathName().str()};
+        if (path.empty() or not is_within_directory(path, root_directory))
+            continue;
+        // A file, which is not loaded, has not been parsed, e.g. it has been only looked up.
+        if (auto content{it->second->getBufferDataIfLoaded()}; content)
+            result.dependencies.emplace(path.string(), llvm::xxHash64(*content));
+    }
+    return result;
+}
+
+bool Tsepepe::is_up_to_date(const TranslationUnitFingerprint& fingerprint,
+                            std::uint64_t compile_command_hash,
+                            const FileHashes& current_file_hashes)
+{
+    if (fingerprint.compile_command_hash != compile_command_hash)
+        return false;
+    return std::ranges::all_of(fingerprint.dependencies, [&](const auto& dependency) {
+        const auto& [path, content_hash] = dependency;
+        auto it{current_file_hashes.find(path)};
+        return it != std::end(current_file_hashes) and it->second == content_hash;
+    });
+}
+
+void Tsepepe::add_to_json(const TranslationUnitFingerprint& fingerprint, llvm::json::Object& object)
+{
+    // The hashes are stored as hex strings, since the JSON integers are signed.
+    llvm::json::Object dependencies;
+    for (const auto& [path, content_hash] : fingerprint.dependencies)
+        dependencies[path] = llvm::utohexstr(content_hash);
+
+    object["compile_command_hash"] = llvm::utohexstr(fingerprint.compile_command_hash);
+    object["dependencies"] = std::move(dependencies);
+}
+
+std::optional<Tsepepe::TranslationUnitFingerprint> Tsepepe::fingerprint_from_json(const llvm::json::Object& object)
+{
+    TranslationUnitFingerprint result;
+    auto compile_command_hash{parse_hash(object.getString("compile_command_hash"))};
+    if (not compile_command_hash)
+        return std::nullopt;
+    result.compile_command_hash = *compile_command_hash;
+
+    auto dependencies{object.getObject("dependencies")};
+    if (dependencies == nullptr)
+        return std::nullopt;
+    for (const auto& [path, value] : *dependencies)
+    {
+        auto content_hash{parse_hash(value.getAsString())};
+        if (not content_hash)
+            return std::nullopt;
+        result.dependencies.emplace(path.str(), *content_hash);
+    }
+    return result;
+}
+
+llvm::json::Object Tsepepe::load_cache_records(const fs::path& cache_file_path,
+                                               std::int64_t format_version,
+                                               llvm::StringRef records_key)
+{
+    auto buffer{llvm::MemoryBuffer::getFile(cache_file_path.string())};
+    if (not buffer)
+        return {};
+
+    auto json{llvm::json::parse((*buffer)->getBuffer())};
+    if (not json)
+    {
+        llvm::consumeError(json.takeError());
+        return {};
+    }
+
+    auto root{json->getAsObject()};
+    if (root == nullptr or root->getInteger("version") != format_version)
+        return {};
+
+    auto records{root->getObject(records_key)};
+    if (records == nullptr)
+        return {};
+    return std::move(*records);
+}
+
+void Tsepepe::store_cache_records(const fs::path& cache_file_path,
+                                  std::int64_t format_version,
+                                  llvm::StringRef records_key,
+                                  llvm::json::Object records)
+{
+    llvm::json::Value json{llvm::json::Object{{"version", format_version}, {records_key, std::move(records)}}};
+
+    std::string content;
+    llvm::raw_string_ostream{content} << json;
+    replace_file_atomically(cache_file_path, {content});
+}
+
+llvm::json::Object Tsepepe::load_translation_unit_cache(const fs::path& cache_file_path, std::int64_t format_version)
+{
+    return load_cache_records(cache_file_path, format_version, "translation_units");
+}
+
+void Tsepepe::store_translation_unit_cache(const fs::path& cache_file_path,
+                                           std::int64_t format_version,
+                                           llvm::json::Object translation_units)
+{
+    store_cache_records(cache_file_path, format_version, "translation_units", std::move(translation_units));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static std::optional<std::uint64_t> parse_hash(std::optional<llvm::StringRef> hex)
+{
+    std::uint64_t result;
+    if (not hex or hex->getAsInteger(16, result))
+        return std::nullopt;
+    return result;
+}
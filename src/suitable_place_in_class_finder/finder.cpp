@@ -8,6 +8,7 @@
 #include <clang/Tooling/Tooling.h>
 
 #include <algorithm>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -27,10 +28,61 @@ namespace fs = std::filesystem;
 // --------------------------------------------------------------------------------------------------------------------
 // Private stuff
 // --------------------------------------------------------------------------------------------------------------------
+//! Runs the search for the lines with the 'public' access specifiers only once per header, and only when needed.
+class PublicAccessSpecifierLines
+{
+  public:
+    explicit PublicAccessSpecifierLines(fs::path header_file) : header_file{std::move(header_file)}
+    {
+    }
+
+    const std::vector<unsigned>& get()
+    {
+        if (not lines)
+            lines = find_lines();
+        return *lines;
+    }
+
+  private:
+    std::vector<unsigned> find_lines() const
+    {
+        std::string command{"rg --line-number \"public\\s*:\" " + header_file.string()};
+
+        using namespace boost::process;
+        ipstream pipe_stream;
+        child c{std::move(command), std_out > pipe_stream};
+        std::string line;
+
+        std::vector<unsigned> result;
+        result.reserve(16);
+
+        while (pipe_stream && std::getline(pipe_stream, line) && !line.empty())
+        {
+            auto colon_idx{line.find(':')};
+            if (colon_idx == std::string::npos)
+                continue;
+            auto line_number_str{line.substr(0, colon_idx)};
+            result.emplace_back(std::stoul(line_number_str));
+        }
+        c.wait();
+
+        return result;
+    }
+
+    fs::path header_file;
+    std::optional<std::vector<unsigned>> lines;
+};
+
 class LineFinder : public ast::MatchFinder::MatchCallback
 {
   public:
-    LineFinder(fs::path header_file) : printing_policy{lang_options}, header_file{std::move(header_file)}
+    LineFinder(Tsepepe::SuitablePlaceInClassFinder::SuitablePlaces& suitable_places,
+               std::optional<std::string> queried_class_name,
+               PublicAccessSpecifierLines& public_access_specifier_lines) :
+        suitable_places{suitable_places},
+        queried_class_name{std::move(queried_class_name)},
+        public_access_specifier_lines{public_access_specifier_lines},
+        printing_policy{lang_options}
     {
         printing_policy.adjustForCPlusPlus();
     }
@@ -43,36 +95,26 @@ class LineFinder : public ast::MatchFinder::MatchCallback
 
         const auto& source_manager{result.Context->getSourceManager()};
 
+        Tsepepe::SuitablePlaceInClassFinder::SuitablePlace suitable_place{.line = 0,
+                                                                          .is_public_section_needed = false};
         auto last_public_method_in_first_public_method_chain{find_last_public_method_in_first_public_chain(node)};
         if (last_public_method_in_first_public_method_chain != nullptr)
         {
             auto end_source_loc{last_public_method_in_first_public_method_chain->getEndLoc()};
-            found_line_number = source_manager.getPresumedLoc(end_source_loc).getLine();
+            suitable_place.line = source_manager.getPresumedLoc(end_source_loc).getLine();
         } else if (auto maybe_first_public_section{try_find_line_with_public_section(node, source_manager)};
                    maybe_first_public_section)
         {
-            found_line_number = *maybe_first_public_section;
+            suitable_place.line = *maybe_first_public_section;
         } else
         {
-            found_line_number = find_line_with_opening_bracket(node, source_manager);
+            suitable_place.line = find_line_with_opening_bracket(node, source_manager);
             if (not node->isStruct())
-                is_public_section_needed = true;
+                suitable_place.is_public_section_needed = true;
         }
-    }
-
-    std::optional<std::string> get_result() const
-    {
-        if (!found_line_number)
-            return {};
 
-        std::string r;
-        r.reserve(16);
-        r = std::to_string(*found_line_number);
-
-        if (is_public_section_needed)
-            r.append("p");
-
-        return r;
+        auto key{queried_class_name ? *queried_class_name : node->getQualifiedNameAsString()};
+        suitable_places.insert_or_assign(std::move(key), suitable_place);
     }
 
   private:
@@ -119,36 +161,12 @@ class LineFinder : public ast::MatchFinder::MatchCallback
             return std::make_pair(class_body_begin_line, class_body_end_line);
         }};
 
-        auto get_line_nums_with_public_access_specifier_declarations{[&]() -> std::vector<unsigned> {
-            std::string command{"rg --line-number \"public\\s*:\" " + header_file.string()};
-
-            using namespace boost::process;
-            ipstream pipe_stream;
-            child c{std::move(command), std_out > pipe_stream};
-            std::string line;
-
-            std::vector<unsigned> result;
-            result.reserve(16);
-
-            while (pipe_stream && std::getline(pipe_stream, line) && !line.empty())
-            {
-                auto colon_idx{line.find(':')};
-                if (colon_idx == std::string::npos)
-                    continue;
-                auto line_number_str{line.substr(0, colon_idx)};
-                result.emplace_back(std::stoul(line_number_str));
-            }
-            c.wait();
-
-            return result;
-        }};
-
         auto class_body_line_range{get_class_body_begin_end_lines()};
         auto is_line_within_class_body{[&](unsigned line) {
             return line >= class_body_line_range.first and line <= class_body_line_range.second;
         }};
 
-        auto lines_with_public_access_specifier_declarations{get_line_nums_with_public_access_specifier_declarations()};
+        const auto& lines_with_public_access_specifier_declarations{public_access_specifier_lines.get()};
         auto public_section_within_the_class_it{
             std::ranges::find_if(lines_with_public_access_specifier_declarations, is_line_within_class_body)};
         if (public_section_within_the_class_it != std::end(lines_with_public_access_specifier_declarations))
@@ -175,24 +193,39 @@ class LineFinder : public ast::MatchFinder::MatchCallback
         return source_manager.getSpellingLineNumber(location);
     }
 
-    std::optional<unsigned> found_line_number;
-    bool is_public_section_needed{false};
+    Tsepepe::SuitablePlaceInClassFinder::SuitablePlaces& suitable_places;
+    std::optional<std::string> queried_class_name;
+    PublicAccessSpecifierLines& public_access_specifier_lines;
 
     clang::LangOptions lang_options;
     clang::PrintingPolicy printing_policy;
-    fs::path header_file;
 };
 
 // --------------------------------------------------------------------------------------------------------------------
 // Public stuff
 // --------------------------------------------------------------------------------------------------------------------
-std::optional<std::string> Tsepepe::SuitablePlaceInClassFinder::find(const Input& input)
+std::string Tsepepe::SuitablePlaceInClassFinder::SuitablePlace::to_string() const
+{
+    std::string r;
+    r.reserve(16);
+    r = std::to_string(line);
+
+    if (is_public_section_needed)
+        r.append("p");
+
+    return r;
+}
+
+Tsepepe::SuitablePlaceInClassFinder::SuitablePlaces Tsepepe::SuitablePlaceInClassFinder::find(const Input& input)
 {
-    auto class_matcher{ast_matchers::cxxRecordDecl(ast_matchers::hasName(input.class_name)).bind("class")};
+    SuitablePlaces result;
+    PublicAccessSpecifierLines public_access_specifier_lines{input.header_file};
 
     ast::MatchFinder finder;
-    LineFinder line_finder{input.header_file};
-    finder.addMatcher(class_matcher, &line_finder);
+    auto line_finders{Tsepepe::utils::clang_ast::add_class_matchers(
+        finder, input.class_query, ast_matchers::anything(), [&](std::optional<std::string> queried_class_name) {
+            return std::make_unique<LineFinder>(result, std::move(queried_class_name), public_access_specifier_lines);
+        })};
 
     ClangTool tool{*input.compilation_database_ptr, {input.header_file}};
 
@@ -201,5 +234,5 @@ std::optional<std::string> Tsepepe::SuitablePlaceInClassFinder::find(const Input
 
     tool.run(newFrontendActionFactory(&finder).get());
 
-    return line_finder.get_result();
+    return result;
 }
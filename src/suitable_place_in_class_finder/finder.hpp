@@ -5,7 +5,7 @@
 #ifndef FINDER_HPP
 #define FINDER_HPP
 
-#include <optional>
+#include <map>
 #include <string>
 
 #include "input.hpp"
@@ -13,11 +13,22 @@
 namespace Tsepepe::SuitablePlaceInClassFinder
 {
 
-/**
- * @returns Maybe a line with additional 'p' sign, which means that line 'public:' must be added below the line, and
- *          above the new content.
- */
-std::optional<std::string> find(const Input&);
+struct SuitablePlace
+{
+    //! The line after which a new public declaration may be appended.
+    unsigned line;
+    //! Tells whether the line 'public:' must be added below the line, and above the new content.
+    bool is_public_section_needed;
+
+    //! Returns the line with additional 'p' sign, when the public section is needed.
+    std::string to_string() const;
+};
+
+//! Maps the queried class name (or the full class name, when all the classes are queried) to its suitable place.
+using SuitablePlaces = std::map<std::string, SuitablePlace>;
+
+//! Finds all the queried classes within a single pass over the header; the classes not found are absent.
+SuitablePlaces find(const Input&);
 
 }; // namespace Tsepepe::SuitablePlaceInClassFinder
 
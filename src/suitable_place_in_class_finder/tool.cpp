@@ -4,25 +4,43 @@
  */
 #include <iostream>
 
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
 #include "cmd_parser.hpp"
 #include "finder.hpp"
+#include "tool.hpp"
 
 using namespace Tsepepe::SuitablePlaceInClassFinder;
 
-int main(int argc, const char** argv)
+int Tsepepe::SuitablePlaceInClassFinder::run(int argc, const char** argv)
 {
     auto input_or_return_code{parse_cmd(argc, argv)};
     if (std::holds_alternative<ReturnCode>(input_or_return_code))
         return std::get<ReturnCode>(input_or_return_code);
 
     const auto& input{std::get<Input>(input_or_return_code)};
-    auto maybe_suitable_line{find(input)};
-    if (!maybe_suitable_line)
+    auto suitable_places{find(input)};
+    if (suitable_places.empty())
     {
         std::cerr << "ERROR: no suitable place in class found!" << std::endl;
         return 1;
     }
 
-    std::cout << *maybe_suitable_line << std::endl;
+    if (input.class_query.is_single_class())
+    {
+        std::cout << suitable_places.begin()->second.to_string() << std::endl;
+        return 0;
+    }
+
+    llvm::json::OStream json{llvm::outs(), 2};
+    json.object([&] {
+        for (const auto& [class_name, suitable_place] : suitable_places)
+            json.attributeObject(class_name, [&] {
+                json.attribute("line", suitable_place.line);
+                json.attribute("is_public_section_needed", suitable_place.is_public_section_needed);
+            });
+    });
+    llvm::outs() << '\n';
     return 0;
 }
@@ -0,0 +1,43 @@
+/**
+ * @file	usage.cpp
+ * @brief	Prints the usage of the suitable place in class finder.
+ */
+#include <iostream>
+
+#include "tool.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+void Tsepepe::SuitablePlaceInClassFinder::print_usage(int argc, const char** argv)
+{
+    auto program_path{argv[0]};
+    std::cout << "USAGE:\n\t" << program_path << " COMP_DB_DIR HEADER_FILE CLASS_NAME...\n\t" << program_path
+              << " COMP_DB_DIR HEADER_FILE --all\n\n";
+    std::cout << "DESCRIPTION:\n\tPrints out the number of line after which a new public declaration may be appended."
+                 "\n\tIt will be the last line of the first 'public' section within the class."
+                 "\n\tThe input file HEADER_FILE must contain the class called CLASS_NAME."
+                 "\n\tRequires compilation database (compile_commands.json) put in the COMP_DB_DIR directory."
+                 "\n\n\tMany CLASS_NAMEs may be given at once, or the --all option, to query all the classes defined"
+                 "\n\twithin the HEADER_FILE; the header is parsed only once then. The output is then a JSON object,"
+                 "\n\twhich maps each class name (the full class name, for --all) to the result for that class."
+                 "\n\n"
+                 "EXAMPLE:"
+                 "\n\tHaving a header file \"printer.hpp\" with content:"
+                 "\n\t\tclass Printer {"
+                 "\n\t\t  private:"
+                 "\n\t\t\tint some_member;"
+                 "\n\t\t\tfloat some_member;"
+                 "\n\t\t  public:"
+                 "\n\t\t\tvoid some_method1();"
+                 "\n\t\t\tfloat some_method2();"
+                 "\n\t\t  private:"
+                 "\n\t\t\t// ..."
+                 "\n\n\tWhen the tool is called like that:"
+                 "\n\n\t\ttsepepe_suitable_place_in_class_finder path/to/dir/with/comp/db printer.hpp Printer"
+                 "\n\n\tThe output will be:"
+                 "\n\n\t\t7"
+                 "\n\n\tBecause the seventh line is the last line of the first 'public' section within the class."
+                 "\n"
+              << std::endl;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file	clang_commands_loader.cpp
+ * @brief	Implements the on demand loading of the clang commands module.
+ */
+#include <dlfcn.h>
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <system_error>
+
+#include "clang_commands_loader.hpp"
+#include "clang_commands_module.hpp"
+
+namespace fs = std::filesystem;
+
+using namespace Tsepepe::MultiCall;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+//! Resolves the symlinks, i.e. the tsepepe_<command> names, to the directory of the binary itself.
+static fs::path get_binary_directory();
+
+//! Returns nullptr, and prints out the reason, when the module could not be loaded.
+static RunClangCommand load_clang_commands_module();
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+int Tsepepe::MultiCall::run_clang_command(std::string_view name, int argc, const char** argv)
+{
+    auto run{load_clang_commands_module()};
+    if (run == nullptr)
+        return 1;
+    return run(std::string{name}.c_str(), argc, argv);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static fs::path get_binary_directory()
+{
+    std::error_code error;
+    auto binary_path{fs::read_symlink("/proc/self/exe", error)};
+    return error ? fs::path{} : binary_path.parent_path();
+}
+
+static RunClangCommand load_clang_commands_module()
+{
+    auto binary_directory{get_binary_directory()};
+    const fs::path candidates[]{
+        binary_directory / TSEPEPE_CLANG_COMMANDS_MODULE_FILE_NAME,
+        binary_directory / TSEPEPE_CLANG_COMMANDS_MODULE_INSTALL_DIR / TSEPEPE_CLANG_COMMANDS_MODULE_FILE_NAME};
+
+    for (const auto& candidate : candidates)
+    {
+        if (not fs::exists(candidate))
+            continue;
+
+        // Resolves all the symbols up front, so that a broken installation fails here, rather than amid a command.
+        // The module is never unloaded, as the clang libraries register their globals to be destroyed at exit.
+        auto handle{dlopen(candidate.c_str(), RTLD_NOW | RTLD_LOCAL)};
+        if (handle == nullptr)
+        {
+            std::cerr << "ERROR: Failed to load the clang commands module: " << dlerror() << std::endl;
+            return nullptr;
+        }
+
+        auto run{dlsym(handle, run_clang_command_symbol)};
+        if (run == nullptr)
+        {
+            std::cerr << "ERROR: Invalid clang commands module: " << candidate << ": " << dlerror() << std::endl;
+            return nullptr;
+        }
+        return reinterpret_cast<RunClangCommand>(run);
+    }
+
+    std::cerr << "ERROR: The clang commands module (" << TSEPEPE_CLANG_COMMANDS_MODULE_FILE_NAME
+              << ") not found next to the tsepepe binary, nor under: "
+              << (binary_directory / TSEPEPE_CLANG_COMMANDS_MODULE_INSTALL_DIR) << std::endl;
+    return nullptr;
+}
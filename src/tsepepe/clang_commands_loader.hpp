@@ -0,0 +1,26 @@
+/**
+ * @file        clang_commands_loader.hpp
+ * @brief       Loads the clang commands module, on demand.
+ */
+#ifndef CLANG_COMMANDS_LOADER_HPP
+#define CLANG_COMMANDS_LOADER_HPP
+
+#include <string_view>
+
+namespace Tsepepe::MultiCall
+{
+
+/**
+ * @brief Runs the command depending on clang, with the given command line arguments.
+ *
+ * The clang commands module, and the clang libraries with it, are loaded only then. The module is looked up next to the
+ * tsepepe binary (i.e. within the build tree), and then in the installation directory of the module, relative to the
+ * binary.
+ *
+ * @returns The exit code of the command, or 1 when the module could not be loaded.
+ */
+int run_clang_command(std::string_view name, int argc, const char** argv);
+
+} // namespace Tsepepe::MultiCall
+
+#endif /* CLANG_COMMANDS_LOADER_HPP */
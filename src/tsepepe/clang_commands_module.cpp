@@ -0,0 +1,74 @@
+/**
+ * @file	clang_commands_module.cpp
+ * @brief	Implements the module, which runs the commands depending on clang.
+ */
+#include <algorithm>
+#include <iostream>
+#include <string_view>
+#include <type_traits>
+
+#include "abstract_class_finder/tool.hpp"
+#include "class_reporter/tool.hpp"
+#include "declaration_drift_detector/tool.hpp"
+#include "full_class_name_expander/tool.hpp"
+#include "function_definition_generator/tool.hpp"
+#include "implementor_maker/tool.hpp"
+#include "include_resolver/tool.hpp"
+#include "inheritance_graph_query/tool.hpp"
+#include "interface_completer/tool.hpp"
+#include "missing_definitions_generator/tool.hpp"
+#include "missing_overrides_generator/tool.hpp"
+#include "paired_definition_generator/tool.hpp"
+#include "pure_virtual_functions_extractor/tool.hpp"
+#include "suitable_place_in_class_finder/tool.hpp"
+
+#include "clang_commands_module.hpp"
+#include "commands.hpp"
+
+using namespace Tsepepe;
+using namespace Tsepepe::MultiCall;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private helper types
+// --------------------------------------------------------------------------------------------------------------------
+struct ClangCommand
+{
+    std::string_view name;
+    CommandFunction run;
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static constexpr ClangCommand clang_commands[]{
+    {"abstract_class_finder", &AbstractClassFinder::run},
+    {"class_reporter", &ClassReporter::run},
+    {"declaration_drift_detector", &DeclarationDriftDetector::run},
+    {"full_class_name_expander", &FullClassNameExpander::run},
+    {"function_definition_generator", &FunctionDefinitionGenerator::run},
+    {"implementor_maker", &ImplementorMaker::run},
+    {"include_resolver", &IncludeResolver::run},
+    {"inheritance_graph_query", &InheritanceGraphQuery::run},
+    {"interface_completer", &InterfaceCompleter::run},
+    {"missing_definitions_generator", &MissingDefinitionsGenerator::run},
+    {"missing_overrides_generator", &MissingOverridesGenerator::run},
+    {"paired_definition_generator", &PairedDefinitionGenerator::run},
+    {"pure_virtual_functions_extractor", &PureVirtualFunctionsExtractor::run},
+    {"suitable_place_in_class_finder", &SuitablePlaceInClassFinder::run},
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+extern "C" int tsepepe_run_clang_command(const char* name, int argc, const char** argv)
+{
+    static_assert(std::is_same_v<decltype(&tsepepe_run_clang_command), RunClangCommand>);
+
+    auto it{std::ranges::find(clang_commands, std::string_view{name}, &ClangCommand::name)};
+    if (it == std::end(clang_commands))
+    {
+        std::cerr << "ERROR: No such command: " << name << std::endl;
+        return 1;
+    }
+    return it->run(argc, argv);
+}
@@ -0,0 +1,27 @@
+/**
+ * @file        clang_commands_module.hpp
+ * @brief       The interface of the module, which runs the commands depending on clang.
+ *
+ * The module links the clang and LLVM libraries, so that the tsepepe binary does not. The binary loads the module only
+ * when a command needs clang, so e.g. printing the usage, or finding a paired C++ file, neither loads, nor initializes
+ * the clang libraries.
+ */
+#ifndef CLANG_COMMANDS_MODULE_HPP
+#define CLANG_COMMANDS_MODULE_HPP
+
+namespace Tsepepe::MultiCall
+{
+
+//! The name of the function, exported by the module, which runs the command; see the RunClangCommand type.
+inline constexpr char run_clang_command_symbol[]{"tsepepe_run_clang_command"};
+
+/**
+ * @brief Runs the command with the given name, as if it were a standalone program.
+ *
+ * @returns The exit code of the command, or 1 when there is no such command.
+ */
+using RunClangCommand = int (*)(const char* name, int argc, const char** argv);
+
+} // namespace Tsepepe::MultiCall
+
+#endif /* CLANG_COMMANDS_MODULE_HPP */
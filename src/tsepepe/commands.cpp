@@ -0,0 +1,65 @@
+/**
+ * @file	commands.cpp
+ * @brief	Implements the table of the commands of the tsepepe multi-call binary.
+ */
+#include <algorithm>
+
+#include "abstract_class_finder/tool.hpp"
+#include "class_reporter/tool.hpp"
+#include "declaration_drift_detector/tool.hpp"
+#include "full_class_name_expander/tool.hpp"
+#include "function_definition_generator/tool.hpp"
+#include "implementor_maker/tool.hpp"
+#include "include_resolver/tool.hpp"
+#include "inheritance_graph_query/tool.hpp"
+#include "interface_completer/tool.hpp"
+#include "missing_definitions_generator/tool.hpp"
+#include "missing_overrides_generator/tool.hpp"
+#include "paired_cpp_file_finder/tool.hpp"
+#include "paired_definition_generator/tool.hpp"
+#include "pure_virtual_functions_extractor/tool.hpp"
+#include "suitable_place_in_class_finder/tool.hpp"
+
+#include "commands.hpp"
+
+using namespace Tsepepe;
+using namespace Tsepepe::MultiCall;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static constexpr Command commands[]{
+    {"abstract_class_finder", &AbstractClassFinder::print_usage, nullptr},
+    {"class_reporter", &ClassReporter::print_usage, nullptr},
+    {"declaration_drift_detector", &DeclarationDriftDetector::print_usage, nullptr},
+    {"full_class_name_expander", &FullClassNameExpander::print_usage, nullptr},
+    {"function_definition_generator", &FunctionDefinitionGenerator::print_usage, nullptr},
+    {"implementor_maker", &ImplementorMaker::print_usage, nullptr},
+    {"include_resolver", &IncludeResolver::print_usage, nullptr},
+    {"inheritance_graph_query", &InheritanceGraphQuery::print_usage, nullptr},
+    {"interface_completer", &InterfaceCompleter::print_usage, nullptr},
+    {"missing_definitions_generator", &MissingDefinitionsGenerator::print_usage, nullptr},
+    {"missing_overrides_generator", &MissingOverridesGenerator::print_usage, nullptr},
+    {"paired_cpp_file_finder", &PairedCppFileFinder::print_usage, &PairedCppFileFinder::run},
+    {"paired_definition_generator", &PairedDefinitionGenerator::print_usage, nullptr},
+    {"pure_virtual_functions_extractor", &PureVirtualFunctionsExtractor::print_usage, nullptr},
+    {"suitable_place_in_class_finder", &SuitablePlaceInClassFinder::print_usage, nullptr},
+};
+
+static_assert(std::ranges::is_sorted(commands, {}, &Command::name));
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+std::span<const Command> Tsepepe::MultiCall::get_commands()
+{
+    return commands;
+}
+
+const Command* Tsepepe::MultiCall::find_command(std::string_view name)
+{
+    auto it{std::ranges::lower_bound(commands, name, {}, &Command::name)};
+    if (it == std::end(commands) or it->name != name)
+        return nullptr;
+    return it;
+}
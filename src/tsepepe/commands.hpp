@@ -0,0 +1,34 @@
+/**
+ * @file        commands.hpp
+ * @brief       The commands of the tsepepe multi-call binary.
+ */
+#ifndef COMMANDS_HPP
+#define COMMANDS_HPP
+
+#include <span>
+#include <string_view>
+
+namespace Tsepepe::MultiCall
+{
+
+using CommandFunction = int (*)(int argc, const char** argv);
+using UsagePrinter = void (*)(int argc, const char** argv);
+
+struct Command
+{
+    std::string_view name;
+    UsagePrinter print_usage;
+
+    //! Set only for the commands, which do not need clang; the others are run by the clang commands module.
+    CommandFunction run;
+};
+
+//! Sorted by the name.
+std::span<const Command> get_commands();
+
+//! Returns nullptr, when there is no such command.
+const Command* find_command(std::string_view name);
+
+} // namespace Tsepepe::MultiCall
+
+#endif /* COMMANDS_HPP */
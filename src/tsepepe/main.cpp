@@ -0,0 +1,117 @@
+/**
+ * @file	main.cpp
+ * @brief	Entry point for the tsepepe multi-call binary.
+ *
+ * The command is either given as the first argument, like: "tsepepe paired_cpp_file_finder ...", or by the name the
+ * binary is called with, like: "tsepepe_paired_cpp_file_finder ...", i.e. through a symlink to the binary.
+ */
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "clang_commands_loader.hpp"
+#include "commands.hpp"
+
+using namespace Tsepepe::MultiCall;
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private declarations
+// --------------------------------------------------------------------------------------------------------------------
+static constexpr std::string_view symlink_prefix{"tsepepe_"};
+
+static void print_usage(const char* program_path);
+static bool is_help_option(std::string_view arg);
+
+//! Like the utils::cmd::is_command_help_requested(), which is not linked in, to keep the binary free of clang.
+static bool is_command_help_requested(int argc, const char** argv);
+
+static int run_command(const Command&, int argc, const char** argv);
+
+// --------------------------------------------------------------------------------------------------------------------
+// Public stuff
+// --------------------------------------------------------------------------------------------------------------------
+int main(int argc, const char* argv[])
+{
+    auto called_name{std::filesystem::path{argv[0]}.filename().string()};
+    if (called_name.starts_with(symlink_prefix))
+    {
+        auto command_name{std::string_view{called_name}.substr(symlink_prefix.size())};
+        if (auto command{find_command(command_name)}; command != nullptr)
+            return run_command(*command, argc, argv);
+    }
+
+    if (argc < 2)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (is_help_option(argv[1]))
+    {
+        print_usage(argv[0]);
+        return 0;
+    }
+
+    auto command{find_command(argv[1])};
+    if (command == nullptr)
+    {
+        std::cerr << "ERROR: Unknown command: " << argv[1] << "\n" << std::endl;
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // The command sees itself called as "tsepepe COMMAND", e.g. in its usage.
+    std::string program_path{std::string{argv[0]} + " " + argv[1]};
+    std::vector<const char*> command_argv{program_path.c_str()};
+    command_argv.insert(command_argv.end(), argv + 2, argv + argc + 1);
+    return run_command(*command, argc - 1, command_argv.data());
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Private definitions
+// --------------------------------------------------------------------------------------------------------------------
+static void print_usage(const char* program_path)
+{
+    std::cout << "USAGE:\n\t" << program_path << " COMMAND [ARGS...]\n\ttsepepe_COMMAND [ARGS...]\n\n";
+    std::cout << "DESCRIPTION:"
+                 "\n\tRuns the COMMAND, with the ARGS. Each of the commands is available under the tsepepe_COMMAND"
+                 "\n\tname, too, as a symlink to the tsepepe binary."
+                 "\n\n\tThe commands depending on clang load the clang libraries only when run, so e.g. the usage of"
+                 "\n\tany command is printed without loading them. Run:"
+                 "\n\n\t\t"
+              << program_path
+              << " COMMAND --help"
+                 "\n\n\tto print the usage of the COMMAND."
+                 "\n\n"
+                 "COMMANDS:";
+    for (const auto& command : get_commands())
+        std::cout << "\n\t" << command.name;
+    std::cout << "\n" << std::endl;
+}
+
+static bool is_help_option(std::string_view arg)
+{
+    return arg == "--help" or arg == "-h";
+}
+
+static bool is_command_help_requested(int argc, const char** argv)
+{
+    for (int i{1}; i < argc; ++i)
+        if (is_help_option(argv[i]))
+            return true;
+    return false;
+}
+
+static int run_command(const Command& command, int argc, const char** argv)
+{
+    if (command.run != nullptr)
+        return command.run(argc, argv);
+
+    if (is_command_help_requested(argc, argv))
+    {
+        command.print_usage(argc, argv);
+        return 0;
+    }
+    return run_clang_command(command.name, argc, argv);
+}
@@ -40,4 +40,35 @@ std::string source_range_content_to_string(const clang::SourceRange& source_rang
     return result;
 }
 
+std::vector<std::unique_ptr<ast_matchers::MatchFinder::MatchCallback>>
+add_class_matchers(ast_matchers::MatchFinder& finder,
+                   const cmd::ClassQuery& query,
+                   const ast_matchers::internal::Matcher<CXXRecordDecl>& class_constraint,
+                   const ClassMatchCallbackMaker& make_callback)
+{
+    using namespace ast_matchers;
+
+    std::vector<std::unique_ptr<MatchFinder::MatchCallback>> result;
+    result.reserve(query.class_names.size() + 1);
+
+    if (query.all_classes)
+    {
+        result.emplace_back(make_callback(std::nullopt));
+        finder.addMatcher(cxxRecordDecl(isDefinition(),
+                                        isExpansionInMainFile(),
+                                        unless(isImplicit()),
+                                        unless(isLambda()),
+                                        class_constraint)
+                              .bind("class"),
+                          result.back().get());
+    }
+
+    for (const auto& class_name : query.class_names)
+    {
+        result.emplace_back(make_callback(class_name));
+        finder.addMatcher(cxxRecordDecl(hasName(class_name), class_constraint).bind("class"), result.back().get());
+    }
+    return result;
+}
+
 } // namespace Tsepepe::utils::clang_ast
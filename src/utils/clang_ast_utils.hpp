@@ -6,11 +6,18 @@
 #define CLANG_AST_UTILS_HPP
 
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <clang/ASTMatchers/ASTMatchFinder.h>
 #include <clang/ASTMatchers/ASTMatchers.h>
 #include <clang/Tooling/CompilationDatabase.h>
 
+#include "cmd_utils.hpp"
+
 namespace Tsepepe::utils::clang_ast
 {
 
@@ -43,6 +50,26 @@ struct MatchValidator : MatchCounter
     };
 };
 
+using ClassMatchCallbackMaker = std::function<std::unique_ptr<clang::ast_matchers::MatchFinder::MatchCallback>(
+    std::optional<std::string> queried_class_name)>;
+
+/**
+ * @brief Registers the class matchers for the query within a single MatchFinder, so that all the classes are found
+ * within a single AST traversal.
+ *
+ * A matcher is registered for each queried class name, with the callback made for that name. For the "all classes"
+ * query, a single matcher is registered, which matches each class defined within the main file, and the callback is
+ * made with std::nullopt; the implicit, and the lambda classes are skipped then. Each matcher additionally requires the
+ * class_constraint, and binds the class to "class".
+ *
+ * @returns The callbacks, which must outlive the MatchFinder run.
+ */
+std::vector<std::unique_ptr<clang::ast_matchers::MatchFinder::MatchCallback>>
+add_class_matchers(clang::ast_matchers::MatchFinder&,
+                   const cmd::ClassQuery&,
+                   const clang::ast_matchers::internal::Matcher<clang::CXXRecordDecl>& class_constraint,
+                   const ClassMatchCallbackMaker&);
+
 std::string source_range_content_to_string(const clang::SourceRange& source_range,
                                            const clang::SourceManager& source_manager,
                                            const clang::LangOptions&);
@@ -7,7 +7,10 @@
 #include <cctype>
 #include <cstring>
 #include <string>
+#include <string_view>
 
+#include "base_error.hpp"
+#include "cmd_utils.hpp"
 #include "error.hpp"
 
 namespace Tsepepe::utils::cmd
@@ -34,4 +37,65 @@ int parse_and_validate_number(const char* arg)
     return std::stoi(number_str);
 }
 
+ClassQuery parse_and_validate_class_query(int argc, const char** argv, int first_argument_index)
+{
+    ClassQuery result;
+    for (int i{first_argument_index}; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--all") == 0)
+            result.all_classes = true;
+        else
+            result.class_names.emplace_back(argv[i]);
+    }
+
+    if (result.all_classes and not result.class_names.empty())
+        throw Tsepepe::Error{"Either class names, or the --all option, shall be provided, not both!"};
+    if (not result.all_classes and result.class_names.empty())
+        throw Tsepepe::Error{"No class name provided!"};
+    return result;
+}
+
+SourceFileContent parse_source_file_content(const char* arg)
+{
+    std::string_view argument{arg};
+    try
+    {
+        if (argument == "-")
+            return SourceFileContent::from_standard_input();
+        if (argument.starts_with('@'))
+            return SourceFileContent::from_file(argument.substr(1));
+    } catch (const Tsepepe::BaseError& e)
+    {
+        throw Tsepepe::Error{e.what()};
+    }
+    return SourceFileContent{std::string{argument}};
+}
+
+std::optional<CodeFormattingOptions> take_code_formatting_option(int& argc, const char** argv)
+{
+    static constexpr std::string_view option{"--format"};
+
+    std::optional<CodeFormattingOptions> result;
+    int kept_argc{1};
+    for (int i{1}; i < argc; ++i)
+    {
+        std::string_view argument{argv[i]};
+        if (argument == option)
+        {
+            result.emplace();
+        } else if (argument.starts_with(option) and argument.substr(option.size()).starts_with('='))
+        {
+            result.emplace();
+            if (auto style{argument.substr(option.size() + 1)}; not style.empty())
+                result->style = style;
+        } else
+        {
+            argv[kept_argc++] = argv[i];
+        }
+    }
+    argv[kept_argc] = nullptr;
+    argc = kept_argc;
+    return result;
+}
+
 } // namespace Tsepepe::utils::cmd
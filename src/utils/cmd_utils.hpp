@@ -5,6 +5,13 @@
 #ifndef CMD_UTILS_HPP
 #define CMD_UTILS_HPP
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "code_formatter.hpp"
+#include "source_file_content.hpp"
+
 namespace Tsepepe::utils::cmd
 {
 
@@ -12,5 +19,37 @@ bool is_command_help_requested(int argc, const char** argv);
 
 int parse_and_validate_number(const char* arg);
 
+//! The classes queried by a class-level tool: either the named ones, or all the classes defined within the file.
+struct ClassQuery
+{
+    std::vector<std::string> class_names;
+    bool all_classes{false};
+
+    //! Tells whether a single class is queried by name, for which the tools keep their plain output.
+    bool is_single_class() const
+    {
+        return not all_classes and class_names.size() == 1;
+    }
+};
+
+//! Parses the arguments, starting from the first_argument_index, as class names, or as the "--all" option.
+ClassQuery parse_and_validate_class_query(int argc, const char** argv, int first_argument_index);
+
+/**
+ * @brief Parses the file content argument: "-" reads the content from the standard input, "@PATH" reads, or maps, the
+ * file under the PATH, and anything else is the content itself.
+ *
+ * Passing the content through the standard input, or a file, avoids the command line length limit.
+ */
+SourceFileContent parse_source_file_content(const char* arg);
+
+/**
+ * @brief Takes the "--format", or "--format=STYLE", option out of the arguments, so that the rest of them is parsed as
+ * usual; returns nothing, when the option is not present.
+ *
+ * The STYLE is passed as the clang-format -style option; it is "file" by default.
+ */
+std::optional<CodeFormattingOptions> take_code_formatting_option(int& argc, const char** argv);
+
 } // namespace Tsepepe::utils::cmd
 #endif /* CMD_UTILS_HPP */
@@ -0,0 +1,101 @@
+/**
+ * @file        benchmark_cold_start.cpp
+ * @brief       Measures the start of the tsepepe commands, from spawning the binary, up to its exit.
+ */
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+extern char** environ;
+
+static constexpr std::string_view tsepepe_binary_path{TSEPEPE_BINARY_PATH};
+
+static constexpr std::string_view clang_commands[]{
+    "abstract_class_finder",
+    "class_reporter",
+    "declaration_drift_detector",
+    "full_class_name_expander",
+    "function_definition_generator",
+    "implementor_maker",
+    "include_resolver",
+    "inheritance_graph_query",
+    "interface_completer",
+    "missing_definitions_generator",
+    "missing_overrides_generator",
+    "paired_definition_generator",
+    "pure_virtual_functions_extractor",
+    "suitable_place_in_class_finder",
+};
+
+//! Runs the tsepepe binary with the arguments, with the output discarded; returns the exit code.
+static int run_tsepepe(std::vector<std::string> arguments)
+{
+    arguments.insert(arguments.begin(), std::string{tsepepe_binary_path});
+    std::vector<char*> argv;
+    for (auto& argument : arguments)
+        argv.push_back(argument.data());
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t file_actions;
+    posix_spawn_file_actions_init(&file_actions);
+    posix_spawn_file_actions_addopen(&file_actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen(&file_actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+
+    pid_t pid;
+    auto spawn_result{posix_spawn(&pid, argv[0], &file_actions, nullptr, argv.data(), environ)};
+    posix_spawn_file_actions_destroy(&file_actions);
+    if (spawn_result != 0)
+        return -1;
+
+    int status;
+    if (waitpid(pid, &status, 0) != pid or not WIFEXITED(status))
+        return -1;
+    return WEXITSTATUS(status);
+}
+
+TEST_CASE("Starts the commands, loading clang only when needed", "[MultiCall][benchmark]")
+{
+    const std::string this_file{__FILE__};
+    const std::string this_directory{std::filesystem::path{this_file}.parent_path().string()};
+
+    REQUIRE(run_tsepepe({"--help"}) == 0);
+    REQUIRE(run_tsepepe({"paired_cpp_file_finder", this_directory, this_file}) != -1);
+
+    BENCHMARK("tsepepe --help")
+    {
+        return run_tsepepe({"--help"});
+    };
+
+    BENCHMARK("tsepepe paired_cpp_file_finder, without clang")
+    {
+        return run_tsepepe({"paired_cpp_file_finder", this_directory, this_file});
+    };
+
+    for (auto command : clang_commands)
+    {
+        const std::string command_name{command};
+
+        // The usage is printed without loading clang, whereas the wrong arguments are found by the command itself.
+        REQUIRE(run_tsepepe({command_name, "--help"}) == 0);
+        REQUIRE(run_tsepepe({command_name}) > 0);
+
+        BENCHMARK("tsepepe " + command_name + " --help, without clang")
+        {
+            return run_tsepepe({command_name, "--help"});
+        };
+
+        BENCHMARK("tsepepe " + command_name + ", with clang loaded")
+        {
+            return run_tsepepe({command_name});
+        };
+    }
+}
@@ -0,0 +1,86 @@
+/**
+ * @file        benchmark_full_function_declaration_expander.cpp
+ * @brief       Measures the expansion of the template heavy function declarations.
+ */
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <clang/AST/Decl.h>
+#include <clang/ASTMatchers/ASTMatchFinder.h>
+#include <clang/ASTMatchers/ASTMatchers.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Tooling/Tooling.h>
+
+#include "libclang_utils/full_function_declaration_expander.hpp"
+
+using namespace clang;
+using namespace Tsepepe;
+
+static constexpr unsigned declarations_count{200};
+
+//! Each declaration repeats the same nested template specializations, like a service interface does.
+static std::string make_template_heavy_corpus()
+{
+    std::string result{"#include <map>\n"
+                       "#include <memory>\n"
+                       "#include <optional>\n"
+                       "#include <string>\n"
+                       "#include <tuple>\n"
+                       "#include <unordered_map>\n"
+                       "#include <utility>\n"
+                       "#include <vector>\n"
+                       "namespace Corpus\n"
+                       "{\n"
+                       "template<typename T> struct Box {};\n"
+                       "struct Item {};\n"
+                       "struct Service\n"
+                       "{\n"};
+    for (unsigned i{0}; i < declarations_count; ++i)
+        result += "    std::map<std::string, std::vector<Box<std::pair<Item, std::optional<int>>>>> function_"
+                  + std::to_string(i)
+                  + "(const std::unordered_map<int, std::tuple<Item, Box<Item>, std::shared_ptr<Item>>>& items,"
+                    " std::vector<std::vector<Box<std::string>>> boxes) const;\n";
+    result += "};\n"
+              "} // namespace Corpus\n";
+    return result;
+}
+
+TEST_CASE("Expands the template heavy declarations", "[FullFunctionDeclarationExpander][benchmark]")
+{
+    auto ast_unit{tooling::buildASTFromCodeWithArgs(make_template_heavy_corpus(), {"-std=gnu++20"})};
+    REQUIRE(ast_unit != nullptr);
+
+    using namespace ast_matchers;
+    std::vector<const FunctionDecl*> functions;
+    for (const auto& match :
+         ast_matchers::match(functionDecl(hasParent(cxxRecordDecl(hasName("Service")))).bind("function"),
+                             ast_unit->getASTContext()))
+        functions.push_back(match.getNodeAs<FunctionDecl>("function"));
+    REQUIRE(functions.size() == declarations_count);
+
+    const auto& source_manager{ast_unit->getSourceManager()};
+    auto expand_all{[&](AstPrintingMemo* memo) {
+        std::size_t expanded_size{0};
+        for (auto function : functions)
+            expanded_size += fully_expand_function_declaration(function, source_manager, {}, memo).size();
+        return expanded_size;
+    }};
+
+    AstPrintingMemo memo;
+    REQUIRE(expand_all(nullptr) == expand_all(&memo));
+
+    // Divide the number of the declarations by the mean time to get the declarations expanded per second.
+    BENCHMARK("Expands 200 declarations, each on its own")
+    {
+        return expand_all(nullptr);
+    };
+
+    BENCHMARK("Expands 200 declarations, sharing the memo")
+    {
+        AstPrintingMemo shared_memo;
+        return expand_all(&shared_memo);
+    };
+}
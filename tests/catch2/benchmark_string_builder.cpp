@@ -0,0 +1,133 @@
+/**
+ * @file        benchmark_string_builder.cpp
+ * @brief       Measures the allocations of the code building, with and without the string builder.
+ */
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "string_builder.hpp"
+#include "string_utils.hpp"
+
+using namespace Tsepepe;
+
+static std::atomic<std::size_t> allocations_count{0};
+
+void* operator new(std::size_t size)
+{
+    ++allocations_count;
+    if (auto pointer{std::malloc(size == 0 ? 1 : size)}; pointer != nullptr)
+        return pointer;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+template<typename Function>
+static std::size_t count_allocations(Function function)
+{
+    auto count_before{allocations_count.load()};
+    auto result{function()};
+    auto count{allocations_count.load() - count_before};
+    // The result is destroyed after the counting, so that its deallocation does not interfere.
+    (void)result;
+    return count;
+}
+
+//! The joining, as it was before the string builder: a temporary string per each piece.
+static std::string join_by_accumulation(const std::vector<std::string>& pieces, std::string delim)
+{
+    if (pieces.empty())
+        return "";
+
+    std::string init{pieces.front()};
+    init.reserve(120);
+    return std::accumulate(
+        std::next(std::begin(pieces)), std::end(pieces), std::move(init), [&delim](std::string result, const auto& s) {
+            return std::move(result) + delim + s;
+        });
+}
+
+//! The override block, as it was before the string builder: grown piece by piece.
+static std::string make_overrides_block_by_appending(const std::vector<std::string>& overrides)
+{
+    std::string indentation{"    "};
+    std::string code{"public:\n"};
+    for (const auto& override_ : overrides)
+    {
+        code += indentation;
+        code += override_;
+        code += '\n';
+    }
+    return code;
+}
+
+static std::string make_overrides_block_with_builder(const std::vector<std::string>& overrides)
+{
+    std::string_view public_section{"public:\n"};
+    std::string_view indentation{"    "};
+    std::size_t code_size{public_section.size()};
+    for (const auto& override_ : overrides)
+        code_size += indentation.size() + override_.size() + 1;
+
+    StringBuilder code{code_size};
+    code.append(public_section);
+    for (const auto& override_ : overrides)
+        code.append(indentation).append(override_).append('\n');
+    return code.take();
+}
+
+TEST_CASE("Builds the generated code with a single allocation", "[StringBuilder][benchmark]")
+{
+    std::vector<std::string> parameter_types(
+        16, "const std::unordered_map<int, std::tuple<Item, Box<Item>, std::shared_ptr<Item>>>&");
+    std::vector<std::string> overrides(
+        50, "std::map<std::string, std::vector<Box<std::pair<Item, std::optional<int>>>>> function() const override;");
+
+    REQUIRE(utils::join(parameter_types) == join_by_accumulation(parameter_types, ", "));
+    REQUIRE(make_overrides_block_with_builder(overrides) == make_overrides_block_by_appending(overrides));
+
+    auto join_allocations{count_allocations([&] { return utils::join(parameter_types); })};
+    auto accumulation_allocations{count_allocations([&] { return join_by_accumulation(parameter_types, ", "); })};
+    CHECK(join_allocations == 1);
+    CHECK(accumulation_allocations > join_allocations);
+
+    auto builder_allocations{count_allocations([&] { return make_overrides_block_with_builder(overrides); })};
+    auto appending_allocations{count_allocations([&] { return make_overrides_block_by_appending(overrides); })};
+    CHECK(builder_allocations == 1);
+    CHECK(appending_allocations > 1);
+
+    BENCHMARK("Joins 16 parameters, accumulating the temporaries")
+    {
+        return join_by_accumulation(parameter_types, ", ");
+    };
+
+    BENCHMARK("Joins 16 parameters, with the string builder")
+    {
+        return utils::join(parameter_types);
+    };
+
+    BENCHMARK("Builds 50 overrides, appending piece by piece")
+    {
+        return make_overrides_block_by_appending(overrides);
+    };
+
+    BENCHMARK("Builds 50 overrides, with the string builder")
+    {
+        return make_overrides_block_with_builder(overrides);
+    };
+}
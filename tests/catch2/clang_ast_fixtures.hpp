@@ -17,11 +17,37 @@
 #include <clang/Basic/SourceManager.h>
 #include <clang/Frontend/ASTUnit.h>
 #include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Tooling/JSONCompilationDatabase.h>
 #include <clang/Tooling/Tooling.h>
 
 namespace Tsepepe
 {
 
+//! Makes the compilation database, which contains exactly the specified source files, compiled as C++20, with the
+//! extra flags.
+inline std::shared_ptr<clang::tooling::CompilationDatabase>
+make_compilation_database(const std::filesystem::path& directory,
+                          const std::vector<std::filesystem::path>& files,
+                          const std::string& extra_flags = {})
+{
+    std::string json{"["};
+    for (const auto& file : files)
+    {
+        if (json.size() > 1)
+            json += ',';
+        json += R"({"directory": ")" + directory.string() + R"(", "file": ")" + file.string()
+                + R"(", "command": "c++ -std=c++20 )" + extra_flags + " -c " + file.string() + R"("})";
+    }
+    json += ']';
+
+    std::string error_message;
+    std::shared_ptr<clang::tooling::CompilationDatabase> result{clang::tooling::JSONCompilationDatabase::loadFromBuffer(
+        json, error_message, clang::tooling::JSONCommandLineSyntax::Gnu)};
+    if (result == nullptr)
+        throw std::runtime_error{"Failed to create the compilation database: " + error_message};
+    return result;
+}
+
 struct ClangSingleAstFixture
 {
     explicit ClangSingleAstFixture(const std::string& header_file_content) :
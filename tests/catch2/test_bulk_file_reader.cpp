@@ -0,0 +1,115 @@
+/**
+ * @file        test_bulk_file_reader.cpp
+ * @brief       Tests the bulk file reading.
+ */
+#include <filesystem>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "bulk_file_reader.hpp"
+#include "directory_tree.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Reads plenty of files at once", "[BulkFileReader]")
+{
+    DirectoryTree directory_tree{"temp"};
+
+    GIVEN("Many small files, a file bigger than a single read, an empty file, and a missing one")
+    {
+        std::vector<fs::path> file_paths;
+        std::vector<std::string> file_contents;
+        for (int i{0}; i < 100; ++i)
+        {
+            file_contents.push_back("struct S" + std::to_string(i) + " {};\n");
+            file_paths.push_back(directory_tree.create_file("s" + std::to_string(i) + ".hpp", file_contents.back()));
+        }
+        file_contents.push_back(std::string(300 * 1024, 'x'));
+        file_paths.push_back(directory_tree.create_file("big.hpp", file_contents.back()));
+        file_contents.push_back("");
+        file_paths.push_back(directory_tree.create_file("empty.hpp", file_contents.back()));
+        file_paths.push_back(directory_tree.get_root_absolute_path() / "missing.hpp");
+
+        WHEN("The files are read with a small in-flight window")
+        {
+            std::map<std::size_t, std::optional<std::string>> read_files;
+            bool is_null_terminated{true};
+            read_files_in_bulk(
+                file_paths,
+                [&](std::size_t file_index, std::optional<llvm::StringRef> content) {
+                    if (content)
+                        is_null_terminated = is_null_terminated and content->data()[content->size()] == '\0';
+                    read_files[file_index] = content ? std::optional{content->str()} : std::nullopt;
+                },
+                4);
+
+            THEN("Each file is passed once, with its whole content, followed by a null character")
+            {
+                REQUIRE(read_files.size() == file_paths.size());
+                for (std::size_t i{0}; i < file_contents.size(); ++i)
+                    REQUIRE(read_files.at(i) == file_contents[i]);
+                REQUIRE(is_null_terminated);
+            }
+
+            THEN("The missing file is reported as not read")
+            {
+                REQUIRE(read_files.at(file_paths.size() - 1) == std::nullopt);
+            }
+        }
+
+        WHEN("The consumer throws")
+        {
+            std::size_t consumed_files_count{0};
+            auto read_and_throw{[&] {
+                read_files_in_bulk(file_paths, [&](std::size_t, std::optional<llvm::StringRef>) {
+                    ++consumed_files_count;
+                    throw std::runtime_error{"Stop"};
+                });
+            }};
+
+            THEN("The error is passed to the caller, and the remaining files are not read anymore")
+            {
+                REQUIRE_THROWS_AS(read_and_throw(), std::runtime_error);
+                REQUIRE(consumed_files_count < file_paths.size());
+            }
+        }
+
+        WHEN("Reading fails partway through the batch, with plenty of files still in flight")
+        {
+            auto count_open_files{[] {
+                return std::distance(fs::directory_iterator{"/proc/self/fd"}, fs::directory_iterator{});
+            }};
+            auto open_files_count{count_open_files()};
+
+            std::size_t consumed_files_count{0};
+            auto read_and_fail{[&] {
+                read_files_in_bulk(
+                    file_paths,
+                    [&](std::size_t, std::optional<llvm::StringRef>) {
+                        if (++consumed_files_count == 10)
+                            throw std::runtime_error{"Read failure"};
+                    },
+                    16);
+            }};
+
+            THEN("The error is passed to the caller, no file is left open, and the files can be read again")
+            {
+                REQUIRE_THROWS_AS(read_and_fail(), std::runtime_error);
+                REQUIRE(consumed_files_count == 10);
+                REQUIRE(count_open_files() == open_files_count);
+
+                std::size_t read_files_count{0};
+                read_files_in_bulk(file_paths,
+                                   [&](std::size_t, std::optional<llvm::StringRef>) { ++read_files_count; });
+                REQUIRE(read_files_count == file_paths.size());
+            }
+        }
+    }
+}
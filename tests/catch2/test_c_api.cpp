@@ -0,0 +1,203 @@
+/**
+ * @file        test_c_api.cpp
+ * @brief       Tests the C API of the tsepepe library.
+ */
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <pthread.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "directory_tree.hpp"
+
+#include "tsepepe.h"
+
+using namespace Tsepepe;
+using Catch::Matchers::ContainsSubstring;
+
+using ResultPointer = std::unique_ptr<tsepepe_result, decltype(&tsepepe_result_free)>;
+
+TEST_CASE("Run the code actions in-process, through the C API", "[CApi]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{directory_tree.get_root_absolute_path()};
+    auto root_directory{working_root_dir.string()};
+
+    REQUIRE(tsepepe_api_version() == TSEPEPE_API_VERSION);
+
+    SECTION("A session is not opened without the compilation database")
+    {
+        tsepepe_session_options options{.struct_size = sizeof(tsepepe_session_options),
+                                        .compilation_database_directory = root_directory.c_str(),
+                                        .root_directory = root_directory.c_str()};
+        tsepepe_result* error{nullptr};
+
+        REQUIRE(tsepepe_session_open(&options, &error) == nullptr);
+        ResultPointer result{error, &tsepepe_result_free};
+        REQUIRE(result != nullptr);
+        REQUIRE(tsepepe_result_status(result.get()) == TSEPEPE_STATUS_ERROR);
+        REQUIRE_THAT(tsepepe_result_error_message(result.get()), ContainsSubstring("compilation database"));
+    }
+
+    SECTION("A session is not opened without the struct size of the options")
+    {
+        tsepepe_session_options options{.compilation_database_directory = COMPILATION_DATABASE_DIR,
+                                        .root_directory = root_directory.c_str()};
+        tsepepe_result* error{nullptr};
+
+        REQUIRE(tsepepe_session_open(&options, &error) == nullptr);
+        ResultPointer result{error, &tsepepe_result_free};
+        REQUIRE(tsepepe_result_status(result.get()) == TSEPEPE_STATUS_INVALID_ARGUMENT);
+    }
+
+    SECTION("A session is opened with the options of the first version of the API, which end before the newer ones")
+    {
+        tsepepe_session_options options{.struct_size = offsetof(tsepepe_session_options, clangd_index_directory),
+                                        .compilation_database_directory = COMPILATION_DATABASE_DIR,
+                                        .root_directory = root_directory.c_str()};
+        tsepepe_result* error{nullptr};
+
+        std::unique_ptr<tsepepe_session, decltype(&tsepepe_session_close)> session{
+            tsepepe_session_open(&options, &error), &tsepepe_session_close};
+        REQUIRE(session != nullptr);
+        REQUIRE(error == nullptr);
+    }
+
+    tsepepe_session_options options{.struct_size = sizeof(tsepepe_session_options),
+                                    .compilation_database_directory = COMPILATION_DATABASE_DIR, // From CMakeLists.txt
+                                    .root_directory = root_directory.c_str()};
+    tsepepe_result* error{nullptr};
+    std::unique_ptr<tsepepe_session, decltype(&tsepepe_session_close)> session{tsepepe_session_open(&options, &error),
+                                                                               &tsepepe_session_close};
+    REQUIRE(session != nullptr);
+    REQUIRE(error == nullptr);
+
+    GIVEN("An interface, and a class to implement it")
+    {
+        directory_tree.create_file("runnable.hpp",
+                                   "struct Runnable\n"
+                                   "{\n"
+                                   "    virtual void run() = 0;\n"
+                                   "};\n");
+        auto source_file_path{(working_root_dir / "maker.hpp").string()};
+        std::string class_definition{"struct Maker\n"
+                                     "{\n"
+                                     "};\n"};
+        const char* interface_names[]{"Runnable"};
+        tsepepe_implement_interfaces_request request{.source_file = {.path = source_file_path.c_str(),
+                                                                     .content = class_definition.data(),
+                                                                     .content_size = class_definition.size()},
+                                                     .interface_names = interface_names,
+                                                     .interface_names_count = 1,
+                                                     .cursor_position_line = 1};
+
+        WHEN("The interface is implemented")
+        {
+            ResultPointer result{tsepepe_implement_interfaces(session.get(), &request, nullptr),
+                                 &tsepepe_result_free};
+
+            THEN("The new content of the file is kept by the result")
+            {
+                REQUIRE(tsepepe_result_status(result.get()) == TSEPEPE_STATUS_OK);
+                REQUIRE(tsepepe_result_file_edits_count(result.get()) == 1);
+                REQUIRE(std::string{tsepepe_result_file_path(result.get(), 0)} == source_file_path);
+
+                std::size_t content_size{0};
+                std::string content{tsepepe_result_file_content(result.get(), 0, &content_size)};
+                REQUIRE(content
+                        == "#include \"runnable.hpp\"\n"
+                           "struct Maker : Runnable\n"
+                           "{\n"
+                           "    void run() override;\n"
+                           "};\n");
+                REQUIRE(content_size == content.size());
+            }
+        }
+
+        WHEN("The file is warmed up, before the interface is implemented")
+        {
+            auto get_scheduling_policy{[] {
+                int policy;
+                sched_param parameters;
+                pthread_getschedparam(pthread_self(), &policy, &parameters);
+                return policy;
+            }};
+            auto scheduling_policy{get_scheduling_policy()};
+
+            ResultPointer warm_up_result{tsepepe_warm_up(session.get(), &request.source_file, nullptr),
+                                         &tsepepe_result_free};
+            REQUIRE(tsepepe_result_status(warm_up_result.get()) == TSEPEPE_STATUS_OK);
+            // The background priority is set only for the worker thread of the library.
+            REQUIRE(get_scheduling_policy() == scheduling_policy);
+
+            ResultPointer result{tsepepe_implement_interfaces(session.get(), &request, nullptr),
+                                 &tsepepe_result_free};
+
+            THEN("The interface is implemented as without the warm-up")
+            {
+                REQUIRE(tsepepe_result_status(result.get()) == TSEPEPE_STATUS_OK);
+                REQUIRE(tsepepe_result_file_edits_count(result.get()) == 1);
+                REQUIRE(std::string{tsepepe_result_file_content(result.get(), 0, nullptr)}
+                        == "#include \"runnable.hpp\"\n"
+                           "struct Maker : Runnable\n"
+                           "{\n"
+                           "    void run() override;\n"
+                           "};\n");
+            }
+        }
+
+        WHEN("The request is cancelled, before it is made")
+        {
+            std::unique_ptr<tsepepe_cancellation_token, decltype(&tsepepe_cancellation_token_free)> token{
+                tsepepe_cancellation_token_create(), &tsepepe_cancellation_token_free};
+            tsepepe_cancellation_token_cancel(token.get());
+
+            ResultPointer result{tsepepe_implement_interfaces(session.get(), &request, token.get()),
+                                 &tsepepe_result_free};
+
+            THEN("The request is cancelled, with no file edited")
+            {
+                REQUIRE(tsepepe_result_status(result.get()) == TSEPEPE_STATUS_CANCELLED);
+                REQUIRE(tsepepe_result_file_edits_count(result.get()) == 0);
+            }
+        }
+
+        WHEN("An interface name is NULL")
+        {
+            const char* null_interface_names[]{nullptr};
+            request.interface_names = null_interface_names;
+
+            ResultPointer result{tsepepe_implement_interfaces(session.get(), &request, nullptr),
+                                 &tsepepe_result_free};
+
+            THEN("The request is rejected")
+            {
+                REQUIRE(tsepepe_result_status(result.get()) == TSEPEPE_STATUS_INVALID_ARGUMENT);
+                REQUIRE_THAT(tsepepe_result_error_message(result.get()), ContainsSubstring("Interface name"));
+            }
+        }
+    }
+
+    GIVEN("A header with a function declaration")
+    {
+        auto header_path{directory_tree.create_file("foo.hpp", "int foo(double value);\n").string()};
+        tsepepe_selection_request request{
+            .file = {.path = header_path.c_str()}, .selected_line_begin = 1, .selected_line_end = 1};
+
+        WHEN("The function definitions are generated from the file on the disk")
+        {
+            ResultPointer result{tsepepe_generate_function_definitions(session.get(), &request, nullptr),
+                                 &tsepepe_result_free};
+
+            THEN("The definitions are the text of the result, and no file is edited")
+            {
+                REQUIRE(tsepepe_result_status(result.get()) == TSEPEPE_STATUS_OK);
+                REQUIRE(tsepepe_result_file_edits_count(result.get()) == 0);
+                REQUIRE(std::string{tsepepe_result_text(result.get(), nullptr)} == "int foo(double value)\n{\n}\n");
+            }
+        }
+    }
+}
@@ -0,0 +1,424 @@
+/**
+ * @file        test_clangd_index.cpp
+ * @brief       Tests the ClangdIndex, on the shards written as by the clangd background index.
+ */
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "clangd_index.hpp"
+#include "directory_tree.hpp"
+
+#include "clang_ast_fixtures.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+//! Writes a shard laid out as by clangd, with the string table left uncompressed.
+class ShardWriter
+{
+  public:
+    struct Location
+    {
+        fs::path file;
+        unsigned line;
+        unsigned column;
+    };
+
+    //! The kinds, as within clang::index::SymbolKind.
+    static constexpr std::uint8_t struct_kind{6};
+    static constexpr std::uint8_t instance_method_kind{16};
+
+    static constexpr std::uint8_t base_of{0};
+    static constexpr std::uint8_t overridden_by{1};
+
+    explicit ShardWriter(std::uint32_t format_version = 17) : format_version{format_version}
+    {
+        strings.emplace_back();
+    }
+
+    void add_symbol(std::uint64_t id,
+                    std::uint8_t kind,
+                    const std::string& name,
+                    const std::string& scope,
+                    const std::optional<Location>& definition,
+                    const std::optional<Location>& declaration)
+    {
+        append_id(symbols, id);
+        symbols += static_cast<char>(kind);
+        symbols += '\0'; // The language.
+        append_string(symbols, name);
+        append_string(symbols, scope);
+        append_string(symbols, ""); // The template specialization arguments.
+        append_location(symbols, definition);
+        append_location(symbols, declaration);
+        append_var(symbols, 1); // The references count.
+        symbols += '\0';        // The flags.
+        for (int i{0}; i < 5; ++i)
+            append_string(symbols, "");
+        append_var(symbols, 0); // The include headers count.
+    }
+
+    void add_relation(std::uint64_t subject, std::uint8_t kind, std::uint64_t object)
+    {
+        append_id(relations, subject);
+        relations += static_cast<char>(kind);
+        append_id(relations, object);
+    }
+
+    void add_source(const fs::path& file, bool is_translation_unit, const std::vector<fs::path>& direct_includes)
+    {
+        sources += static_cast<char>(is_translation_unit ? 1 : 0);
+        sources += std::string(8, '\x5a'); // The digest.
+        append_string(sources, "file://" + file.string());
+        append_var(sources, direct_includes.size());
+        for (const auto& include : direct_includes)
+            append_string(sources, "file://" + include.string());
+    }
+
+    std::string make() const
+    {
+        std::string string_table(4, '\0'); // Uncompressed.
+        for (const auto& string : strings)
+            string_table += string + '\0';
+
+        std::string meta;
+        append_32(meta, format_version);
+
+        std::string content{"CdIx"};
+        append_chunk(content, "meta", meta);
+        append_chunk(content, "stri", string_table);
+        append_chunk(content, "symb", symbols);
+        append_chunk(content, "rela", relations);
+        append_chunk(content, "srcs", sources);
+
+        std::string result{"RIFF"};
+        append_32(result, content.size());
+        return result + content;
+    }
+
+  private:
+    static void append_32(std::string& data, std::uint32_t value)
+    {
+        for (int i{0}; i < 4; ++i)
+            data += static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+
+    static void append_id(std::string& data, std::uint64_t id)
+    {
+        for (int i{0}; i < 8; ++i)
+            data += static_cast<char>((id >> (8 * i)) & 0xff);
+    }
+
+    static void append_var(std::string& data, std::uint32_t value)
+    {
+        do
+        {
+            auto byte{static_cast<std::uint8_t>(value & 0x7f)};
+            value >>= 7;
+            data += static_cast<char>(value != 0 ? (byte | 0x80) : byte);
+        } while (value != 0);
+    }
+
+    static void append_chunk(std::string& data, const std::string& id, const std::string& chunk)
+    {
+        data += id;
+        append_32(data, chunk.size());
+        data += chunk;
+        if (chunk.size() % 2 != 0)
+            data += '\0';
+    }
+
+    void append_string(std::string& data, const std::string& string)
+    {
+        auto it{std::ranges::find(strings, string)};
+        append_var(data, std::distance(std::begin(strings), it));
+        if (it == std::end(strings))
+            strings.push_back(string);
+    }
+
+    void append_location(std::string& data, const std::optional<Location>& location)
+    {
+        append_string(data, location ? "file://" + location->file.string() : "");
+        append_var(data, location ? location->line : 0);
+        append_var(data, location ? location->column : 0);
+        append_var(data, location ? location->line : 0);
+        append_var(data, location ? location->column : 0);
+    }
+
+    std::uint32_t format_version;
+    std::vector<std::string> strings;
+    std::string symbols;
+    std::string relations;
+    std::string sources;
+};
+
+TEST_CASE("Answers the class queries from the clangd background index", "[ClangdIndex]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{fs::weakly_canonical(directory_tree.get_root_absolute_path())};
+
+    GIVEN("An interface, with an implementor, and an abstract class, which does not implement it")
+    {
+        auto header_path{fs::weakly_canonical(directory_tree.create_file("shape.hpp",
+                                                                         "struct Shape\n"
+                                                                         "{\n"
+                                                                         "    virtual void draw() = 0;\n"
+                                                                         "};\n"))};
+        auto source_path{fs::weakly_canonical(directory_tree.create_file("circle.cpp",
+                                                                         "#include \"shape.hpp\"\n"
+                                                                         "struct Circle : Shape\n"
+                                                                         "{\n"
+                                                                         "    void draw() override {}\n"
+                                                                         "};\n"
+                                                                         "struct Outline : Shape\n"
+                                                                         "{\n"
+                                                                         "};\n"))};
+
+        enum : std::uint64_t
+        {
+            shape_id = 1,
+            shape_draw_id,
+            circle_id,
+            circle_draw_id,
+            outline_id
+        };
+
+        ShardWriter header_shard;
+        header_shard.add_symbol(shape_id, ShardWriter::struct_kind, "Shape", "", {{header_path, 0, 7}}, {});
+        header_shard.add_symbol(
+            shape_draw_id, ShardWriter::instance_method_kind, "draw", "Shape::", {}, {{header_path, 2, 17}});
+        header_shard.add_source(header_path, false, {});
+
+        ShardWriter source_shard;
+        source_shard.add_symbol(circle_id, ShardWriter::struct_kind, "Circle", "", {{source_path, 1, 7}}, {});
+        source_shard.add_symbol(circle_draw_id,
+                                ShardWriter::instance_method_kind,
+                                "draw",
+                                "Circle::",
+                                {{source_path, 3, 9}},
+                                {{source_path, 3, 9}});
+        source_shard.add_symbol(outline_id, ShardWriter::struct_kind, "Outline", "", {{source_path, 5, 7}}, {});
+        source_shard.add_relation(shape_id, ShardWriter::base_of, circle_id);
+        source_shard.add_relation(shape_id, ShardWriter::base_of, outline_id);
+        source_shard.add_relation(shape_draw_id, ShardWriter::overridden_by, circle_draw_id);
+        source_shard.add_source(source_path, true, {header_path});
+        source_shard.add_source(header_path, false, {});
+
+        auto header_shard_path{directory_tree.create_file(".cache/clangd/index/shape.hpp.0123456789ABCDEF.idx",
+                                                          header_shard.make())};
+        directory_tree.create_file(".cache/clangd/index/circle.cpp.FEDCBA9876543210.idx", source_shard.make());
+
+        ClangdIndex clangd_index{make_compilation_database(working_root_dir, {source_path}), working_root_dir};
+
+        WHEN("The class index is made out of the fresh shards")
+        {
+            auto class_index{clangd_index.get_class_index()};
+
+            THEN("All the classes are found, together with their bases, and the abstract ones are told apart")
+            {
+                REQUIRE(class_index);
+                REQUIRE(class_index->classes
+                        == std::vector<IndexedClass>{
+                            {.qualified_name = "Circle",
+                             .location = {.file = source_path, .line = 2},
+                             .is_abstract = false,
+                             .bases = {"Shape"}},
+                            {.qualified_name = "Outline",
+                             .location = {.file = source_path, .line = 6},
+                             .is_abstract = true,
+                             .bases = {"Shape"}},
+                            {.qualified_name = "Shape",
+                             .location = {.file = header_path, .line = 1},
+                             .is_abstract = true},
+                        });
+                REQUIRE(class_index->translation_unit_files.at(source_path.string())
+                        == std::vector<fs::path>{source_path, header_path});
+            }
+        }
+
+        WHEN("The files defining the interface are looked for")
+        {
+            THEN("The header is found, without scanning the project")
+            {
+                REQUIRE(clangd_index.find_class_definition_files({"Shape"}) == std::vector<fs::path>{header_path});
+            }
+
+            THEN("Nothing is found for a class unknown to the index")
+            {
+                REQUIRE_FALSE(clangd_index.find_class_definition_files({"Shape", "Unknown"}));
+            }
+        }
+
+        WHEN("The header is modified after its shard has been written")
+        {
+            fs::last_write_time(header_path, fs::last_write_time(header_shard_path) + std::chrono::seconds{1});
+
+            THEN("The shards are not used")
+            {
+                REQUIRE_FALSE(clangd_index.get_class_index());
+                REQUIRE_FALSE(clangd_index.find_class_definition_files({"Shape"}));
+            }
+        }
+
+        WHEN("A translation unit from the compilation database has no shard")
+        {
+            auto new_source_path{fs::weakly_canonical(directory_tree.create_file("square.cpp", ""))};
+            ClangdIndex index_missing_a_shard{
+                make_compilation_database(working_root_dir, {source_path, new_source_path}), working_root_dir};
+
+            THEN("The shards are not used")
+            {
+                REQUIRE_FALSE(index_missing_a_shard.get_class_index());
+            }
+        }
+
+        WHEN("A shard is of an unknown format version")
+        {
+            directory_tree.create_file(".cache/clangd/index/shape.hpp.0123456789ABCDEF.idx",
+                                       ShardWriter{1000}.make());
+
+            THEN("The shards are not used")
+            {
+                REQUIRE_FALSE(clangd_index.get_class_index());
+            }
+        }
+    }
+
+    GIVEN("Interfaces, whose pure virtual functions are declared with the comments, over many lines, or out of line")
+    {
+        auto header_path{fs::weakly_canonical(directory_tree.create_file("widgets.hpp",
+                                                                         "struct Commented\n"
+                                                                         "{\n"
+                                                                         "    virtual void paint() = 0; // ; = 1\n"
+                                                                         "};\n"
+                                                                         "struct MultiLine\n"
+                                                                         "{\n"
+                                                                         "    virtual void resize(int width,\n"
+                                                                         "                        int height = 0)\n"
+                                                                         "        = 0;\n"
+                                                                         "};\n"
+                                                                         "struct CommentedOut\n"
+                                                                         "{\n"
+                                                                         "    virtual void hide() /* = 0 */;\n"
+                                                                         "    virtual int id(int fallback = 0);\n"
+                                                                         "};\n"
+                                                                         "struct DefinedOutOfLine\n"
+                                                                         "{\n"
+                                                                         "    virtual void show() = 0 /* pure */;\n"
+                                                                         "};\n"))};
+        auto source_path{fs::weakly_canonical(directory_tree.create_file("widgets.cpp",
+                                                                         "#include \"widgets.hpp\"\n"
+                                                                         "void CommentedOut::hide() {}\n"
+                                                                         "int CommentedOut::id(int f) { return f; }\n"
+                                                                         "void DefinedOutOfLine::show() {}\n"))};
+
+        enum : std::uint64_t
+        {
+            commented_id = 1,
+            paint_id,
+            multi_line_id,
+            resize_id,
+            commented_out_id,
+            hide_id,
+            id_id,
+            defined_out_of_line_id,
+            show_id,
+            declared_id,
+            stop_id
+        };
+
+        ShardWriter header_shard;
+        header_shard.add_symbol(commented_id, ShardWriter::struct_kind, "Commented", "", {{header_path, 0, 7}}, {});
+        header_shard.add_symbol(
+            paint_id, ShardWriter::instance_method_kind, "paint", "Commented::", {}, {{header_path, 2, 17}});
+        header_shard.add_symbol(multi_line_id, ShardWriter::struct_kind, "MultiLine", "", {{header_path, 4, 7}}, {});
+        header_shard.add_symbol(
+            resize_id, ShardWriter::instance_method_kind, "resize", "MultiLine::", {}, {{header_path, 6, 17}});
+        header_shard.add_symbol(
+            commented_out_id, ShardWriter::struct_kind, "CommentedOut", "", {{header_path, 10, 7}}, {});
+        header_shard.add_symbol(
+            hide_id, ShardWriter::instance_method_kind, "hide", "CommentedOut::", {}, {{header_path, 12, 17}});
+        header_shard.add_symbol(
+            id_id, ShardWriter::instance_method_kind, "id", "CommentedOut::", {}, {{header_path, 13, 16}});
+        header_shard.add_symbol(
+            defined_out_of_line_id, ShardWriter::struct_kind, "DefinedOutOfLine", "", {{header_path, 15, 7}}, {});
+        header_shard.add_symbol(
+            show_id, ShardWriter::instance_method_kind, "show", "DefinedOutOfLine::", {}, {{header_path, 17, 17}});
+        header_shard.add_source(header_path, false, {});
+
+        ShardWriter source_shard;
+        source_shard.add_symbol(hide_id,
+                                ShardWriter::instance_method_kind,
+                                "hide",
+                                "CommentedOut::",
+                                {{source_path, 1, 19}},
+                                {{header_path, 12, 17}});
+        source_shard.add_symbol(id_id,
+                                ShardWriter::instance_method_kind,
+                                "id",
+                                "CommentedOut::",
+                                {{source_path, 2, 18}},
+                                {{header_path, 13, 16}});
+        source_shard.add_symbol(show_id,
+                                ShardWriter::instance_method_kind,
+                                "show",
+                                "DefinedOutOfLine::",
+                                {{source_path, 3, 23}},
+                                {{header_path, 17, 17}});
+        source_shard.add_source(source_path, true, {header_path});
+        source_shard.add_source(header_path, false, {});
+
+        directory_tree.create_file(".cache/clangd/index/widgets.hpp.0123456789ABCDEF.idx", header_shard.make());
+        directory_tree.create_file(".cache/clangd/index/widgets.cpp.FEDCBA9876543210.idx", source_shard.make());
+
+        ClangdIndex clangd_index{make_compilation_database(working_root_dir, {source_path}), working_root_dir};
+
+        WHEN("The class index is made out of the fresh shards")
+        {
+            auto class_index{clangd_index.get_class_index()};
+
+            THEN("The pure specifiers are told apart from the comments, and the default arguments")
+            {
+                REQUIRE(class_index);
+                std::vector<std::pair<std::string, bool>> abstractness;
+                for (const auto& indexed_class : class_index->classes)
+                    abstractness.emplace_back(indexed_class.qualified_name, indexed_class.is_abstract);
+                REQUIRE(abstractness
+                        == std::vector<std::pair<std::string, bool>>{{"Commented", true},
+                                                                     {"CommentedOut", false},
+                                                                     {"DefinedOutOfLine", true},
+                                                                     {"MultiLine", true}});
+            }
+        }
+
+        WHEN("An interface declares its pure virtual function with a macro")
+        {
+            auto macro_header_path{fs::weakly_canonical(directory_tree.create_file(
+                "macro.hpp",
+                "#define DECLARE_PURE(name) virtual void name() = 0;\n"
+                "struct Declared\n"
+                "{\n"
+                "    DECLARE_PURE(stop)\n"
+                "};\n"))};
+            ShardWriter macro_header_shard;
+            macro_header_shard.add_symbol(
+                declared_id, ShardWriter::struct_kind, "Declared", "", {{macro_header_path, 1, 7}}, {});
+            macro_header_shard.add_symbol(
+                stop_id, ShardWriter::instance_method_kind, "stop", "Declared::", {}, {{macro_header_path, 3, 17}});
+            macro_header_shard.add_source(macro_header_path, false, {});
+            directory_tree.create_file(".cache/clangd/index/macro.hpp.0123456789ABCDEF.idx", macro_header_shard.make());
+
+            THEN("The class index is not made, so that the classes are indexed otherwise")
+            {
+                REQUIRE_FALSE(clangd_index.get_class_index());
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * @file        test_class_index.cpp
+ * @brief       Tests the class indexer.
+ */
+#include <filesystem>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "class_index.hpp"
+#include "directory_tree.hpp"
+
+#include "clang_ast_fixtures.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Indexes the classes of the project with their direct bases", "[ClassIndex]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{fs::weakly_canonical(directory_tree.get_root_absolute_path())};
+
+    GIVEN("A header with an interface, a class template, and their implementors, included by two source files")
+    {
+        auto header_path{fs::weakly_canonical(directory_tree.create_file("shapes.hpp",
+                                                                         "namespace Shapes\n"
+                                                                         "{\n"
+                                                                         "struct Shape\n"
+                                                                         "{\n"
+                                                                         "    virtual void draw() = 0;\n"
+                                                                         "};\n"
+                                                                         "template<typename T>\n"
+                                                                         "struct Holder\n"
+                                                                         "{\n"
+                                                                         "    T value;\n"
+                                                                         "};\n"
+                                                                         "template<typename T>\n"
+                                                                         "struct Box : Shape, Holder<T>\n"
+                                                                         "{\n"
+                                                                         "    void draw() override {}\n"
+                                                                         "};\n"
+                                                                         "} // namespace Shapes\n"))};
+        auto first_tu{fs::weakly_canonical(directory_tree.create_file("first.cpp",
+                                                                      "#include \"shapes.hpp\"\n"
+                                                                      "Shapes::Box<int> box;\n"))};
+        auto second_tu{fs::weakly_canonical(directory_tree.create_file("second.cpp",
+                                                                       "#include \"shapes.hpp\"\n"
+                                                                       "struct Circle : Shapes::Shape\n"
+                                                                       "{\n"
+                                                                       "    void draw() override;\n"
+                                                                       "};\n"))};
+
+        ClassIndexerLibclangBased indexer{make_compilation_database(working_root_dir, {first_tu, second_tu})};
+        ClassIndexingParameters parameters{.root_directory = working_root_dir,
+                                           .cache_directory = working_root_dir / ".cache"};
+
+        WHEN("The project is indexed")
+        {
+            auto index{indexer.index(parameters)};
+
+            THEN("Each class defined within the project is indexed once, without the template instantiations")
+            {
+                REQUIRE(index.classes
+                        == std::vector<IndexedClass>{
+                            {.qualified_name = "Circle",
+                             .location = {.file = second_tu, .line = 2},
+                             .is_abstract = false,
+                             .bases = {"Shapes::Shape"}},
+                            {.qualified_name = "Shapes::Box",
+                             .location = {.file = header_path, .line = 13},
+                             .is_abstract = false,
+                             .bases = {"Shapes::Shape", "Shapes::Holder"}},
+                            {.qualified_name = "Shapes::Holder",
+                             .location = {.file = header_path, .line = 8},
+                             .is_abstract = false},
+                            {.qualified_name = "Shapes::Shape",
+                             .location = {.file = header_path, .line = 3},
+                             .is_abstract = true}});
+            }
+
+            AND_THEN("The project files of each translation unit are known")
+            {
+                REQUIRE(index.translation_unit_files.at(first_tu.string())
+                        == std::vector<fs::path>{first_tu, header_path});
+            }
+
+            AND_WHEN("A class is added to one of the source files, and the project is indexed again")
+            {
+                directory_tree.create_file("first.cpp",
+                                           "#include \"shapes.hpp\"\n"
+                                           "struct Square : Shapes::Shape\n"
+                                           "{\n"
+                                           "    void draw() override;\n"
+                                           "};\n");
+                auto updated_index{indexer.index(parameters)};
+
+                THEN("The changed translation unit is scanned again, and the new class is indexed")
+                {
+                    REQUIRE(updated_index.classes.size() == index.classes.size() + 1);
+                    REQUIRE(updated_index.classes.back()
+                            == IndexedClass{.qualified_name = "Square",
+                                            .location = {.file = first_tu, .line = 2},
+                                            .is_abstract = false,
+                                            .bases = {"Shapes::Shape"}});
+                }
+            }
+
+            AND_WHEN("The project is indexed again, without any change")
+            {
+                auto cached_index{indexer.index(parameters)};
+
+                THEN("The cached results give the same index")
+                {
+                    REQUIRE(cached_index.classes == index.classes);
+                    REQUIRE(cached_index.translation_unit_files == index.translation_unit_files);
+                }
+            }
+        }
+    }
+}
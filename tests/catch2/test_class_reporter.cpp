@@ -0,0 +1,111 @@
+/**
+ * @file        test_class_reporter.cpp
+ * @brief       Tests the class reporter.
+ */
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "base_error.hpp"
+#include "class_reporter.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Reports all the class facts from a single parse", "[ClassReporter]")
+{
+    std::string error_message;
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database{
+        clang::tooling::CompilationDatabase::loadFromDirectory(
+            COMPILATION_DATABASE_DIR, // Supplied within CMakeLists.txt
+            error_message)};
+    if (compilation_database == nullptr)
+        throw std::runtime_error{"Failed to load compilation database from: " COMPILATION_DATABASE_DIR ": "
+                                 + error_message};
+
+    ClassReporterLibclangBased reporter{compilation_database};
+
+    GIVEN("A file with an interface, its implementor, and a class without a public section")
+    {
+        std::string file_content{"namespace Shapes\n"
+                                 "{\n"
+                                 "struct Drawable\n"
+                                 "{\n"
+                                 "    virtual ~Drawable() = default;\n"
+                                 "    virtual void draw() const = 0;\n"
+                                 "};\n"
+                                 "\n"
+                                 "class Square : public Drawable\n"
+                                 "{\n"
+                                 "    int side;\n"
+                                 "\n"
+                                 "  public:\n"
+                                 "    void draw() const override;\n"
+                                 "};\n"
+                                 "\n"
+                                 "class Hidden\n"
+                                 "{\n"
+                                 "    int value;\n"
+                                 "};\n"
+                                 "} // namespace Shapes\n"};
+
+        WHEN("All the classes, and a class which does not exist, are queried at once")
+        {
+            auto result{reporter.report({.source_file_path = fs::temp_directory_path(),
+                                         .source_file_content = file_content,
+                                         .class_names = {"Drawable", "Square", "Hidden", "Missing"}})};
+
+            THEN("The interface is reported as abstract, with its pure virtual functions")
+            {
+                REQUIRE(result.at("Drawable")
+                        == ClassReport{.qualified_name = "Shapes::Drawable",
+                                       .is_abstract = true,
+                                       .bases = {},
+                                       .pure_virtual_override_declarations = {"void draw() const override;"},
+                                       .suitable_public_method_place = {.offset = 107}});
+            }
+
+            AND_THEN("The implementor is reported with its base")
+            {
+                REQUIRE(result.at("Square")
+                        == ClassReport{.qualified_name = "Shapes::Square",
+                                       .is_abstract = false,
+                                       .bases = {"Shapes::Drawable"},
+                                       .pure_virtual_override_declarations = {},
+                                       .suitable_public_method_place = {.offset = 201}});
+            }
+
+            AND_THEN("The class without a public section is reported as needing one")
+            {
+                REQUIRE(result.at("Hidden")
+                        == ClassReport{
+                            .qualified_name = "Shapes::Hidden",
+                            .is_abstract = false,
+                            .bases = {},
+                            .pure_virtual_override_declarations = {},
+                            .suitable_public_method_place = {.offset = 220, .is_public_section_needed = true}});
+            }
+
+            AND_THEN("The class which does not exist is not reported")
+            {
+                REQUIRE(result.size() == 3);
+            }
+        }
+    }
+
+    GIVEN("No class name")
+    {
+        THEN("It throws")
+        {
+            REQUIRE_THROWS_AS(reporter.report({.source_file_path = fs::temp_directory_path(),
+                                               .source_file_content = "struct Foo {};\n",
+                                               .class_names = {}}),
+                              Tsepepe::BaseError);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file        test_code_formatter.cpp
+ * @brief       Tests the in-process formatting of the generated code.
+ */
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "base_error.hpp"
+#include "code_formatter.hpp"
+
+using namespace Tsepepe;
+using Catch::Matchers::ContainsSubstring;
+
+TEST_CASE("Only the inserted code is formatted", "[CodeFormatter]")
+{
+    GIVEN("An unformatted class, with an unformatted override inserted")
+    {
+        std::string input{"struct Circle : Shape\n"
+                          "{\n"
+                          "    int   radius;\n"
+                          "};\n"};
+        std::vector<CodeInsertionByOffset> insertions{{.code = "void   draw( )  const override;\n", .offset = 24}};
+        CodeFormattingOptions options{.style = "LLVM"};
+
+        WHEN("The insertions are applied, with the formatting")
+        {
+            auto result{apply_and_format_insertions(input, insertions, "circle.hpp", options)};
+
+            THEN("The override is formatted, and the rest of the class is left as it was")
+            {
+                REQUIRE_THAT(result, ContainsSubstring("\n  void draw() const override;\n"));
+                REQUIRE_THAT(result, ContainsSubstring("struct Circle : Shape\n{\n"));
+                REQUIRE_THAT(result, ContainsSubstring("\n    int   radius;\n"));
+            }
+        }
+
+        WHEN("The insertions are applied, without the formatting")
+        {
+            auto result{apply_and_format_insertions(input, insertions, "circle.hpp", std::nullopt)};
+
+            THEN("The code is inserted as it is")
+            {
+                REQUIRE(result
+                        == "struct Circle : Shape\n"
+                           "{\n"
+                           "void   draw( )  const override;\n"
+                           "    int   radius;\n"
+                           "};\n");
+            }
+        }
+
+        WHEN("No range is given")
+        {
+            THEN("Nothing is formatted")
+            {
+                REQUIRE(format_code_ranges(input, "circle.hpp", {}, options) == input);
+            }
+        }
+
+        WHEN("The style is invalid")
+        {
+            options.style = "{IndentWidth: wide}";
+
+            THEN("An error is raised")
+            {
+                REQUIRE_THROWS_AS(apply_and_format_insertions(input, insertions, "circle.hpp", options), BaseError);
+            }
+        }
+    }
+}
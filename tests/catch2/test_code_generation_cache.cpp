@@ -0,0 +1,216 @@
+/**
+ * @file        test_code_generation_cache.cpp
+ * @brief       Tests the code generation cache.
+ */
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "code_generation_cache.hpp"
+#include "directory_tree.hpp"
+
+#include "clang_ast_fixtures.hpp"
+
+using namespace Tsepepe;
+using namespace clang::ast_matchers;
+namespace fs = std::filesystem;
+
+TEST_CASE("Caches the generated code, keyed with what the code depends on", "[CodeGenerationCache]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto cache_file_path{directory_tree.get_root_absolute_path() / ".cache" / "code_generation_cache.json"};
+
+    CodeGenerationKey key{.usr = "c:@N@Shapes@S@Shape", .content_hash = 1, .implementor_scope = "Circle"};
+    std::vector<std::string> code{"void draw() override;"};
+
+    GIVEN("An in-memory cache, with the code inserted")
+    {
+        CodeGenerationCache cache;
+        cache.insert(key, code);
+
+        THEN("The code is found with the same key only")
+        {
+            REQUIRE(cache.find(key) == code);
+
+            auto other_scope_key{key};
+            other_scope_key.implementor_scope = "Square";
+            REQUIRE(cache.find(other_scope_key) == std::nullopt);
+
+            auto other_content_key{key};
+            other_content_key.content_hash = 2;
+            REQUIRE(cache.find(other_content_key) == std::nullopt);
+        }
+
+        WHEN("The code generated from another content of the header is inserted")
+        {
+            auto other_content_key{key};
+            other_content_key.content_hash = 2;
+            cache.insert(other_content_key, {"void draw() const override;"});
+
+            THEN("It replaces the previous one")
+            {
+                REQUIRE(cache.size() == 1);
+                REQUIRE(cache.find(key) == std::nullopt);
+            }
+        }
+
+        WHEN("The code is inserted with an empty USR")
+        {
+            cache.insert({}, code);
+
+            THEN("It is not cached")
+            {
+                REQUIRE(cache.size() == 1);
+                REQUIRE(cache.find({}) == std::nullopt);
+            }
+        }
+    }
+
+    GIVEN("A cache loaded from a missing file, with the code inserted and stored")
+    {
+        {
+            CodeGenerationCache cache{cache_file_path};
+            REQUIRE(cache.size() == 0);
+            cache.insert(key, code);
+            cache.store();
+        }
+
+        WHEN("Another cache stores other code to the same file")
+        {
+            auto other_key{key};
+            other_key.implementor_scope = "Square";
+            {
+                CodeGenerationCache cache{cache_file_path};
+                cache.insert(other_key, code);
+                cache.store();
+            }
+
+            THEN("Both pieces of the code are loaded back")
+            {
+                CodeGenerationCache cache{cache_file_path};
+                REQUIRE(cache.size() == 2);
+                REQUIRE(cache.find(key) == code);
+                REQUIRE(cache.find(other_key) == code);
+            }
+        }
+    }
+
+    GIVEN("An interface deriving from another interface")
+    {
+        std::string header_content{"namespace Shapes\n"
+                                   "{\n"
+                                   "struct Drawable\n"
+                                   "{\n"
+                                   "    virtual void draw() = 0;\n"
+                                   "};\n"
+                                   "struct Shape : Drawable\n"
+                                   "{\n"
+                                   "    virtual double area() const = 0;\n"
+                                   "};\n"
+                                   "} // namespace Shapes\n"};
+        ClangSingleAstFixture fixture{header_content};
+        auto interface_node{fixture.get_first_match<clang::CXXRecordDecl>(
+            cxxRecordDecl(hasName("Shape"), isDefinition()).bind("Shape"))};
+        const auto& source_manager{fixture.get_source_manager()};
+
+        WHEN("The overrides are generated twice, through the cache")
+        {
+            CodeGenerationCache cache;
+            auto declarations{
+                pure_virtual_functions_to_override_declarations(interface_node, "Circle", source_manager, &cache)};
+            auto cached_declarations{
+                pure_virtual_functions_to_override_declarations(interface_node, "Circle", source_manager, &cache)};
+
+            THEN("The same overrides are returned, as without the cache, and a single entry is cached")
+            {
+                REQUIRE(declarations
+                        == pure_virtual_functions_to_override_declarations(interface_node, "Circle", source_manager));
+                REQUIRE(cached_declarations == declarations);
+                REQUIRE(cache.size() == 1);
+            }
+        }
+
+        WHEN("The header content changes")
+        {
+            ClangSingleAstFixture changed_fixture{header_content + "// A comment.\n"};
+            auto changed_interface_node{changed_fixture.get_first_match<clang::CXXRecordDecl>(
+                cxxRecordDecl(hasName("Shape"), isDefinition()).bind("Shape"))};
+
+            THEN("The key differs by the content hash only")
+            {
+                auto key{make_override_declarations_key(interface_node, "Circle", source_manager)};
+                auto changed_key{make_override_declarations_key(
+                    changed_interface_node, "Circle", changed_fixture.get_source_manager())};
+                REQUIRE(key.usr == changed_key.usr);
+                REQUIRE(key.content_hash != changed_key.content_hash);
+            }
+        }
+    }
+
+    GIVEN("An interface spelling a type, which is declared within another header, and an unrelated header included")
+    {
+        std::string types_header_content{"namespace Geometry\n"
+                                         "{\n"
+                                         "struct Point\n"
+                                         "{\n"
+                                         "};\n"
+                                         "} // namespace Geometry\n"};
+        directory_tree.create_file("types.hpp", types_header_content);
+        std::string unrelated_header_content{"struct Unrelated\n"
+                                             "{\n"
+                                             "};\n"};
+        directory_tree.create_file("unrelated.hpp", unrelated_header_content);
+        auto interface_header_path{directory_tree.create_file("shape.hpp",
+                                                              "#include \"types.hpp\"\n"
+                                                              "#include \"unrelated.hpp\"\n"
+                                                              "struct Shape\n"
+                                                              "{\n"
+                                                              "    virtual Geometry::Point center() const = 0;\n"
+                                                              "};\n")};
+
+        auto make_interface_key{[&](const fs::path& parsed_file_path) {
+            ClangAstFixture fixture{COMPILATION_DATABASE_DIR, {parsed_file_path}};
+            auto interface_node{fixture.get_first_match<clang::CXXRecordDecl>(
+                cxxRecordDecl(hasName("Shape"), isDefinition()).bind("Shape"))};
+            return make_override_declarations_key(interface_node, "Circle", fixture.get_source_manager());
+        }};
+        auto interface_key{make_interface_key(interface_header_path)};
+
+        WHEN("The header declaring the spelled type changes")
+        {
+            directory_tree.create_file("types.hpp", types_header_content + "// A comment.\n");
+
+            THEN("The content hash changes")
+            {
+                REQUIRE(make_interface_key(interface_header_path).content_hash != interface_key.content_hash);
+            }
+        }
+
+        WHEN("The unrelated header changes")
+        {
+            directory_tree.create_file("unrelated.hpp", unrelated_header_content + "// A comment.\n");
+
+            THEN("The content hash stays the same")
+            {
+                REQUIRE(make_interface_key(interface_header_path).content_hash == interface_key.content_hash);
+            }
+        }
+
+        WHEN("The interface is seen through the translation units, which include the headers in different orders")
+        {
+            auto types_first_source_path{directory_tree.create_file("circle.cpp",
+                                                                    "#include \"types.hpp\"\n"
+                                                                    "#include \"shape.hpp\"\n")};
+            auto interface_first_source_path{directory_tree.create_file("square.cpp", "#include \"shape.hpp\"\n")};
+
+            THEN("The content hash is the same for both")
+            {
+                auto types_first_key{make_interface_key(types_first_source_path)};
+                REQUIRE(types_first_key.content_hash == make_interface_key(interface_first_source_path).content_hash);
+                REQUIRE(types_first_key.content_hash == interface_key.content_hash);
+            }
+        }
+    }
+}
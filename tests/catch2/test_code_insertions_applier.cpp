@@ -80,6 +80,16 @@ TEST_CASE("Code insertions are applied", "[CodeInsertionApplier]")
         REQUIRE(apply_insertions(input, std::move(insertions)) == "Hey, you. Dummy. World!");
     }
 
+    SECTION("Tells the ranges of the inserted code, skipping the empty insertions")
+    {
+        std::string input{"yolo  bang!  bum!"};
+        std::vector<CodeInsertionByOffset> insertions{
+            {.code = "szasta :)", .offset = 12}, {.code = "", .offset = 0}, {.code = "basta?", .offset = 5}};
+        std::vector<CodeRange> inserted_ranges;
+        REQUIRE(apply_insertions(input, std::move(insertions), inserted_ranges) == "yolo basta? bang! szasta :) bum!");
+        REQUIRE(inserted_ranges == std::vector<CodeRange>{{.offset = 5, .length = 6}, {.offset = 18, .length = 9}});
+    }
+
     SECTION("Raises error if one code insertion is out of bound")
     {
         std::string input{"World!"};
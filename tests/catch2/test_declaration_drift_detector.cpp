@@ -0,0 +1,120 @@
+/**
+ * @file        test_declaration_drift_detector.cpp
+ * @brief       Tests the declaration drift detector.
+ */
+#include <filesystem>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "declaration_drift_detector.hpp"
+#include "directory_tree.hpp"
+
+#include "clang_ast_fixtures.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Detects the drift between the function declarations and definitions", "[DeclarationDriftDetector]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{fs::weakly_canonical(directory_tree.get_root_absolute_path())};
+
+    GIVEN("A header with functions declared")
+    {
+        auto header_path{fs::weakly_canonical(directory_tree.create_file("compute.hpp",
+                                                                         "struct Calculator\n"
+                                                                         "{\n"
+                                                                         "    int add(int lhs, int rhs);\n"
+                                                                         "    void reset();\n"
+                                                                         "    int inlined() { return 0; }\n"
+                                                                         "};\n"
+                                                                         "int compute(int value);\n"
+                                                                         "int compute(double value);\n"))};
+
+        AND_GIVEN("Source files, which define some of the functions, and one with a drifted signature")
+        {
+            auto calculator_path{directory_tree.create_file("calculator.cpp",
+                                                            "#include \"compute.hpp\"\n"
+                                                            "\n"
+                                                            "int Calculator::add(int lhs, int rhs)\n"
+                                                            "{\n"
+                                                            "    return lhs + rhs;\n"
+                                                            "}\n")};
+            auto compute_path{fs::weakly_canonical(directory_tree.create_file("compute.cpp",
+                                                                              "#include \"compute.hpp\"\n"
+                                                                              "\n"
+                                                                              "int compute(double value)\n"
+                                                                              "{\n"
+                                                                              "    return 0;\n"
+                                                                              "}\n"
+                                                                              "\n"
+                                                                              "int compute(long value)\n"
+                                                                              "{\n"
+                                                                              "    return 0;\n"
+                                                                              "}\n"))};
+
+            DeclarationDriftDetectorLibclangBased detector{
+                make_compilation_database(working_root_dir, {calculator_path, compute_path})};
+            DeclarationDriftDetectionParameters parameters{.root_directory = working_root_dir,
+                                                           .cache_directory = working_root_dir / ".cache"};
+
+            WHEN("The project is scanned")
+            {
+                auto report{detector.detect(parameters)};
+
+                THEN("The function defined nowhere is reported as undefined")
+                {
+                    REQUIRE(report.undefined_declarations
+                            == std::vector<UndefinedDeclaration>{
+                                {.expected_definition = "void Calculator::reset()",
+                                 .declaration_location = {.file = header_path, .line = 4}}});
+                }
+
+                AND_THEN("The function defined with another signature is reported as mismatched")
+                {
+                    REQUIRE(report.signature_mismatches
+                            == std::vector<SignatureMismatch>{
+                                {.expected_definition = "int compute(int value)",
+                                 .declaration_location = {.file = header_path, .line = 7},
+                                 .actual_definition = "int compute(long value)",
+                                 .definition_location = {.file = compute_path, .line = 8}}});
+                }
+
+                AND_WHEN("The drifted definition is fixed, and the project is scanned again")
+                {
+                    directory_tree.create_file("compute.cpp",
+                                               "#include \"compute.hpp\"\n"
+                                               "\n"
+                                               "int compute(double value)\n"
+                                               "{\n"
+                                               "    return 0;\n"
+                                               "}\n"
+                                               "\n"
+                                               "int compute(int value)\n"
+                                               "{\n"
+                                               "    return 0;\n"
+                                               "}\n");
+                    auto rescan_report{detector.detect(parameters)};
+
+                    THEN("The changed translation unit is scanned again, and the mismatch is gone")
+                    {
+                        REQUIRE(rescan_report.signature_mismatches.empty());
+                        REQUIRE(rescan_report.undefined_declarations == report.undefined_declarations);
+                    }
+                }
+
+                AND_WHEN("The project is scanned again, without any change")
+                {
+                    auto rescan_report{detector.detect(parameters)};
+
+                    THEN("The cached results give the same report")
+                    {
+                        REQUIRE(rescan_report.undefined_declarations == report.undefined_declarations);
+                        REQUIRE(rescan_report.signature_mismatches == report.signature_mismatches);
+                    }
+                }
+            }
+        }
+    }
+}
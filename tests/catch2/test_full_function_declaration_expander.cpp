@@ -7,6 +7,7 @@
 
 #include <initializer_list>
 #include <string>
+#include <vector>
 
 #include "libclang_utils/full_function_declaration_expander.hpp"
 
@@ -502,3 +503,46 @@ TEST_CASE("Function declarations are expanded fully", "[FullFunctionDeclarationE
         }
     }
 }
+
+TEST_CASE("Function declarations expanded with a shared memo are the same", "[FullFunctionDeclarationExpander]")
+{
+    using namespace Tsepepe;
+    using namespace clang;
+
+    GIVEN("Declarations sharing the types, both aliased and not")
+    {
+        ClangSingleAstFixture fixture{"#include <map>\n"
+                                      "#include <string>\n"
+                                      "#include <vector>\n"
+                                      "namespace Namespace {\n"
+                                      "using Names = std::vector<std::string>;\n"
+                                      "struct Registry\n"
+                                      "{\n"
+                                      "    std::map<int, std::vector<std::string>> get(const Names&) const;\n"
+                                      "    Names put(std::map<int, std::vector<std::string>>, Names);\n"
+                                      "};\n"
+                                      "}\n"};
+        auto get_declaration_at_line{[&](unsigned line) {
+            return fixture.get_first_match<FunctionDecl>(
+                ast_matchers::functionDecl(isDeclaredAtLine(line)).bind("function_at_line_matcher"));
+        }};
+
+        WHEN("The declarations are expanded with a shared memo, and each on its own")
+        {
+            AstPrintingMemo memo;
+            const auto& source_manager{fixture.get_source_manager()};
+            std::vector<std::string> expanded_with_memo{
+                fully_expand_function_declaration(get_declaration_at_line(8), source_manager, {}, &memo),
+                fully_expand_function_declaration(get_declaration_at_line(9), source_manager, {}, &memo)};
+
+            THEN("The results are the same, and the alias is kept as is")
+            {
+                CHECK(expanded_with_memo[0]
+                      == fully_expand_function_declaration(get_declaration_at_line(8), source_manager));
+                CHECK(expanded_with_memo[1]
+                      == fully_expand_function_declaration(get_declaration_at_line(9), source_manager));
+                CHECK(expanded_with_memo[1].starts_with("Namespace::Names"));
+            }
+        }
+    }
+}
@@ -0,0 +1,188 @@
+/**
+ * @file        test_generate_definitions_in_paired_source_code_action.cpp
+ * @brief       Tests the generation of the function definitions straight into the paired source file.
+ */
+#include <filesystem>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "directory_tree.hpp"
+#include "generate_definitions_in_paired_source_code_action.hpp"
+
+#include "clang_ast_fixtures.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Function definitions are placed next to their neighbours within the paired source file",
+          "[GenerateDefinitionsInPairedSourceCodeAction]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{fs::weakly_canonical(directory_tree.get_root_absolute_path())};
+
+    std::string header_content{"struct Foo\n"
+                               "{\n"
+                               "    void start();\n"
+                               "    void run();\n"
+                               "    int pause(unsigned timeout);\n"
+                               "    void stop();\n"
+                               "};\n"
+                               "void free_function(double value);\n"};
+    auto header_path{directory_tree.create_file("foo.hpp", header_content)};
+    // The header is parsed from a temporary copy, which is placed next to it.
+    auto temporary_header_path{working_root_dir / ".tsepepe_foo.hpp"};
+
+    GIVEN("A paired source file, which defines some of the functions")
+    {
+        auto source_path{fs::weakly_canonical(directory_tree.create_file("foo.cpp",
+                                                                         "#include \"foo.hpp\"\n"
+                                                                         "\n"
+                                                                         "void Foo::start()\n"
+                                                                         "{\n"
+                                                                         "}\n"
+                                                                         "\n"
+                                                                         "//! Stops the foo.\n"
+                                                                         "void Foo::stop()\n"
+                                                                         "{\n"
+                                                                         "}\n"))};
+
+        GenerateDefinitionsInPairedSourceCodeActionLibclangBased code_action{
+            make_compilation_database(working_root_dir, {source_path, temporary_header_path})};
+        GenerateDefinitionsInPairedSourceCodeActionParameters parameters{.root_directory = working_root_dir,
+                                                                         .header_file_path = header_path,
+                                                                         .header_file_content = header_content};
+
+        WHEN("The definitions are generated for the functions declared between the defined ones")
+        {
+            parameters.selected_line_begin = 4;
+            parameters.selected_line_end = 5;
+            auto result{code_action.apply(parameters)};
+
+            THEN("They are placed after the definition of the preceding function, in the declaration order")
+            {
+                REQUIRE(result.size() == 1);
+                REQUIRE(result.at(source_path)
+                        == "#include \"foo.hpp\"\n"
+                           "\n"
+                           "void Foo::start()\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "void Foo::run()\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "int Foo::pause(unsigned int timeout)\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "//! Stops the foo.\n"
+                           "void Foo::stop()\n"
+                           "{\n"
+                           "}\n");
+            }
+        }
+
+        WHEN("The definition is generated for the function declared after all the defined ones")
+        {
+            parameters.selected_line_begin = 8;
+            parameters.selected_line_end = 8;
+            auto result{code_action.apply(parameters)};
+
+            THEN("It is appended to the source file")
+            {
+                REQUIRE(result.at(source_path)
+                        == "#include \"foo.hpp\"\n"
+                           "\n"
+                           "void Foo::start()\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "//! Stops the foo.\n"
+                           "void Foo::stop()\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "void free_function(double value)\n"
+                           "{\n"
+                           "}\n");
+            }
+        }
+
+        WHEN("The definition is requested for a function defined already")
+        {
+            parameters.selected_line_begin = 3;
+            parameters.selected_line_end = 3;
+            auto result{code_action.apply(parameters)};
+
+            THEN("Nothing is generated")
+            {
+                REQUIRE(result.empty());
+            }
+        }
+    }
+
+    GIVEN("A paired source file, which defines only the last member function")
+    {
+        auto source_path{fs::weakly_canonical(directory_tree.create_file("foo.cpp",
+                                                                         "#include \"foo.hpp\"\n"
+                                                                         "\n"
+                                                                         "//! Stops the foo.\n"
+                                                                         "void Foo::stop()\n"
+                                                                         "{\n"
+                                                                         "}\n"))};
+
+        GenerateDefinitionsInPairedSourceCodeActionLibclangBased code_action{
+            make_compilation_database(working_root_dir, {source_path, temporary_header_path})};
+
+        WHEN("The definition is generated for the first member function")
+        {
+            auto result{code_action.apply({.root_directory = working_root_dir,
+                                           .header_file_path = header_path,
+                                           .header_file_content = header_content,
+                                           .selected_line_begin = 3,
+                                           .selected_line_end = 3})};
+
+            THEN("It is placed before the definition of the following function, including its comment")
+            {
+                REQUIRE(result.at(source_path)
+                        == "#include \"foo.hpp\"\n"
+                           "\n"
+                           "void Foo::start()\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "//! Stops the foo.\n"
+                           "void Foo::stop()\n"
+                           "{\n"
+                           "}\n");
+            }
+        }
+    }
+
+    GIVEN("No paired source file")
+    {
+        GenerateDefinitionsInPairedSourceCodeActionLibclangBased code_action{
+            make_compilation_database(working_root_dir, {temporary_header_path})};
+
+        WHEN("The definition is generated")
+        {
+            auto result{code_action.apply({.root_directory = working_root_dir,
+                                           .header_file_path = header_path,
+                                           .header_file_content = header_content,
+                                           .selected_line_begin = 8,
+                                           .selected_line_end = 8})};
+
+            THEN("A new source file, which includes the header, is created next to the header")
+            {
+                REQUIRE(result.at(working_root_dir / "foo.cpp")
+                        == "#include \"foo.hpp\"\n"
+                           "\n"
+                           "void free_function(double value)\n"
+                           "{\n"
+                           "}\n");
+            }
+        }
+    }
+}
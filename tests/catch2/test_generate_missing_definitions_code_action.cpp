@@ -0,0 +1,173 @@
+/**
+ * @file        test_generate_missing_definitions_code_action.cpp
+ * @brief       Tests the bulk generation of the missing function definitions.
+ */
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+#include "directory_tree.hpp"
+#include "generate_missing_definitions_code_action.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Definitions of all the undefined functions are generated for multiple headers",
+          "[GenerateMissingDefinitionsCodeAction]")
+{
+    DirectoryTree directory_tree{"temp"};
+
+    std::string error_message;
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database{
+        clang::tooling::CompilationDatabase::loadFromDirectory(
+            COMPILATION_DATABASE_DIR, // Supplied within CMakeLists.txt
+            error_message)};
+    if (compilation_database == nullptr)
+        throw std::runtime_error{"Failed to load compilation database from: " COMPILATION_DATABASE_DIR ": "
+                                 + error_message};
+
+    GenerateMissingDefinitionsCodeActionLibclangBased code_action{compilation_database};
+
+    GIVEN("A header with a mix of functions, which need to be defined, and which do not")
+    {
+        auto foo_header_path{directory_tree.create_file("include/foo.hpp",
+                                                        "struct Foo\n"
+                                                        "{\n"
+                                                        "    Foo() = default;\n"
+                                                        "    void run();\n"
+                                                        "    int stop(unsigned timeout);\n"
+                                                        "    void inlined() {}\n"
+                                                        "    template<typename T> void templated(T);\n"
+                                                        "    virtual void pure() = 0;\n"
+                                                        "};\n"
+                                                        "void free_function(double value);\n")};
+
+        AND_GIVEN("A paired source file, which defines one of the functions already")
+        {
+            auto foo_source_path{directory_tree.create_file("foo.cpp",
+                                                            "#include \"include/foo.hpp\"\n"
+                                                            "\n"
+                                                            "void Foo::run()\n"
+                                                            "{\n"
+                                                            "}\n")};
+
+            AND_GIVEN("Another header without a paired source file")
+            {
+                auto bar_header_path{directory_tree.create_file("include/bar.hpp",
+                                                                "struct Bar\n"
+                                                                "{\n"
+                                                                "    void baz();\n"
+                                                                "};\n")};
+
+                WHEN("The missing definitions are generated for both headers")
+                {
+                    auto result{code_action.apply(
+                        {.root_directory = "temp", .header_paths = {foo_header_path, bar_header_path}})};
+
+                    THEN("The definitions are appended to the paired source, in the declaration order")
+                    {
+                        REQUIRE(result.at(fs::weakly_canonical(foo_source_path))
+                                == "#include \"include/foo.hpp\"\n"
+                                   "\n"
+                                   "void Foo::run()\n"
+                                   "{\n"
+                                   "}\n"
+                                   "\n"
+                                   "int Foo::stop(unsigned int timeout)\n"
+                                   "{\n"
+                                   "}\n"
+                                   "\n"
+                                   "void free_function(double value)\n"
+                                   "{\n"
+                                   "}\n");
+                    }
+
+                    AND_THEN("A new source file is created for the header without a paired source")
+                    {
+                        REQUIRE(result.at(fs::weakly_canonical(directory_tree.get_root_absolute_path() / "include"
+                                                               / "bar.cpp"))
+                                == "#include \"bar.hpp\"\n"
+                                   "\n"
+                                   "void Bar::baz()\n"
+                                   "{\n"
+                                   "}\n");
+                    }
+
+                    AND_THEN("No other file is edited")
+                    {
+                        REQUIRE(result.size() == 2);
+                    }
+                }
+            }
+        }
+
+        AND_GIVEN("A paired source file, which does not include the header")
+        {
+            auto foo_source_path{directory_tree.create_file("foo.cpp",
+                                                            "int answer()\n"
+                                                            "{\n"
+                                                            "    return 42;\n"
+                                                            "}\n")};
+
+            WHEN("The missing definitions are generated for the header")
+            {
+                auto result{code_action.apply({.root_directory = "temp", .header_paths = {foo_header_path}})};
+
+                THEN("The header is included by the source, together with the appended definitions")
+                {
+                    REQUIRE(result.at(fs::weakly_canonical(foo_source_path))
+                            == "#include \"include/foo.hpp\"\n"
+                               "\n"
+                               "int answer()\n"
+                               "{\n"
+                               "    return 42;\n"
+                               "}\n"
+                               "\n"
+                               "void Foo::run()\n"
+                               "{\n"
+                               "}\n"
+                               "\n"
+                               "int Foo::stop(unsigned int timeout)\n"
+                               "{\n"
+                               "}\n"
+                               "\n"
+                               "void free_function(double value)\n"
+                               "{\n"
+                               "}\n");
+                }
+            }
+        }
+    }
+
+    GIVEN("Two headers without a paired source file, which differ only by their extensions")
+    {
+        auto h_header_path{directory_tree.create_file("include/baz.h", "void baz();\n")};
+        auto hpp_header_path{directory_tree.create_file("include/baz.hpp", "void qux();\n")};
+
+        WHEN("The missing definitions are generated for both headers")
+        {
+            auto result{
+                code_action.apply({.root_directory = "temp", .header_paths = {h_header_path, hpp_header_path}})};
+
+            THEN("A single new source file includes both headers, and defines the functions of both")
+            {
+                REQUIRE(result.size() == 1);
+                REQUIRE(result.at(fs::weakly_canonical(directory_tree.get_root_absolute_path() / "include" / "baz.cpp"))
+                        == "#include \"baz.h\"\n"
+                           "#include \"baz.hpp\"\n"
+                           "\n"
+                           "void baz()\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "void qux()\n"
+                           "{\n"
+                           "}\n");
+            }
+        }
+    }
+}
@@ -9,6 +9,7 @@
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 #include "base_error.hpp"
+#include "cancellation_token.hpp"
 #include "directory_tree.hpp"
 #include "implement_interface_code_action.hpp"
 
@@ -54,7 +55,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir,
                                                    .source_file_content = class_def,
-                                                   .inteface_name = "Runnable",
+                                                   .interface_names = {"Runnable"},
                                                    .cursor_position_line = cursor_position_line})};
 
                     THEN("New file content is returned")
@@ -116,7 +117,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                             auto result{code_action.apply({.root_directory = "temp",
                                                            .source_file_path = working_root_dir,
                                                            .source_file_content = class_def,
-                                                           .inteface_name = "RunnableAndPrintable",
+                                                           .interface_names = {"RunnableAndPrintable"},
                                                            .cursor_position_line = cursor_position_line})};
 
                             THEN("The class definition implements the compound interface")
@@ -139,6 +140,62 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
         }
     }
 
+    SECTION("Implements multiple interfaces at once")
+    {
+        GIVEN("An interface")
+        {
+            directory_tree.create_file("runnable.hpp",
+                                       "struct Runnable\n"
+                                       "{\n"
+                                       "    virtual void run() = 0;\n"
+                                       "    virtual int stop(unsigned timeout_ms) = 0;\n"
+                                       "};\n");
+
+            AND_GIVEN("Another interface, which shares a method with the first one")
+            {
+                directory_tree.create_file("stoppable.hpp",
+                                           "struct Stoppable\n"
+                                           "{\n"
+                                           "    virtual int stop(unsigned timeout_ms) = 0;\n"
+                                           "    virtual void reset() = 0;\n"
+                                           "};\n");
+
+                AND_GIVEN("A class definition")
+                {
+                    std::string class_def{
+                        "class Maker\n"
+                        "{\n"
+                        "};\n"};
+
+                    WHEN("Both interfaces are requested to be implemented")
+                    {
+                        auto result{code_action.apply({.root_directory = "temp",
+                                                       .source_file_path = working_root_dir,
+                                                       .source_file_content = class_def,
+                                                       .interface_names = {"Runnable", "Stoppable", "Runnable"},
+                                                       .cursor_position_line = 2})};
+
+                        THEN("Single include block, base-clause and overrides section are created")
+                        {
+                            std::string expected_result{
+                                "#include \"runnable.hpp\"\n"
+                                "#include \"stoppable.hpp\"\n"
+                                "class Maker : public Runnable, public Stoppable\n"
+                                "{\n"
+                                "public:\n"
+                                "    void run() override;\n"
+                                "    int stop(unsigned int timeout_ms) override;\n"
+                                "    void reset() override;\n"
+                                "};\n"};
+
+                            REQUIRE(result == expected_result);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     SECTION("Extends pretty big class")
     {
         GIVEN("An interface")
@@ -226,7 +283,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir,
                                                    .source_file_content = class_def,
-                                                   .inteface_name = "Logger",
+                                                   .interface_names = {"Logger"},
                                                    .cursor_position_line = cursor_position_line})};
 
                     THEN("The class definition implements the compound interface")
@@ -315,7 +372,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir,
                                                    .source_file_content = class_def,
-                                                   .inteface_name = "Logger",
+                                                   .interface_names = {"Logger"},
                                                    .cursor_position_line = 1})};
 
                     THEN("The nested type is properly scope-shortened")
@@ -367,7 +424,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir,
                                                    .source_file_content = class_def,
-                                                   .inteface_name = "Scanner",
+                                                   .interface_names = {"Scanner"},
                                                    .cursor_position_line = 5})};
 
                     THEN("The types are properly resolved")
@@ -397,7 +454,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
             code_action.apply({.root_directory = "temp",
                                .source_file_path = working_root_dir,
                                .source_file_content = class_def,
-                               .inteface_name = "Scanner",
+                               .interface_names = {"Scanner"},
                                .cursor_position_line = 1}
 
             );
@@ -426,7 +483,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
             code_action.apply({.root_directory = "temp",
                                .source_file_path = working_root_dir,
                                .source_file_content = class_def,
-                               .inteface_name = "Scanner",
+                               .interface_names = {"Scanner"},
                                .cursor_position_line = 1}
 
             );
@@ -438,6 +495,25 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                                 and Catch::Matchers::ContainsSubstring("found"));
     }
 
+    SECTION("Stops before parsing, when cancelled")
+    {
+        directory_tree.create_file("runnable.hpp",
+                                   "struct Runnable\n"
+                                   "{\n"
+                                   "    virtual void run() = 0;\n"
+                                   "};\n");
+        CancellationToken cancellation;
+        cancellation.cancel();
+
+        REQUIRE_THROWS_AS(code_action.apply({.root_directory = "temp",
+                                             .source_file_path = working_root_dir,
+                                             .source_file_content = "struct Maker {};\n",
+                                             .interface_names = {"Runnable"},
+                                             .cursor_position_line = 1,
+                                             .cancellation = cancellation}),
+                          OperationCancelled);
+    }
+
     SECTION("Implementor is a class with multiple base classes span over multiple lines")
     {
         GIVEN("An interface")
@@ -475,7 +551,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                         auto result{code_action.apply({.root_directory = "temp",
                                                        .source_file_path = working_root_dir,
                                                        .source_file_content = class_def,
-                                                       .inteface_name = "Scanner",
+                                                       .interface_names = {"Scanner"},
                                                        .cursor_position_line = 4})};
 
                         THEN("The base-clause is properly extended")
@@ -539,7 +615,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                         auto result{code_action.apply({.root_directory = "temp",
                                                        .source_file_path = file_path,
                                                        .source_file_content = file_content,
-                                                       .inteface_name = "Scanner",
+                                                       .interface_names = {"Scanner"},
                                                        .cursor_position_line = 4})};
 
                         THEN("No errors related to inclusion occurr")
@@ -585,7 +661,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir / "implementor.hpp",
                                                    .source_file_content = class_def,
-                                                   .inteface_name = "Scanner",
+                                                   .interface_names = {"Scanner"},
                                                    .cursor_position_line = 1})};
 
                     THEN("The class is properly extended")
@@ -638,7 +714,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir / "implementor.hpp",
                                                    .source_file_content = struct_,
-                                                   .inteface_name = "Interface",
+                                                   .interface_names = {"Interface"},
                                                    .cursor_position_line = 8})};
 
                     THEN("The struct is properly extended")
@@ -694,7 +770,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir / "implementor.hpp",
                                                    .source_file_content = struct_,
-                                                   .inteface_name = "Interface",
+                                                   .interface_names = {"Interface"},
                                                    .cursor_position_line = 2})};
 
                     THEN("The include stays as it is")
@@ -713,6 +789,94 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
         }
     }
 
+    SECTION("Does not add include if the interface is already included by another header")
+    {
+        GIVEN("An interface")
+        {
+            directory_tree.create_file("interface.hpp",
+                                       "struct Interface\n"
+                                       "{\n"
+                                       "    virtual void do_stuff() = 0;\n"
+                                       "};\n");
+
+            AND_GIVEN("A header, which includes the interface header")
+            {
+                directory_tree.create_file("everything.hpp", "#include \"interface.hpp\"\n");
+
+                AND_GIVEN("An about-to-be implementor which includes that header")
+                {
+                    std::string struct_{
+                        "#include \"everything.hpp\"\n"
+                        "struct SomeStruct\n"
+                        "{\n"
+                        "};\n"};
+
+                    WHEN("The implement interface code action is invoked")
+                    {
+                        auto result{code_action.apply({.root_directory = "temp",
+                                                       .source_file_path = working_root_dir / "implementor.hpp",
+                                                       .source_file_content = struct_,
+                                                       .interface_names = {"Interface"},
+                                                       .cursor_position_line = 2})};
+
+                        THEN("No include is added")
+                        {
+                            std::string expected_result{
+                                "#include \"everything.hpp\"\n"
+                                "struct SomeStruct : Interface\n"
+                                "{\n"
+                                "    void do_stuff() override;\n"
+                                "};\n"};
+
+                            REQUIRE(result == expected_result);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Includes the interface header from a subdirectory with the path relative to the implementor")
+    {
+        GIVEN("An interface within a subdirectory")
+        {
+            directory_tree.create_file("interfaces/scanner.hpp",
+                                       "struct Scanner\n"
+                                       "{\n"
+                                       "    virtual int scan() = 0;\n"
+                                       "};\n");
+
+            AND_GIVEN("An about-to-be implementor")
+            {
+                std::string struct_{
+                    "struct SomeStruct\n"
+                    "{\n"
+                    "};\n"};
+
+                WHEN("The implement interface code action is invoked")
+                {
+                    auto result{code_action.apply({.root_directory = "temp",
+                                                   .source_file_path = working_root_dir / "implementor.hpp",
+                                                   .source_file_content = struct_,
+                                                   .interface_names = {"Scanner"},
+                                                   .cursor_position_line = 1})};
+
+                    THEN("The include path resolves to the interface header")
+                    {
+                        std::string expected_result{
+                            "#include \"interfaces/scanner.hpp\"\n"
+                            "struct SomeStruct : Scanner\n"
+                            "{\n"
+                            "    int scan() override;\n"
+                            "};\n"};
+
+                        REQUIRE(result == expected_result);
+                    }
+                }
+            }
+        }
+    }
+
     SECTION("Does not add base class specifier if already exists")
     {
         GIVEN("An interface")
@@ -740,7 +904,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir / "implementor.hpp",
                                                    .source_file_content = struct_,
-                                                   .inteface_name = "Interface",
+                                                   .interface_names = {"Interface"},
                                                    .cursor_position_line = 2})};
 
                     THEN("The base-clause stays as it is")
@@ -801,7 +965,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                             code_action.apply({.root_directory = "temp",
                                                .source_file_path = working_root_dir / "implementor.hpp",
                                                .source_file_content = struct_,
-                                               .inteface_name = "Interface",
+                                               .interface_names = {"Interface"},
                                                .cursor_position_line = line});
                         }};
 
@@ -852,7 +1016,7 @@ TEST_CASE("Generate code that makes a class implement an interface", "[Implement
                     auto result{code_action.apply({.root_directory = "temp",
                                                    .source_file_path = working_root_dir / "implementor.hpp",
                                                    .source_file_content = structs,
-                                                   .inteface_name = "Interface",
+                                                   .interface_names = {"Interface"},
                                                    .cursor_position_line = line})};
 
                     THEN("The almost most deeply nested struct is extended")
@@ -0,0 +1,121 @@
+/**
+ * @file        test_include_graph.cpp
+ * @brief       Tests the include graph, and its builder.
+ */
+#include <filesystem>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "directory_tree.hpp"
+#include "include_graph.hpp"
+
+#include "clang_ast_fixtures.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Answers the inclusion queries", "[IncludeGraph]")
+{
+    GIVEN("An include graph with a chain of includes, a cycle, and a file, which includes nothing")
+    {
+        IncludeGraph graph{{{"/project/main.cpp", "/project/app.hpp"},
+                            {"/project/app.hpp", "/project/gui/widget.hpp"},
+                            {"/project/gui/widget.hpp", "/project/gui/layout.hpp"},
+                            {"/project/gui/layout.hpp", "/project/gui/widget.hpp"},
+                            {"/project/other.cpp", "/project/gui/layout.hpp"},
+                            {"/project/main.cpp", "/project/app.hpp"}}};
+
+        THEN("Each file is a single node")
+        {
+            REQUIRE(graph.size() == 5);
+        }
+
+        THEN("The duplicated edges are kept once")
+        {
+            auto main_file_id{graph.find("/project/main.cpp")};
+            REQUIRE(main_file_id);
+            auto direct_includes{graph.get_direct_includes(*main_file_id)};
+            REQUIRE(direct_includes.size() == 1);
+            REQUIRE(graph.get_path(direct_includes[0]) == "/project/app.hpp");
+        }
+
+        THEN("The files included directly, or not, are found")
+        {
+            REQUIRE(graph.is_included("/project/app.hpp", "/project/main.cpp"));
+            REQUIRE(graph.is_included("/project/gui/layout.hpp", "/project/main.cpp"));
+            REQUIRE(graph.is_included("/project/gui/widget.hpp", "/project/other.cpp"));
+        }
+
+        THEN("The files, which are not included, are not found")
+        {
+            REQUIRE(not graph.is_included("/project/main.cpp", "/project/app.hpp"));
+            REQUIRE(not graph.is_included("/project/app.hpp", "/project/other.cpp"));
+            REQUIRE(not graph.is_included("/project/unknown.hpp", "/project/main.cpp"));
+        }
+    }
+}
+
+TEST_CASE("Builds the include graph of the project from the compilation database", "[IncludeGraph]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{fs::weakly_canonical(directory_tree.get_root_absolute_path())};
+
+    GIVEN("A source file including a header next to it, which includes a header from the include directory")
+    {
+        auto widget_header{fs::weakly_canonical(directory_tree.create_file("include/gui/widget.hpp",
+                                                                           "#pragma once\n"
+                                                                           "#include <vector>\n"
+                                                                           "struct Widget {};\n"))};
+        auto app_header{fs::weakly_canonical(directory_tree.create_file("src/app.hpp",
+                                                                        "#pragma once\n"
+                                                                        "#include \"gui/widget.hpp\"\n"))};
+        auto main_file{fs::weakly_canonical(directory_tree.create_file("src/main.cpp",
+                                                                       "#include \"app.hpp\"\n"
+                                                                       "int main() {}\n"))};
+
+        IncludeGraphBuilderLibclangBased builder{make_compilation_database(
+            working_root_dir, {main_file}, "-I" + (working_root_dir / "include").string())};
+        IncludeGraphParameters parameters{.root_directory = working_root_dir,
+                                          .cache_directory = working_root_dir / ".cache"};
+
+        WHEN("The graph is built")
+        {
+            auto graph{builder.build(parameters)};
+
+            THEN("Only the project files are the nodes")
+            {
+                REQUIRE(graph.size() == 3);
+            }
+
+            THEN("The includes are resolved with the search directories of the translation unit")
+            {
+                REQUIRE(graph.is_included(app_header, main_file));
+                REQUIRE(graph.is_included(widget_header, main_file));
+                REQUIRE(graph.is_included(widget_header, app_header));
+                REQUIRE(not graph.is_included(app_header, widget_header));
+            }
+
+            THEN("The include directives are cached")
+            {
+                REQUIRE(fs::exists(parameters.cache_directory / "include_graph.json"));
+            }
+
+            AND_WHEN("A header is changed to include another one, and the graph is built again")
+            {
+                auto config_header{fs::weakly_canonical(directory_tree.create_file("include/config.hpp", ""))};
+                directory_tree.create_file("include/gui/widget.hpp",
+                                           "#pragma once\n"
+                                           "#include \"config.hpp\"\n"
+                                           "struct Widget {};\n");
+                auto rebuilt_graph{builder.build(parameters)};
+
+                THEN("The changed header is scanned again")
+                {
+                    REQUIRE(rebuilt_graph.size() == 4);
+                    REQUIRE(rebuilt_graph.is_included(config_header, main_file));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,164 @@
+/**
+ * @file        test_include_resolver.cpp
+ * @brief       Tests the include directives resolution, and the include path spelling.
+ */
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "directory_tree.hpp"
+#include "include_resolver.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Collects the header search directories from the compile command", "[IncludeResolver]")
+{
+    GIVEN("A compile command with all kinds of the search directories, both joined with the option and separate")
+    {
+        clang::tooling::CompileCommand compile_command{"/project/build",
+                                                       "/project/main.cpp",
+                                                       {"c++",
+                                                        "-Iinclude",
+                                                        "-I",
+                                                        "/project/third_party/../external",
+                                                        "-iquote",
+                                                        "quoted",
+                                                        "-isystem/usr/include/boost",
+                                                        "--include-directory=generated",
+                                                        "-idirafter",
+                                                        "after",
+                                                        "-std=c++20",
+                                                        "-c",
+                                                        "/project/main.cpp"},
+                                                       "main.o"};
+
+        WHEN("The search directories are parsed")
+        {
+            auto search_paths{parse_include_search_paths(compile_command)};
+
+            THEN("They are made absolute, and kept in the order of the command line")
+            {
+                REQUIRE(search_paths.quote_directories == std::vector<fs::path>{"/project/build/quoted"});
+                REQUIRE(search_paths.angled_directories
+                        == std::vector<fs::path>{
+                            "/project/build/include", "/project/external", "/project/build/generated"});
+                REQUIRE(search_paths.system_directories
+                        == std::vector<fs::path>{"/usr/include/boost", "/project/build/after"});
+            }
+        }
+    }
+}
+
+TEST_CASE("Finds the include directives without preprocessing", "[IncludeResolver]")
+{
+    GIVEN("Source code with the include directives spelled in many ways, and with code resembling them")
+    {
+        std::string source_code{"#include \"app.hpp\"\n"
+                                "#include <vector>\n"
+                                "  #  include   <sys/types.h>  // Why not?\n"
+                                "#if 0\n"
+                                "#include \"disabled.hpp\"\n"
+                                "#endif\n"
+                                "#include_next <limits.h>\n"
+                                "#include HEADER_FROM_MACRO\n"
+                                "// #include \"commented.hpp\"\n"
+                                "/*\n"
+                                "#include \"commented_as_well.hpp\"\n"
+                                "*/\n"
+                                "const char* text{\"#include \\\"text.hpp\\\"\"};\n"
+                                "int x = 1; # include \"not_at_line_start.hpp\"\n"
+                                "#include\n"
+                                "#include \"last.hpp\""};
+
+        WHEN("The include directives are scanned")
+        {
+            auto include_directives{scan_include_directives(source_code)};
+
+            THEN("All the directives are found, also from the disabled blocks, but not from the comments nor strings")
+            {
+                REQUIRE(include_directives
+                        == std::vector<IncludeDirective>{{.spelling = "app.hpp", .is_angled = false},
+                                                         {.spelling = "vector", .is_angled = true},
+                                                         {.spelling = "sys/types.h", .is_angled = true},
+                                                         {.spelling = "disabled.hpp", .is_angled = false},
+                                                         {.spelling = "limits.h", .is_angled = true},
+                                                         {.spelling = "last.hpp", .is_angled = false}});
+            }
+        }
+    }
+}
+
+TEST_CASE("Resolves the includes, and spells the shortest include paths", "[IncludeResolver]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{fs::weakly_canonical(directory_tree.get_root_absolute_path())};
+
+    GIVEN("A project with the headers next to the includer, under an include directory, and under a system directory")
+    {
+        auto includer{directory_tree.create_file("src/main.cpp", "")};
+        auto local_header{fs::weakly_canonical(directory_tree.create_file("src/detail/local.hpp", ""))};
+        auto library_header{fs::weakly_canonical(directory_tree.create_file("include/gui/drawable.hpp", ""))};
+        auto system_header{fs::weakly_canonical(directory_tree.create_file("system/boost/any.hpp", ""))};
+
+        IncludeSearchPaths search_paths{.angled_directories = {working_root_dir / "include", working_root_dir},
+                                        .system_directories = {working_root_dir / "system"}};
+
+        WHEN("The includes are resolved")
+        {
+            THEN("The quoted ones are looked up next to the includer first, and then within the search directories")
+            {
+                REQUIRE(resolve_include({.spelling = "detail/local.hpp", .is_angled = false}, includer, search_paths)
+                        == local_header);
+                REQUIRE(resolve_include({.spelling = "gui/drawable.hpp", .is_angled = false}, includer, search_paths)
+                        == library_header);
+                REQUIRE(resolve_include({.spelling = "boost/any.hpp", .is_angled = true}, includer, search_paths)
+                        == system_header);
+            }
+
+            THEN("The angled ones are not looked up next to the includer")
+            {
+                REQUIRE(resolve_include({.spelling = "detail/local.hpp", .is_angled = true}, includer, search_paths)
+                        == std::nullopt);
+            }
+
+            THEN("The missing ones are not resolved")
+            {
+                REQUIRE(resolve_include({.spelling = "missing.hpp", .is_angled = false}, includer, search_paths)
+                        == std::nullopt);
+            }
+        }
+
+        WHEN("The include paths are spelled")
+        {
+            THEN("The shortest path is chosen, from any of the directories")
+            {
+                REQUIRE(spell_include(local_header, includer, search_paths) == "\"detail/local.hpp\"");
+                REQUIRE(spell_include(library_header, includer, search_paths) == "\"gui/drawable.hpp\"");
+            }
+
+            THEN("The headers found within the system directories only are spelled with the angle brackets")
+            {
+                REQUIRE(spell_include(system_header, includer, search_paths) == "<boost/any.hpp>");
+            }
+
+            THEN("The headers outside all the directories are not spelled")
+            {
+                REQUIRE(spell_include(local_header, includer, IncludeSearchPaths{}) == "\"detail/local.hpp\"");
+                REQUIRE(spell_include(library_header, includer, IncludeSearchPaths{}) == std::nullopt);
+            }
+        }
+
+        AND_GIVEN("A header next to the includer, which shadows the header from the include directory")
+        {
+            directory_tree.create_file("src/gui/drawable.hpp", "");
+
+            THEN("The shadowed header is spelled with the longer path, which resolves to it indeed")
+            {
+                REQUIRE(spell_include(library_header, includer, search_paths) == "\"include/gui/drawable.hpp\"");
+            }
+        }
+    }
+}
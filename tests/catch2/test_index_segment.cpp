@@ -0,0 +1,95 @@
+/**
+ * @file        test_index_segment.cpp
+ * @brief       Tests the index segments, and the index writer lock.
+ */
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "base_error.hpp"
+#include "index_segment.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Publishes and maps the index segments", "[IndexSegment]")
+{
+    auto segments_directory{fs::temp_directory_path() / "tsepepe_test_index_segments"};
+    auto segment_file_path{segments_directory / "index.bin"};
+    IndexSegmentMagic magic{'T', 'E', 'S', 'T'};
+
+    GIVEN("A segment published from multiple payload parts")
+    {
+        IndexSegment::publish(segment_file_path, magic, 1, {"first part, ", "second part"});
+
+        THEN("Nothing, but the segment, is left within the directory")
+        {
+            REQUIRE(std::distance(fs::directory_iterator{segments_directory}, fs::directory_iterator{}) == 1);
+        }
+
+        WHEN("The segment is mapped")
+        {
+            IndexSegment segment{segment_file_path, magic, 1};
+
+            THEN("The payload parts are put one after another")
+            {
+                REQUIRE(segment.get_payload() == "first part, second part");
+            }
+
+            AND_WHEN("A new segment is published meanwhile")
+            {
+                IndexSegment::publish(segment_file_path, magic, 1, {"new payload"});
+
+                THEN("The mapped segment stays intact, while the new one is seen once mapped")
+                {
+                    REQUIRE(segment.get_payload() == "first part, second part");
+                    REQUIRE(IndexSegment{segment_file_path, magic, 1}.get_payload() == "new payload");
+                }
+            }
+        }
+
+        THEN("Mapping it as a segment of another kind, or version, throws")
+        {
+            REQUIRE_THROWS_AS((IndexSegment{segment_file_path, {'O', 'T', 'H', 'R'}, 1}), BaseError);
+            REQUIRE_THROWS_AS((IndexSegment{segment_file_path, magic, 2}), BaseError);
+        }
+    }
+
+    GIVEN("A truncated segment")
+    {
+        IndexSegment::publish(segment_file_path, magic, 1, {"payload"});
+        fs::resize_file(segment_file_path, fs::file_size(segment_file_path) - 1);
+
+        THEN("Mapping it throws")
+        {
+            REQUIRE_THROWS_AS((IndexSegment{segment_file_path, magic, 1}), BaseError);
+        }
+    }
+
+    GIVEN("A missing segment")
+    {
+        THEN("Mapping it throws")
+        {
+            REQUIRE_THROWS_AS((IndexSegment{segments_directory / "missing.bin", magic, 1}), BaseError);
+        }
+    }
+
+    GIVEN("A writer lock, which is taken and released")
+    {
+        auto lock_file_path{segments_directory / "index.bin.lock"};
+        {
+            IndexWriterLock writer_lock{lock_file_path};
+        }
+
+        THEN("The lock file is created, and the lock can be taken again")
+        {
+            REQUIRE(fs::exists(lock_file_path));
+            IndexWriterLock writer_lock{lock_file_path};
+        }
+    }
+
+    fs::remove_all(segments_directory);
+}
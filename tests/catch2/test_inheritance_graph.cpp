@@ -0,0 +1,126 @@
+/**
+ * @file        test_inheritance_graph.cpp
+ * @brief       Tests the inheritance graph.
+ */
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "inheritance_graph.hpp"
+
+using namespace Tsepepe;
+
+static std::vector<std::string> to_names(const InheritanceGraph& graph,
+                                         const std::vector<InheritanceGraph::ClassId>& ids)
+{
+    std::vector<std::string> result;
+    for (auto id : ids)
+        result.emplace_back(graph.get_qualified_name(id));
+    return result;
+}
+
+TEST_CASE("Answers the inheritance queries", "[InheritanceGraph]")
+{
+    GIVEN("An interface hierarchy with a diamond, and a base defined outside the project")
+    {
+        std::vector<IndexedClass> classes{
+            {.qualified_name = "Shapes::Shape", .location = {"shape.hpp", 1}, .is_abstract = true},
+            {.qualified_name = "Shapes::Printable",
+             .location = {"printable.hpp", 1},
+             .is_abstract = true,
+             .bases = {"std::exception"}},
+            {.qualified_name = "Shapes::PrintableShape",
+             .location = {"printable_shape.hpp", 1},
+             .is_abstract = true,
+             .bases = {"Shapes::Shape", "Shapes::Printable"}},
+            {.qualified_name = "Shapes::Circle",
+             .location = {"circle.hpp", 1},
+             .is_abstract = false,
+             .bases = {"Shapes::PrintableShape", "Shapes::Shape"}},
+            {.qualified_name = "Shapes::Square",
+             .location = {"square.hpp", 1},
+             .is_abstract = false,
+             .bases = {"Shapes::Shape"}},
+            {.qualified_name = "Other::Shape", .location = {"other.hpp", 1}, .is_abstract = false},
+            // The same class, seen at another location.
+            {.qualified_name = "Shapes::Square",
+             .location = {"square_copy.hpp", 1},
+             .is_abstract = false,
+             .bases = {"Shapes::Shape"}}};
+
+        InheritanceGraph graph{classes};
+
+        THEN("Each class is interned once, including the external base")
+        {
+            REQUIRE(graph.size() == 7);
+        }
+
+        WHEN("The classes are looked up by the bare, the partially qualified, and the fully qualified name")
+        {
+            THEN("All the classes ending with the name are found, unless the name starts with '::'")
+            {
+                REQUIRE(to_names(graph, graph.find("Shape"))
+                        == std::vector<std::string>{"Other::Shape", "Shapes::Shape"});
+                REQUIRE(to_names(graph, graph.find("Shapes::Shape")) == std::vector<std::string>{"Shapes::Shape"});
+                REQUIRE(to_names(graph, graph.find("::Shape")).empty());
+                REQUIRE(to_names(graph, graph.find("::Other::Shape")) == std::vector<std::string>{"Other::Shape"});
+                REQUIRE(graph.find("Triangle").empty());
+            }
+        }
+
+        WHEN("The implementors of the interface are queried")
+        {
+            auto shape{graph.find("Shapes::Shape").front()};
+
+            THEN("The non-abstract classes deriving from it, directly or not, are found, each once")
+            {
+                REQUIRE(to_names(graph, graph.find_implementors(shape))
+                        == std::vector<std::string>{"Shapes::Circle", "Shapes::Square"});
+            }
+
+            AND_THEN("All the derived classes include the extending interfaces")
+            {
+                REQUIRE(to_names(graph, graph.find_derived_classes(shape))
+                        == std::vector<std::string>{"Shapes::Circle", "Shapes::PrintableShape", "Shapes::Square"});
+            }
+
+            AND_THEN("The direct derived classes are only those, which name the interface within their base-clause")
+            {
+                REQUIRE(to_names(graph, {std::begin(graph.get_direct_derived_classes(shape)),
+                                         std::end(graph.get_direct_derived_classes(shape))})
+                        == std::vector<std::string>{"Shapes::Circle", "Shapes::PrintableShape", "Shapes::Square"});
+            }
+        }
+
+        WHEN("The bases of the implementor are queried")
+        {
+            auto circle{graph.find("Circle").front()};
+
+            THEN("All the bases are found, including the external one")
+            {
+                REQUIRE(to_names(graph, graph.find_bases(circle))
+                        == std::vector<std::string>{
+                            "Shapes::Printable", "Shapes::PrintableShape", "Shapes::Shape", "std::exception"});
+            }
+
+            AND_THEN("Only the abstract ones are its interfaces")
+            {
+                REQUIRE(to_names(graph, graph.find_interfaces(circle))
+                        == std::vector<std::string>{"Shapes::Printable", "Shapes::PrintableShape", "Shapes::Shape"});
+            }
+        }
+
+        WHEN("The abstract classes are queried with a prefix")
+        {
+            THEN("The ones, whose bare or qualified name starts with the prefix, are found")
+            {
+                REQUIRE(to_names(graph, graph.find_abstract_classes("Print"))
+                        == std::vector<std::string>{"Shapes::Printable", "Shapes::PrintableShape"});
+                REQUIRE(to_names(graph, graph.find_abstract_classes("Shapes::S"))
+                        == std::vector<std::string>{"Shapes::Shape"});
+                REQUIRE(graph.find_abstract_classes().size() == 3);
+            }
+        }
+    }
+}
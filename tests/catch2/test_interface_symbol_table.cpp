@@ -0,0 +1,120 @@
+/**
+ * @file        test_interface_symbol_table.cpp
+ * @brief       Tests the interface symbol table.
+ */
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "base_error.hpp"
+#include "interface_symbol_table.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Completes the interface names from the symbol table", "[InterfaceSymbolTable]")
+{
+    auto table_file_path{fs::temp_directory_path() / "tsepepe_test_interface_symbols.bin"};
+
+    GIVEN("A class index with interfaces spread across the project, and a concrete class")
+    {
+        ClassIndex class_index{
+            .classes = {
+                {.qualified_name = "Gui::Drawable", .location = {"/project/gui/drawable.hpp", 3}, .is_abstract = true},
+                {.qualified_name = "Gui::DrawableShape",
+                 .location = {"/project/gui/shapes/drawable_shape.hpp", 5},
+                 .is_abstract = true},
+                {.qualified_name = "Io::Drawer", .location = {"/project/io/drawer.hpp", 7}, .is_abstract = true},
+                {.qualified_name = "Io::DataReader", .location = {"/project/io/reader.hpp", 2}, .is_abstract = true},
+                {.qualified_name = "Gui::DrawableCircle",
+                 .location = {"/project/gui/circle.hpp", 4},
+                 .is_abstract = false}}};
+        InterfaceSymbolTable::write(class_index, table_file_path);
+
+        WHEN("The table is opened")
+        {
+            InterfaceSymbolTable table{table_file_path};
+
+            THEN("Only the abstract classes are present")
+            {
+                REQUIRE(table.size() == 4);
+            }
+
+            AND_WHEN("The interfaces are completed with a prefix, from a file close to one of them")
+            {
+                auto result{table.complete({.pattern = "Draw",
+                                            .mode = CompletionMode::prefix,
+                                            .current_file = "/project/gui/shapes/square.hpp"})};
+
+                THEN("The matching interfaces are found, the closest ones first")
+                {
+                    REQUIRE(result
+                            == std::vector<InterfaceCandidate>{
+                                {.qualified_name = "Gui::DrawableShape",
+                                 .location = {"/project/gui/shapes/drawable_shape.hpp", 5}},
+                                {.qualified_name = "Gui::Drawable", .location = {"/project/gui/drawable.hpp", 3}},
+                                {.qualified_name = "Io::Drawer", .location = {"/project/io/drawer.hpp", 7}}});
+                }
+            }
+
+            AND_WHEN("The prefix completion is limited")
+            {
+                auto result{table.complete({.pattern = "Draw",
+                                            .mode = CompletionMode::prefix,
+                                            .current_file = "/project/io/main.cpp",
+                                            .max_results = 1})};
+
+                THEN("Only the best ranked interface is returned")
+                {
+                    REQUIRE(result
+                            == std::vector<InterfaceCandidate>{
+                                {.qualified_name = "Io::Drawer", .location = {"/project/io/drawer.hpp", 7}}});
+                }
+            }
+
+            AND_WHEN("The interfaces are completed with a fuzzy pattern, from a file equally far from all of them")
+            {
+                auto result{table.complete(
+                    {.pattern = "dr", .mode = CompletionMode::fuzzy, .current_file = "/elsewhere/main.cpp"})};
+
+                THEN("They are ranked by the match quality, where the word starts weigh most, then the shorter first")
+                {
+                    REQUIRE(result
+                            == std::vector<InterfaceCandidate>{
+                                {.qualified_name = "Io::DataReader", .location = {"/project/io/reader.hpp", 2}},
+                                {.qualified_name = "Io::Drawer", .location = {"/project/io/drawer.hpp", 7}},
+                                {.qualified_name = "Gui::Drawable", .location = {"/project/gui/drawable.hpp", 3}},
+                                {.qualified_name = "Gui::DrawableShape",
+                                 .location = {"/project/gui/shapes/drawable_shape.hpp", 5}}});
+                }
+            }
+
+            AND_WHEN("The fuzzy pattern is qualified")
+            {
+                auto result{table.complete(
+                    {.pattern = "io::draw", .mode = CompletionMode::fuzzy, .current_file = "/elsewhere/main.cpp"})};
+
+                THEN("The qualified names are matched")
+                {
+                    REQUIRE(result
+                            == std::vector<InterfaceCandidate>{
+                                {.qualified_name = "Io::Drawer", .location = {"/project/io/drawer.hpp", 7}}});
+                }
+            }
+        }
+    }
+
+    GIVEN("A file, which is not a symbol table")
+    {
+        std::ofstream{table_file_path} << "Not a table";
+
+        THEN("Opening it throws")
+        {
+            REQUIRE_THROWS_AS(InterfaceSymbolTable{table_file_path}, BaseError);
+        }
+    }
+
+    fs::remove(table_file_path);
+}
@@ -0,0 +1,149 @@
+/**
+ * @file        test_missing_overrides_code_action.cpp
+ * @brief       Tests the missing overrides code action.
+ */
+#include <filesystem>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "directory_tree.hpp"
+#include "missing_overrides_code_action.hpp"
+
+#include "clang_ast_fixtures.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Generate the missing overrides for all the implementors of an interface", "[MissingOverridesCodeAction]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{directory_tree.get_root_absolute_path()};
+
+    GIVEN("An interface with a newly added pure virtual function")
+    {
+        directory_tree.create_file("shape.hpp",
+                                   "struct Shape\n"
+                                   "{\n"
+                                   "    virtual double area() const = 0;\n"
+                                   "    virtual void draw() = 0;\n"
+                                   "};\n");
+
+        AND_GIVEN("Implementors defined within headers, which lack some overrides")
+        {
+            auto circle_path{directory_tree.create_file("circle.hpp",
+                                                        "#include \"shape.hpp\"\n"
+                                                        "struct Circle : Shape\n"
+                                                        "{\n"
+                                                        "    double area() const override;\n"
+                                                        "};\n")};
+            auto square_path{directory_tree.create_file("square.hpp",
+                                                        "#include \"shape.hpp\"\n"
+                                                        "class Square : public Shape\n"
+                                                        "{\n"
+                                                        "  public:\n"
+                                                        "    void draw() override;\n"
+                                                        "};\n")};
+
+            AND_GIVEN("An extending interface, and an implementor which is complete already")
+            {
+                directory_tree.create_file("printable_shape.hpp",
+                                           "#include \"shape.hpp\"\n"
+                                           "struct PrintableShape : Shape\n"
+                                           "{\n"
+                                           "    virtual void print() = 0;\n"
+                                           "};\n"
+                                           "struct Dot : Shape\n"
+                                           "{\n"
+                                           "    double area() const override { return 0.0; }\n"
+                                           "    void draw() override {}\n"
+                                           "};\n");
+
+                AND_GIVEN("Multiple translation units, which include the implementors")
+                {
+                    auto first_tu{directory_tree.create_file("first.cpp",
+                                                             "#include \"circle.hpp\"\n"
+                                                             "#include \"square.hpp\"\n"
+                                                             "#include \"printable_shape.hpp\"\n")};
+                    auto second_tu{directory_tree.create_file("second.cpp", "#include \"circle.hpp\"\n")};
+
+                    MultiFileEdit expected_result{{fs::canonical(circle_path),
+                                                   "#include \"shape.hpp\"\n"
+                                                   "struct Circle : Shape\n"
+                                                   "{\n"
+                                                   "    double area() const override;\n"
+                                                   "    void draw() override;\n"
+                                                   "};\n"},
+                                                  {fs::canonical(square_path),
+                                                   "#include \"shape.hpp\"\n"
+                                                   "class Square : public Shape\n"
+                                                   "{\n"
+                                                   "  public:\n"
+                                                   "    void draw() override;\n"
+                                                   "    double area() const override;\n"
+                                                   "};\n"}};
+                    MissingOverridesCodeActionLibclangBased code_action{
+                        make_compilation_database(working_root_dir, {first_tu, second_tu})};
+
+                    WHEN("Missing overrides code action is invoked")
+                    {
+                        auto result{code_action.apply({.root_directory = working_root_dir, .interface_name = "Shape"})};
+
+                        THEN("Only the incomplete implementors are edited, each one once")
+                        {
+                            REQUIRE(result == expected_result);
+                        }
+                    }
+
+                    WHEN("Missing overrides code action is invoked with the class index cache")
+                    {
+                        auto result{code_action.apply({.root_directory = working_root_dir,
+                                                       .interface_name = "Shape",
+                                                       .cache_directory = working_root_dir / ".cache"})};
+
+                        THEN("The same edits are made, with the implementors looked up within the inheritance graph")
+                        {
+                            REQUIRE(result == expected_result);
+                        }
+                    }
+                }
+            }
+        }
+
+        AND_GIVEN("An intermediate base, leaving a function for its derived class, and a class, deriving from an "
+                  "extending interface")
+        {
+            directory_tree.create_file("partial_shapes.hpp",
+                                       "#include \"shape.hpp\"\n"
+                                       "struct PartialShape : Shape\n"
+                                       "{\n"
+                                       "    double area() const override;\n"
+                                       "};\n"
+                                       "struct Triangle : PartialShape\n"
+                                       "{\n"
+                                       "    void draw() override;\n"
+                                       "};\n"
+                                       "struct PrintableShape : Shape\n"
+                                       "{\n"
+                                       "    virtual void print() = 0;\n"
+                                       "};\n"
+                                       "struct PrintableCircle : PrintableShape\n"
+                                       "{\n"
+                                       "    double area() const override;\n"
+                                       "};\n");
+            auto translation_unit{
+                directory_tree.create_file("partial_shapes.cpp", "#include \"partial_shapes.hpp\"\n")};
+            MissingOverridesCodeActionLibclangBased code_action{
+                make_compilation_database(working_root_dir, {translation_unit})};
+
+            WHEN("Missing overrides code action is invoked")
+            {
+                auto result{code_action.apply({.root_directory = working_root_dir, .interface_name = "Shape"})};
+
+                THEN("None of them is edited, although they are all abstract")
+                {
+                    REQUIRE(result.empty());
+                }
+            }
+        }
+    }
+}
@@ -4,6 +4,8 @@
  */
 #include <filesystem>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
@@ -278,3 +280,95 @@ TEST_CASE("Multiple function definitions are generated at once", "[FunctionDefin
         }
     }
 }
+
+TEST_CASE("Function definitions are generated for multiple line ranges at once", "[FunctionDefinitionGenerator]")
+{
+    using namespace Tsepepe;
+    namespace fs = std::filesystem;
+
+    std::string err;
+    static std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database{
+        clang::tooling::CompilationDatabase::loadFromDirectory(COMPILATION_DATABASE_DIR, err)};
+    if (compilation_database == nullptr)
+        throw std::runtime_error{"Failed to load the compilation database: " + err};
+
+    GIVEN("A header with declarations spread across multiple blocks")
+    {
+        GenerateFunctionDefinitionsCodeActionParameters params{.source_file_path = fs::temp_directory_path(),
+                                                               .source_file_content =
+                                                                   "struct Foo\n"
+                                                                   "{\n"
+                                                                   "    void start();\n"
+                                                                   "    void run();\n"
+                                                                   "\n"
+                                                                   "    int pause(unsigned timeout);\n"
+                                                                   "};\n"
+                                                                   "void free_function(double value);\n"
+                                                                   "void other_function();\n"};
+
+        WHEN("Disjoint ranges are selected, in any order, including one without declarations")
+        {
+            params.selected_line_begin = 8;
+            params.selected_line_end = 9;
+            params.additional_selected_line_ranges = {
+                {.begin = 3, .end = 3}, {.begin = 5, .end = 6}, {.begin = 7, .end = 7}};
+
+            THEN("The definitions are grouped per range, in the order of the ranges")
+            {
+                auto result{GenerateFunctionDefinitionsCodeActionLibclangBased{compilation_database}.apply_per_range(
+                    params)};
+
+                REQUIRE(result
+                        == std::vector<std::string>{"void free_function(double value)\n"
+                                                    "{\n"
+                                                    "}\n"
+                                                    "\n"
+                                                    "void other_function()\n"
+                                                    "{\n"
+                                                    "}\n",
+                                                    "void Foo::start()\n"
+                                                    "{\n"
+                                                    "}\n",
+                                                    "int Foo::pause(unsigned int timeout)\n"
+                                                    "{\n"
+                                                    "}\n",
+                                                    ""});
+            }
+
+            AND_THEN("The single response contains all the groups, separated with an empty line")
+            {
+                auto result{GenerateFunctionDefinitionsCodeActionLibclangBased{compilation_database}.apply(params)};
+
+                REQUIRE(result
+                        == "void free_function(double value)\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "void other_function()\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "void Foo::start()\n"
+                           "{\n"
+                           "}\n"
+                           "\n"
+                           "int Foo::pause(unsigned int timeout)\n"
+                           "{\n"
+                           "}\n");
+            }
+        }
+
+        WHEN("Overlapping ranges are selected")
+        {
+            params.selected_line_begin = 3;
+            params.selected_line_end = 4;
+            params.additional_selected_line_ranges = {{.begin = 4, .end = 6}};
+
+            THEN("It throws")
+            {
+                CHECK_THROWS_AS(GenerateFunctionDefinitionsCodeActionLibclangBased{compilation_database}.apply(params),
+                                Tsepepe::BaseError);
+            }
+        }
+    }
+}
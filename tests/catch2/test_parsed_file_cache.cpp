@@ -0,0 +1,245 @@
+/**
+ * @file        test_parsed_file_cache.cpp
+ * @brief       Tests the ParsedFileCache.
+ */
+#include <filesystem>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "cancellation_token.hpp"
+#include "directory_tree.hpp"
+#include "parsed_file_cache.hpp"
+#include "source_file_content.hpp"
+
+using namespace Tsepepe;
+
+TEST_CASE("Keep the parsed files for the next code actions", "[ParsedFileCache]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{directory_tree.get_root_absolute_path()};
+
+    std::string error_message;
+    std::shared_ptr<clang::tooling::CompilationDatabase> compilation_database{
+        clang::tooling::CompilationDatabase::loadFromDirectory(
+            COMPILATION_DATABASE_DIR, // Supplied within CMakeLists.txt
+            error_message)};
+    if (compilation_database == nullptr)
+        throw std::runtime_error{"Failed to load compilation database from: " COMPILATION_DATABASE_DIR ": "
+                                 + error_message};
+
+    ParsedFileCache cache{compilation_database, working_root_dir};
+
+    GIVEN("A source file, which includes an interface")
+    {
+        directory_tree.create_file("runnable.hpp",
+                                   "struct Runnable\n"
+                                   "{\n"
+                                   "    virtual void run() = 0;\n"
+                                   "};\n");
+        std::string source_content{"#include \"runnable.hpp\"\n"
+                                   "\n"
+                                   "struct Maker : Runnable\n"
+                                   "{\n"
+                                   "    void run() override {}\n"
+                                   "};\n"};
+        auto source_file_path{directory_tree.create_file("maker.cpp", source_content)};
+
+        WHEN("The source file is taken out of the empty cache")
+        {
+            auto parsed_file{cache.take(source_file_path)};
+
+            THEN("The file is parsed")
+            {
+                REQUIRE(parsed_file.ast_unit != nullptr);
+                REQUIRE(parsed_file.path == source_file_path);
+                REQUIRE(cache.size() == 0);
+            }
+
+            AND_WHEN("It is put back, and taken again")
+            {
+                auto ast_unit{parsed_file.ast_unit.get()};
+                cache.put(std::move(parsed_file));
+                REQUIRE(cache.size() == 1);
+
+                auto parsed_again{cache.take(source_file_path)};
+
+                THEN("The AST is taken out of the cache, without parsing the file again")
+                {
+                    REQUIRE(parsed_again.ast_unit.get() == ast_unit);
+                    REQUIRE(cache.size() == 0);
+                }
+            }
+
+            AND_WHEN("It is put back, and the interface changes, before it is taken again")
+            {
+                auto ast_unit{parsed_file.ast_unit.get()};
+                cache.put(std::move(parsed_file));
+                directory_tree.create_file("runnable.hpp",
+                                           "struct Runnable\n"
+                                           "{\n"
+                                           "    virtual void run() = 0;\n"
+                                           "    virtual void stop() = 0;\n"
+                                           "};\n");
+
+                auto parsed_again{cache.take(source_file_path)};
+
+                THEN("The outdated AST is dropped, and the file is parsed again")
+                {
+                    REQUIRE(parsed_again.ast_unit != nullptr);
+                    REQUIRE(parsed_again.ast_unit.get() != ast_unit);
+                    REQUIRE(cache.size() == 0);
+                }
+            }
+        }
+
+        WHEN("The source file is taken, and the code action using it is cancelled")
+        {
+            CancellationToken cancellation;
+            const void* ast_unit{nullptr};
+            REQUIRE_THROWS_AS(
+                [&] {
+                    auto parsed_file{take_parsed_file(&cache, *compilation_database, source_file_path)};
+                    ast_unit = parsed_file->ast_unit.get();
+                    cancellation.cancel();
+                    cancellation.throw_if_cancelled();
+                }(),
+                OperationCancelled);
+
+            THEN("The AST is put back into the cache, and taken by the next code action")
+            {
+                REQUIRE(cache.size() == 1);
+                auto parsed_again{take_parsed_file(&cache, *compilation_database, source_file_path)};
+                REQUIRE(parsed_again->ast_unit.get() == ast_unit);
+                REQUIRE(cache.size() == 0);
+            }
+        }
+
+        WHEN("The file is parsed with its current content, and put back")
+        {
+            auto virtual_file_path{make_virtual_source_file_path(source_file_path, "test")};
+            cache.put(cache.take(virtual_file_path, SourceFileContent{source_content}));
+            REQUIRE(cache.size() == 1);
+
+            AND_WHEN("It is taken with the content changed")
+            {
+                auto parsed_file{cache.take(virtual_file_path, SourceFileContent{source_content + "\nint i;\n"})};
+
+                THEN("The file is parsed again, and the AST of the former content is left in the cache")
+                {
+                    REQUIRE(parsed_file.ast_unit != nullptr);
+                    REQUIRE(cache.size() == 1);
+                }
+            }
+        }
+
+        WHEN("More files are put into the cache, than its capacity")
+        {
+            ParsedFileCache small_cache{compilation_database, working_root_dir, 1};
+            small_cache.put(small_cache.take(source_file_path));
+            small_cache.put(small_cache.take(working_root_dir / "runnable.hpp"));
+
+            THEN("The least recently put file is dropped")
+            {
+                REQUIRE(small_cache.size() == 1);
+                small_cache.take(working_root_dir / "runnable.hpp");
+                REQUIRE(small_cache.size() == 0);
+            }
+        }
+
+        WHEN("The parsed files are stored to the snapshot, and a new cache is made on the same snapshot")
+        {
+            auto snapshot_directory{working_root_dir / "snapshot"};
+            auto virtual_file_path{make_virtual_source_file_path(source_file_path, "test")};
+            {
+                ParsedFileCache stored_cache{
+                    compilation_database, working_root_dir, ParsedFileCache::default_capacity, snapshot_directory};
+                stored_cache.put(stored_cache.take(source_file_path));
+                stored_cache.put(stored_cache.take(virtual_file_path, SourceFileContent{source_content}));
+                stored_cache.store_snapshot();
+            }
+            ParsedFileCache restored_cache{
+                compilation_database, working_root_dir, ParsedFileCache::default_capacity, snapshot_directory};
+
+            THEN("Nothing is loaded, until taken")
+            {
+                REQUIRE(restored_cache.size() == 0);
+            }
+
+            AND_WHEN("The source file is taken")
+            {
+                auto parsed_file{restored_cache.take(source_file_path)};
+
+                THEN("Its AST is loaded from the snapshot, rather than parsed")
+                {
+                    REQUIRE(parsed_file.ast_unit != nullptr);
+                    REQUIRE(parsed_file.snapshot_fingerprint.has_value());
+                }
+            }
+
+            AND_WHEN("The interface changes, before the source file is taken")
+            {
+                directory_tree.create_file("runnable.hpp",
+                                           "struct Runnable\n"
+                                           "{\n"
+                                           "    virtual void stop() = 0;\n"
+                                           "};\n");
+
+                auto parsed_file{restored_cache.take(source_file_path)};
+
+                THEN("The outdated AST is not loaded, and the file is parsed again")
+                {
+                    REQUIRE(parsed_file.ast_unit != nullptr);
+                    REQUIRE(not parsed_file.snapshot_fingerprint.has_value());
+                }
+            }
+
+            AND_WHEN("The file parsed with its content is taken")
+            {
+                auto parsed_file{restored_cache.take(virtual_file_path, SourceFileContent{source_content})};
+
+                THEN("It is parsed again, since the content is not stored")
+                {
+                    REQUIRE(parsed_file.ast_unit != nullptr);
+                    REQUIRE(not parsed_file.snapshot_fingerprint.has_value());
+                }
+            }
+        }
+
+        AND_GIVEN("The header paired with the source file")
+        {
+            directory_tree.create_file("maker.hpp", "struct MakerBase\n{\n};\n");
+
+            WHEN("The source file is warmed up, with its current content")
+            {
+                cache.warm_up(source_file_path, SourceFileContent{source_content});
+
+                THEN("The file, its paired header, and the included interface are parsed ahead")
+                {
+                    REQUIRE(cache.size() == 3);
+
+                    AND_THEN("They are taken out of the cache by the next code actions")
+                    {
+                        cache.take(make_virtual_source_file_path(source_file_path, "implementor"),
+                                   SourceFileContent{source_content});
+                        // The included files are known by their real paths.
+                        cache.take(std::filesystem::canonical(working_root_dir / "runnable.hpp"));
+                        cache.take(working_root_dir / "maker.hpp");
+                        REQUIRE(cache.size() == 0);
+                    }
+                }
+            }
+
+            WHEN("The warm-up is cancelled, before it begins")
+            {
+                CancellationToken cancellation;
+                cancellation.cancel();
+
+                THEN("Nothing is parsed")
+                {
+                    REQUIRE_THROWS_AS(cache.warm_up(source_file_path, std::nullopt, cancellation), OperationCancelled);
+                    REQUIRE(cache.size() == 0);
+                }
+            }
+        }
+    }
+}
@@ -120,6 +120,69 @@ TEST_CASE("Extracts pure virtual functions from abstract class and converts them
                                                         "};\n",
                                  .class_name = "SomeIfacez",
                                  .expected_result = {"float gimme(int) override;"}},
+            SingleHeaderTestData{.description = "Skips pure virtual functions overridden by an intermediate base",
+                                 .header_file_content = "struct Base\n"
+                                                        "{\n"
+                                                        "    virtual void run() = 0;\n"
+                                                        "    virtual void stop() = 0;\n"
+                                                        "    virtual ~Base() = default;\n"
+                                                        "};\n"
+                                                        "struct Partial : Base\n"
+                                                        "{\n"
+                                                        "    void run() override {}\n"
+                                                        "};\n",
+                                 .class_name = "Partial",
+                                 .expected_result = {"void stop() override;"}},
+            SingleHeaderTestData{.description = "Emits once a pure virtual function redeclared by a derived interface",
+                                 .header_file_content = "struct Root\n"
+                                                        "{\n"
+                                                        "    virtual void run() = 0;\n"
+                                                        "    virtual ~Root() = default;\n"
+                                                        "};\n"
+                                                        "struct Extended : Root\n"
+                                                        "{\n"
+                                                        "    virtual void run() = 0;\n"
+                                                        "};\n",
+                                 .class_name = "Extended",
+                                 .expected_result = {"void run() override;"}},
+            SingleHeaderTestData{.description = "Emits once the pure virtual functions of a virtual diamond base",
+                                 .header_file_content = "struct Root\n"
+                                                        "{\n"
+                                                        "    virtual void run() = 0;\n"
+                                                        "    virtual ~Root() = default;\n"
+                                                        "};\n"
+                                                        "struct Left : virtual Root\n"
+                                                        "{\n"
+                                                        "    virtual void left() = 0;\n"
+                                                        "};\n"
+                                                        "struct Right : virtual Root\n"
+                                                        "{\n"
+                                                        "    virtual void right() = 0;\n"
+                                                        "};\n"
+                                                        "struct Diamond : Left, Right\n"
+                                                        "{\n"
+                                                        "};\n",
+                                 .class_name = "Diamond",
+                                 .expected_result = {"void run() override;",
+                                                     "void left() override;",
+                                                     "void right() override;"}},
+            SingleHeaderTestData{.description = "Emits once the pure virtual functions of a repeated non-virtual base",
+                                 .header_file_content = "struct Root\n"
+                                                        "{\n"
+                                                        "    virtual void run() = 0;\n"
+                                                        "    virtual ~Root() = default;\n"
+                                                        "};\n"
+                                                        "struct Left : Root\n"
+                                                        "{\n"
+                                                        "};\n"
+                                                        "struct Right : Root\n"
+                                                        "{\n"
+                                                        "};\n"
+                                                        "struct Diamond : Left, Right\n"
+                                                        "{\n"
+                                                        "};\n",
+                                 .class_name = "Diamond",
+                                 .expected_result = {"void run() override;"}},
         }));
 
         INFO(description);
@@ -312,3 +375,43 @@ TEST_CASE("Extracts pure virtual functions from abstract class and converts them
         }
     }
 }
+
+TEST_CASE("Extracts pure virtual functions, which are not overridden by the implementor yet",
+          "[PureVirtualFunctionsExtractor]")
+{
+    using namespace Tsepepe;
+    using namespace PureVirtualFunctionsExtractorTest;
+
+    GIVEN("An interface, an intermediate class overriding one function, and an implementor overriding another one")
+    {
+        std::string header_file_content{"struct Interface\n"
+                                        "{\n"
+                                        "    virtual void run() = 0;\n"
+                                        "    virtual int stop(unsigned timeout) = 0;\n"
+                                        "    virtual void reset() = 0;\n"
+                                        "    virtual ~Interface() = default;\n"
+                                        "};\n"
+                                        "struct Intermediate : Interface\n"
+                                        "{\n"
+                                        "    void run() override {}\n"
+                                        "};\n"
+                                        "struct Implementor : Intermediate\n"
+                                        "{\n"
+                                        "    void reset() override;\n"
+                                        "};\n"};
+
+        WHEN("The missing override declarations are collected")
+        {
+            ClangSingleAstFixture fixture{header_file_content};
+            auto iface{fixture.get_first_match<CXXRecordDecl>(make_class_matcher("Interface"))};
+            auto implementor{fixture.get_first_match<CXXRecordDecl>(make_class_matcher("Implementor"))};
+            auto result{missing_override_declarations(iface, implementor, fixture.get_source_manager())};
+
+            THEN("Only the functions without a non-pure overrider are collected")
+            {
+                REQUIRE_THAT(result,
+                             Catch::Matchers::Equals(OverrideDeclarations{"int stop(unsigned int timeout) override;"}));
+            }
+        }
+    }
+}
@@ -0,0 +1,142 @@
+/**
+ * @file        test_sharded_class_index.cpp
+ * @brief       Tests the sharded class index.
+ */
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "directory_tree.hpp"
+#include "sharded_class_index.hpp"
+
+#include "clang_ast_fixtures.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+static std::vector<std::string> get_qualified_names(const ClassIndex& class_index)
+{
+    std::vector<std::string> result;
+    for (const auto& indexed_class : class_index.classes)
+        result.push_back(indexed_class.qualified_name);
+    return result;
+}
+
+static std::size_t count_shard_cache_files(const fs::path& cache_directory)
+{
+    if (not fs::exists(cache_directory))
+        return 0;
+    return std::ranges::count_if(fs::directory_iterator{cache_directory}, [](const fs::directory_entry& entry) {
+        return entry.path().extension() == ".json";
+    });
+}
+
+TEST_CASE("Indexes the shards of the project on demand", "[ShardedClassIndex]")
+{
+    DirectoryTree directory_tree{"temp"};
+    auto working_root_dir{fs::weakly_canonical(directory_tree.get_root_absolute_path())};
+
+    GIVEN("A project with a shared header, and the sources within nested subtrees, and outside of them")
+    {
+        directory_tree.create_file("shape.hpp", "struct Shape { virtual void draw() = 0; };\n");
+        auto gui_source{fs::weakly_canonical(directory_tree.create_file("app/gui/button.cpp",
+                                                                        "#include \"../../shape.hpp\"\n"
+                                                                        "struct Button : Shape\n"
+                                                                        "{\n"
+                                                                        "    void draw() override {}\n"
+                                                                        "};\n"))};
+        auto app_source{fs::weakly_canonical(directory_tree.create_file("app/core/circle.cpp",
+                                                                        "#include \"../../shape.hpp\"\n"
+                                                                        "struct Circle : Shape\n"
+                                                                        "{\n"
+                                                                        "    void draw() override {}\n"
+                                                                        "};\n"))};
+        auto tool_source{fs::weakly_canonical(directory_tree.create_file("tools/generator.cpp",
+                                                                         "struct Generator {};\n"))};
+
+        auto cache_directory{working_root_dir / ".cache"};
+        ShardedClassIndex sharded_index{
+            make_compilation_database(working_root_dir, {gui_source, app_source, tool_source}),
+            {.root_directory = working_root_dir,
+             .cache_directory = cache_directory,
+             .shard_directories = {working_root_dir / "app", working_root_dir / "app" / "gui"}}};
+
+        auto app_shard{sharded_index.find_shard(working_root_dir / "app")};
+        auto gui_shard{sharded_index.find_shard(gui_source)};
+        auto rest_shard{sharded_index.find_shard(tool_source)};
+
+        THEN("Each file belongs to the shard of the deepest directory containing it, or to the rest of the project")
+        {
+            REQUIRE(sharded_index.get_shards_count() == 3);
+            REQUIRE(sharded_index.find_shard(app_source) == app_shard);
+            REQUIRE(gui_shard != app_shard);
+            REQUIRE(rest_shard == sharded_index.get_shards_count() - 1);
+        }
+
+        THEN("No shard is indexed until accessed")
+        {
+            REQUIRE(count_shard_cache_files(cache_directory) == 0);
+        }
+
+        WHEN("A shard is accessed")
+        {
+            const auto& app_index{sharded_index.get_shard(app_shard)};
+
+            THEN("Only its translation units are scanned, together with the headers they include")
+            {
+                REQUIRE(get_qualified_names(app_index) == std::vector<std::string>{"Circle", "Shape"});
+                REQUIRE(app_index.translation_unit_files.size() == 1);
+            }
+
+            THEN("Only that shard is cached")
+            {
+                REQUIRE(count_shard_cache_files(cache_directory) == 1);
+            }
+
+            AND_WHEN("It is accessed again")
+            {
+                THEN("The shard already indexed is given")
+                {
+                    REQUIRE(&sharded_index.get_shard(app_shard) == &app_index);
+                }
+            }
+        }
+
+        WHEN("The shards are merged")
+        {
+            std::vector<ShardedClassIndex::ShardId> shard_ids{app_shard, gui_shard};
+            auto merged_index{sharded_index.merge(shard_ids)};
+
+            THEN("The classes of all the shards are present, the ones seen by many shards once")
+            {
+                REQUIRE(get_qualified_names(merged_index) == std::vector<std::string>{"Button", "Circle", "Shape"});
+                REQUIRE(merged_index.translation_unit_files.size() == 2);
+            }
+
+            THEN("The shard, which has not been merged, is not indexed")
+            {
+                REQUIRE(count_shard_cache_files(cache_directory) == 2);
+            }
+        }
+
+        WHEN("The project is indexed again by another sharded index, having the same shards")
+        {
+            sharded_index.get_shard(rest_shard);
+            ShardedClassIndex other_sharded_index{
+                make_compilation_database(working_root_dir, {gui_source, app_source, tool_source}),
+                {.root_directory = working_root_dir,
+                 .cache_directory = cache_directory,
+                 .shard_directories = {working_root_dir / "app" / "gui", working_root_dir / "app"}}};
+
+            THEN("The cached shards are reused, whatever the order of the shard directories")
+            {
+                REQUIRE(get_qualified_names(other_sharded_index.get_shard(other_sharded_index.find_shard(tool_source)))
+                        == std::vector<std::string>{"Generator"});
+                REQUIRE(count_shard_cache_files(cache_directory) == 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file        test_source_file_content.cpp
+ * @brief       Tests the SourceFileContent.
+ */
+#include <filesystem>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "base_error.hpp"
+#include "directory_tree.hpp"
+#include "source_file_content.hpp"
+
+using namespace Tsepepe;
+namespace fs = std::filesystem;
+
+TEST_CASE("Keeps the content of the edited file within a single buffer", "[SourceFileContent]")
+{
+    DirectoryTree directory_tree{"temp"};
+
+    GIVEN("A content made from a string")
+    {
+        std::string text{"struct Implementor {};\n"};
+        SourceFileContent content{text};
+
+        THEN("The view and the reference show the same characters, followed by a null character")
+        {
+            REQUIRE(content.view() == text);
+            REQUIRE(content.get_ref() == text);
+            REQUIRE(content.view().data() == content.get_ref().data());
+            REQUIRE(content.view().data()[content.view().size()] == '\0');
+        }
+
+        WHEN("The content is copied")
+        {
+            auto content_copy{content};
+
+            THEN("The copy shares the buffer")
+            {
+                REQUIRE(content_copy.view().data() == content.view().data());
+            }
+        }
+    }
+
+    GIVEN("A default constructed content")
+    {
+        SourceFileContent content;
+
+        THEN("It is empty, and null terminated")
+        {
+            REQUIRE(content.view().empty());
+            REQUIRE(content.view().data()[0] == '\0');
+        }
+    }
+
+    GIVEN("A file bigger than a page")
+    {
+        std::string text(64 * 1024, 'x');
+        auto file_path{directory_tree.create_file("big.hpp", text)};
+
+        WHEN("The content is read from the file")
+        {
+            auto content{SourceFileContent::from_file(file_path)};
+
+            THEN("It is the content of the file")
+            {
+                REQUIRE(content.view() == text);
+            }
+        }
+    }
+
+    GIVEN("A path to a missing file")
+    {
+        auto file_path{directory_tree.get_root_absolute_path() / "missing.hpp"};
+
+        THEN("Reading it throws")
+        {
+            REQUIRE_THROWS_AS(SourceFileContent::from_file(file_path), BaseError);
+        }
+    }
+
+    GIVEN("A path to a file, and a path to a directory")
+    {
+        auto file_path{directory_tree.get_root_absolute_path() / "src" / "implementor.hpp"};
+        auto directory_path{directory_tree.get_root_absolute_path()};
+
+        THEN("The virtual file is placed next to the file, or within the directory, and nothing is written")
+        {
+            REQUIRE(make_virtual_source_file_path(file_path, "implementor")
+                    == directory_tree.get_root_absolute_path() / "src" / ".tsepepe_implementor.hpp");
+            REQUIRE(make_virtual_source_file_path(directory_path, "implementor")
+                    == directory_tree.get_root_absolute_path() / ".tsepepe_implementor_temp.hpp");
+            REQUIRE(not fs::exists(make_virtual_source_file_path(directory_path, "implementor")));
+        }
+    }
+}
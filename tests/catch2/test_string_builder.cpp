@@ -0,0 +1,70 @@
+/**
+ * @file        test_string_builder.cpp
+ * @brief       Tests the string builder, and the joining built on top of it.
+ */
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "string_builder.hpp"
+#include "string_utils.hpp"
+
+using namespace Tsepepe;
+
+TEST_CASE("Pieces of the code are appended", "[StringBuilder]")
+{
+    SECTION("Appends the pieces as they are")
+    {
+        StringBuilder builder;
+        builder.append("void").append(' ').append(std::string{"foo"}).append("();");
+        REQUIRE(builder.view() == "void foo();");
+    }
+
+    SECTION("Separates the words with a space, skipping the empty ones")
+    {
+        StringBuilder builder;
+        builder.append_word("").append_word("int").append_word("").append_word("foo()").append_word("const");
+        REQUIRE(builder.view() == "int foo() const");
+    }
+
+    SECTION("Appends the joined pieces after the existing content")
+    {
+        std::vector<std::string> params{"int a", "char b"};
+        StringBuilder builder;
+        builder.append("foo(").append_joined(std::begin(params), std::end(params), ", ").append(')');
+        REQUIRE(builder.view() == "foo(int a, char b)");
+    }
+
+    SECTION("Appends the terminator after each of the joined pieces")
+    {
+        std::vector<std::string> declarations{"void foo()", "void bar()"};
+        StringBuilder builder;
+        builder.append_joined(std::begin(declarations), std::end(declarations), "\n", "\n{\n}\n");
+        REQUIRE(builder.view() == "void foo()\n{\n}\n\nvoid bar()\n{\n}\n");
+    }
+
+    SECTION("Appends nothing, when there is nothing to join")
+    {
+        std::vector<std::string> declarations;
+        StringBuilder builder;
+        builder.append_joined(std::begin(declarations), std::end(declarations), "\n", "\n{\n}\n");
+        REQUIRE(builder.empty());
+    }
+
+    SECTION("Leaves the builder empty, when the string is taken")
+    {
+        StringBuilder builder;
+        builder.append("struct Circle;");
+        REQUIRE(builder.take() == "struct Circle;");
+        REQUIRE(builder.empty());
+    }
+}
+
+TEST_CASE("Strings are joined", "[StringUtils]")
+{
+    REQUIRE(utils::join({}) == "");
+    REQUIRE(utils::join({"int"}) == "int");
+    REQUIRE(utils::join({"int", "char", "double"}) == "int, char, double");
+    REQUIRE(utils::join({"Shape", "Drawable"}, "|") == "Shape|Drawable");
+}
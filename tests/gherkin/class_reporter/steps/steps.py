@@ -0,0 +1,44 @@
+import json
+import os
+import subprocess
+from helpers.tool_result import ToolResult
+from hamcrest import assert_that, equal_to, empty, starts_with
+import helpers.utils as utils
+
+
+@given("Source file with content")
+def step_impl(context):
+    # The content is passed to the tool directly, so the file does not need to exist.
+    context.source_file_content = context.text + "\n"
+
+
+@when('Classes "{class_names}" are reported')
+def step_impl(context, class_names: str):
+    source_path = os.path.join(context.working_directory, "source.hpp")
+    tool_path = utils.get_tool_path(context)
+    comp_db_dir = context.working_directory
+    cmd = [
+        tool_path,
+        comp_db_dir,
+        source_path,
+        context.source_file_content,
+    ] + class_names.split(",")
+    cmd_result = subprocess.run(cmd, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@then("The JSON result is")
+def step_impl(context):
+    result = utils.get_result(context)
+    assert_that(json.loads(result.stdout), equal_to(json.loads(context.text)))
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
@@ -0,0 +1,63 @@
+Feature: Reports all the class facts from a single parse
+
+  Background:
+
+    Given Source file with content
+      """
+      namespace Shapes
+      {
+      struct Drawable
+      {
+          virtual ~Drawable() = default;
+          virtual void draw() const = 0;
+      };
+
+      class Square : public Drawable
+      {
+          int side;
+
+        public:
+          void draw() const override;
+      };
+
+      class Hidden
+      {
+          int value;
+      };
+      } // namespace Shapes
+      """
+
+  Scenario: Reports many classes at once, skipping the ones which do not exist
+
+    When Classes "Drawable,Square,Hidden,Missing" are reported
+    Then The JSON result is
+      """
+      {
+        "Drawable": {
+          "qualified_name": "Shapes::Drawable",
+          "is_abstract": true,
+          "bases": [],
+          "pure_virtual_override_declarations": ["void draw() const override;"],
+          "suitable_public_method_place": {"offset": 107, "is_public_section_needed": false}
+        },
+        "Square": {
+          "qualified_name": "Shapes::Square",
+          "is_abstract": false,
+          "bases": ["Shapes::Drawable"],
+          "pure_virtual_override_declarations": [],
+          "suitable_public_method_place": {"offset": 201, "is_public_section_needed": false}
+        },
+        "Hidden": {
+          "qualified_name": "Shapes::Hidden",
+          "is_abstract": false,
+          "bases": [],
+          "pure_virtual_override_declarations": [],
+          "suitable_public_method_place": {"offset": 220, "is_public_section_needed": true}
+        }
+      }
+      """
+
+  Scenario: Fails when none of the classes exists
+
+    When Classes "Missing,Unknown" are reported
+    Then Error is raised with return code 1
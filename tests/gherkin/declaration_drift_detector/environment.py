@@ -0,0 +1,13 @@
+import os
+import shutil
+
+
+def before_scenario(context, scenario):
+    # The tool reports the canonical paths.
+    context.working_directory = os.path.realpath(os.path.join(os.getcwd(), "temp"))
+    os.mkdir(context.working_directory)
+    context.translation_units = list()
+
+
+def after_scenario(context, scenario):
+    shutil.rmtree(context.working_directory)
@@ -0,0 +1,69 @@
+import json
+import os
+import subprocess
+from helpers.compilation_database import CompilationDatabase
+from helpers.file import File
+from helpers.tool_result import ToolResult
+from hamcrest import assert_that, equal_to, empty, starts_with
+import helpers.utils as utils
+
+
+@given('Header file with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text + "\n").create()
+
+
+@given('Translation unit with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text + "\n").create()
+    context.translation_units.append(path)
+
+
+def run_tool(context, root_dir: str):
+    CompilationDatabase(context.working_directory).create_for_translation_units(
+        context.translation_units
+    )
+    tool_path = utils.get_tool_path(context)
+    cmd = [tool_path, context.working_directory, root_dir]
+    cmd_result = subprocess.run(cmd, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@when("The project is scanned for the declaration drift")
+def step_impl(context):
+    run_tool(context, context.working_directory)
+
+
+@when('The nonexistent directory "{directory}" is scanned for the declaration drift')
+def step_impl(context, directory: str):
+    run_tool(context, os.path.join(context.working_directory, directory))
+
+
+@then("The report is")
+def step_impl(context):
+    # The "<ROOT>" placeholder stands for the project root directory.
+    expected = json.loads(context.text.replace("<ROOT>", context.working_directory))
+    report = json.loads(utils.get_result(context).stdout)
+    assert_that(report, equal_to(expected))
+
+
+@then("The return code is {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+
+
+@then("No errors are emitted")
+def step_impl(context):
+    assert_that(utils.get_result(context).stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
@@ -0,0 +1,96 @@
+Feature: Detects the drift between the function declarations and definitions
+
+  Background:
+
+    Given Header file with name "compute.hpp" and content
+      """
+      struct Calculator
+      {
+          int add(int lhs, int rhs);
+          void reset();
+          int inlined() { return 0; }
+      };
+      int compute(int value);
+      """
+
+  Scenario: Reports no drift, when all the declarations are defined
+
+    Given Translation unit with name "compute.cpp" and content
+      """
+      #include "compute.hpp"
+
+      int Calculator::add(int lhs, int rhs)
+      {
+          return lhs + rhs;
+      }
+
+      void Calculator::reset()
+      {
+      }
+
+      int compute(int value)
+      {
+          return value;
+      }
+      """
+    When The project is scanned for the declaration drift
+    Then The report is
+      """
+      {
+        "undefined_declarations": [],
+        "signature_mismatches": []
+      }
+      """
+    And The return code is 0
+    And No errors are emitted
+
+  Scenario: Reports the undefined declarations and the signature mismatches
+
+    Given Translation unit with name "compute.cpp" and content
+      """
+      #include "compute.hpp"
+
+      int Calculator::add(int lhs, int rhs)
+      {
+          return lhs + rhs;
+      }
+
+      int compute(long value)
+      {
+          return 0;
+      }
+      """
+    When The project is scanned for the declaration drift
+    Then The report is
+      """
+      {
+        "undefined_declarations": [
+          {
+            "expected_definition": "void Calculator::reset()",
+            "declaration_file": "<ROOT>/compute.hpp",
+            "declaration_line": 4
+          }
+        ],
+        "signature_mismatches": [
+          {
+            "expected_definition": "int compute(int value)",
+            "declaration_file": "<ROOT>/compute.hpp",
+            "declaration_line": 7,
+            "actual_definition": "int compute(long value)",
+            "definition_file": "<ROOT>/compute.cpp",
+            "definition_line": 8
+          }
+        ]
+      }
+      """
+    And The return code is 2
+    And No errors are emitted
+
+  Scenario: Fails when the root directory does not exist
+
+    Given Translation unit with name "compute.cpp" and content
+      """
+      #include "compute.hpp"
+      """
+    When The nonexistent directory "nonexistent" is scanned for the declaration drift
+    Then Error is raised with return code 1
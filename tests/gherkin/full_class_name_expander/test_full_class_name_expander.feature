@@ -46,3 +46,58 @@ Feature: Expands the class name to a fully qualified name
         """
         When Class name "Record" is expanded
         Then The result is "Namespace::Basta::Record"
+
+    Scenario: For many classes at once
+        Given Header file with content
+        """
+        namespace Namespace {
+        struct Basta
+        {
+            struct Record
+            {
+            };
+        };
+        }
+        class Yolo
+        {
+        };
+        """
+        When Class names "Record,Yolo" are expanded
+        Then The JSON result is
+        """
+        {
+          "Record": "Namespace::Basta::Record",
+          "Yolo": "Yolo"
+        }
+        """
+
+    Scenario: For all the classes defined within the header
+        Given Header file with content
+        """
+        namespace Namespace {
+        struct Basta
+        {
+            struct Record
+            {
+            };
+        };
+        }
+        """
+        When All the classes are expanded
+        Then The JSON result is
+        """
+        {
+          "Namespace::Basta": "Namespace::Basta",
+          "Namespace::Basta::Record": "Namespace::Basta::Record"
+        }
+        """
+
+    Scenario: For an unknown class
+        Given Header file with content
+        """
+        class Yolo
+        {
+        };
+        """
+        When Class name "Unknown" is expanded
+        Then Error is raised with return code 1
@@ -1,3 +1,4 @@
+import json
 import os
 import subprocess
 
@@ -24,6 +25,18 @@ class CompilationDatabase:
         executable_path = os.path.join(os.getcwd(), "dummy")
         os.remove(executable_path)
 
+    def create_for_translation_units(self, translation_unit_paths: list):
+        commands = [
+            {
+                "directory": self.path,
+                "file": path,
+                "arguments": ["g++", "-std=c++20", "-c", path],
+            }
+            for path in translation_unit_paths
+        ]
+        with open(self._comp_db_path, "w") as f:
+            json.dump(commands, f, indent=2)
+
     def remove(self):
         if os.path.exists(self._comp_db_path):
             os.remove(self._comp_db_path)
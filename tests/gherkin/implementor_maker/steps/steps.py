@@ -0,0 +1,62 @@
+import os
+import subprocess
+from helpers.file import File
+from helpers.tool_result import ToolResult
+from hamcrest import assert_that, equal_to, empty, not_, starts_with
+import helpers.utils as utils
+
+
+@given('Header file with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text).create()
+
+
+@given("Class definition")
+def step_impl(context):
+    context.class_definition = context.text
+
+
+@when(
+    'Interfaces "{interface_names}" are implemented by the class defined at line '
+    "{line}"
+)
+def step_impl(context, interface_names: str, line: str):
+    source_file_path = os.path.join(context.working_directory, "implementor.hpp")
+    tool_path = utils.get_tool_path(context)
+    comp_db_dir = context.working_directory
+    root_dir = context.working_directory
+    cmd = [
+        tool_path,
+        comp_db_dir,
+        root_dir,
+        source_file_path,
+        context.class_definition,
+        interface_names,
+        line,
+    ]
+    cmd_result = subprocess.run(cmd, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@then("Stdout contains")
+def step_impl(context):
+    stdout = utils.get_result(context).stdout.rstrip()
+    assert_that(stdout, equal_to(context.text))
+
+
+@then("No errors are emitted")
+def step_impl(context):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
+    assert_that(result.stdout, empty())
@@ -0,0 +1,96 @@
+Feature: Makes a class implement the interfaces
+
+  Scenario: Implements a single interface
+
+    Given Header file with name "runnable.hpp" and content
+      """
+      struct Runnable
+      {
+          virtual void run() = 0;
+          virtual ~Runnable() = default;
+      };
+      """
+    And Class definition
+      """
+      struct Maker
+      {
+      };
+      """
+    When Interfaces "Runnable" are implemented by the class defined at line 2
+    Then Stdout contains
+      """
+      #include "runnable.hpp"
+      struct Maker : Runnable
+      {
+          void run() override;
+      };
+      """
+    And No errors are emitted
+
+  Scenario: Implements a comma-separated list of interfaces at once
+
+    Given Header file with name "runnable.hpp" and content
+      """
+      struct Runnable
+      {
+          virtual void run() = 0;
+          virtual int stop(unsigned timeout_ms) = 0;
+      };
+      """
+    And Header file with name "stoppable.hpp" and content
+      """
+      struct Stoppable
+      {
+          virtual int stop(unsigned timeout_ms) = 0;
+          virtual void reset() = 0;
+      };
+      """
+    And Class definition
+      """
+      class Maker
+      {
+      };
+      """
+    When Interfaces "Runnable,Stoppable,Runnable" are implemented by the class defined at line 2
+    Then Stdout contains
+      """
+      #include "runnable.hpp"
+      #include "stoppable.hpp"
+      class Maker : public Runnable, public Stoppable
+      {
+      public:
+          void run() override;
+          int stop(unsigned int timeout_ms) override;
+          void reset() override;
+      };
+      """
+    And No errors are emitted
+
+  Scenario: Fails when one of the interfaces is not found
+
+    Given Header file with name "runnable.hpp" and content
+      """
+      struct Runnable
+      {
+          virtual void run() = 0;
+      };
+      """
+    And Class definition
+      """
+      struct Maker
+      {
+      };
+      """
+    When Interfaces "Runnable,Unknown" are implemented by the class defined at line 2
+    Then Error is raised with return code 1
+
+  Scenario: Fails when the interface list is empty
+
+    Given Class definition
+      """
+      struct Maker
+      {
+      };
+      """
+    When Interfaces "," are implemented by the class defined at line 2
+    Then Error is raised with return code 1
@@ -0,0 +1,54 @@
+import json
+import os
+import subprocess
+from helpers.compilation_database import CompilationDatabase
+from helpers.tool_result import ToolResult
+from hamcrest import assert_that, equal_to, empty, starts_with
+import helpers.utils as utils
+
+
+@given('Header file with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    utils.create_file(path, context.text + "\n")
+
+
+@given('Translation unit with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    utils.create_file(path, context.text + "\n")
+    context.translation_units.append(path)
+
+
+@when('The include of "{header}" within "{includer}" is resolved')
+def step_impl(context, header: str, includer: str):
+    CompilationDatabase(context.working_directory).create_for_translation_units(
+        context.translation_units
+    )
+    tool_path = utils.get_tool_path(context)
+    cmd = [
+        tool_path,
+        context.working_directory,
+        context.working_directory,
+        os.path.join(context.working_directory, includer),
+        os.path.join(context.working_directory, header),
+    ]
+    cmd_result = subprocess.run(cmd, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@then("The result is")
+def step_impl(context):
+    result = utils.get_result(context)
+    assert_that(json.loads(result.stdout), equal_to(json.loads(context.text)))
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
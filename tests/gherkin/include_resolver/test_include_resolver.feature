@@ -0,0 +1,55 @@
+Feature: Resolves the include directive spelling of a header, and whether it is included already
+
+  Background:
+
+    Given Header file with name "src/detail/local.hpp" and content
+      """
+      struct Local
+      {
+      };
+      """
+    And Header file with name "src/detail/other.hpp" and content
+      """
+      struct Other
+      {
+      };
+      """
+    And Header file with name "include/gui/drawable.hpp" and content
+      """
+      struct Drawable
+      {
+      };
+      """
+    And Translation unit with name "src/main.cpp" and content
+      """
+      #include "detail/local.hpp"
+      """
+
+  Scenario: Resolves a header included already
+
+    When The include of "src/detail/local.hpp" within "src/main.cpp" is resolved
+    Then The result is
+      """
+      {"include_path": "\"detail/local.hpp\"", "is_included": true}
+      """
+
+  Scenario: Resolves a header not included yet
+
+    When The include of "src/detail/other.hpp" within "src/main.cpp" is resolved
+    Then The result is
+      """
+      {"include_path": "\"detail/other.hpp\"", "is_included": false}
+      """
+
+  Scenario: Gives no spelling for a header outside of the include search paths
+
+    When The include of "include/gui/drawable.hpp" within "src/main.cpp" is resolved
+    Then The result is
+      """
+      {"include_path": null, "is_included": false}
+      """
+
+  Scenario: Fails when the header does not exist
+
+    When The include of "src/detail/missing.hpp" within "src/main.cpp" is resolved
+    Then Error is raised with return code 1
@@ -0,0 +1,67 @@
+import json
+import os
+import subprocess
+from helpers.compilation_database import CompilationDatabase
+from helpers.file import File
+from helpers.tool_result import ToolResult
+from hamcrest import assert_that, equal_to, empty, starts_with
+import helpers.utils as utils
+
+
+@given('Header file with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text + "\n").create()
+
+
+@given('Translation unit with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text + "\n").create()
+    context.translation_units.append(path)
+
+
+def run_tool(context, arguments: list):
+    CompilationDatabase(context.working_directory).create_for_translation_units(
+        context.translation_units
+    )
+    tool_path = utils.get_tool_path(context)
+    cmd = [tool_path, context.working_directory, context.working_directory]
+    cmd_result = subprocess.run(cmd + arguments, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@when('The inheritance graph is queried for the "{query}" of "{name}"')
+def step_impl(context, query: str, name: str):
+    run_tool(context, [query, name])
+
+
+@when("The inheritance graph is queried for all the abstract classes")
+def step_impl(context):
+    run_tool(context, ["abstract", ""])
+
+
+@when('The inheritance graph is queried with the arguments "{arguments}"')
+def step_impl(context, arguments: str):
+    run_tool(context, arguments.split())
+
+
+@then("The classes found are")
+def step_impl(context):
+    # The "<ROOT>" placeholder stands for the project root directory.
+    expected = json.loads(context.text.replace("<ROOT>", context.working_directory))
+    result = utils.get_result(context)
+    found = json.loads(result.stdout)
+    by_name = lambda found_class: found_class["qualified_name"]
+    assert_that(sorted(found, key=by_name), equal_to(sorted(expected, key=by_name)))
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
@@ -0,0 +1,97 @@
+Feature: Queries the inheritance graph of the project classes
+
+  Background:
+
+    Given Header file with name "shapes.hpp" and content
+      """
+      namespace Shapes {
+      struct Shape
+      {
+          virtual double area() const = 0;
+      };
+      struct Circle : Shape
+      {
+          double area() const override;
+      };
+      struct PrintableShape : Shape
+      {
+          virtual void print() = 0;
+      };
+      struct Square : PrintableShape
+      {
+          double area() const override;
+          void print() override;
+      };
+      }
+      """
+    And Translation unit with name "shapes.cpp" and content
+      """
+      #include "shapes.hpp"
+      """
+
+  Scenario: Finds the implementors of an interface
+
+    When The inheritance graph is queried for the "implementors" of "Shape"
+    Then The classes found are
+      """
+      [
+        {
+          "qualified_name": "Shapes::Circle",
+          "is_abstract": false,
+          "locations": [{"file": "<ROOT>/shapes.hpp", "line": 6}]
+        },
+        {
+          "qualified_name": "Shapes::Square",
+          "is_abstract": false,
+          "locations": [{"file": "<ROOT>/shapes.hpp", "line": 14}]
+        }
+      ]
+      """
+
+  Scenario: Finds the interfaces of a class
+
+    When The inheritance graph is queried for the "interfaces" of "Square"
+    Then The classes found are
+      """
+      [
+        {
+          "qualified_name": "Shapes::PrintableShape",
+          "is_abstract": true,
+          "locations": [{"file": "<ROOT>/shapes.hpp", "line": 10}]
+        },
+        {
+          "qualified_name": "Shapes::Shape",
+          "is_abstract": true,
+          "locations": [{"file": "<ROOT>/shapes.hpp", "line": 2}]
+        }
+      ]
+      """
+
+  Scenario: Finds all the abstract classes
+
+    When The inheritance graph is queried for all the abstract classes
+    Then The classes found are
+      """
+      [
+        {
+          "qualified_name": "Shapes::PrintableShape",
+          "is_abstract": true,
+          "locations": [{"file": "<ROOT>/shapes.hpp", "line": 10}]
+        },
+        {
+          "qualified_name": "Shapes::Shape",
+          "is_abstract": true,
+          "locations": [{"file": "<ROOT>/shapes.hpp", "line": 2}]
+        }
+      ]
+      """
+
+  Scenario: Fails on an unknown query
+
+    When The inheritance graph is queried for the "siblings" of "Shape"
+    Then Error is raised with return code 1
+
+  Scenario: Fails on an unknown option
+
+    When The inheritance graph is queried with the arguments "implementors Shape --unknown"
+    Then Error is raised with return code 1
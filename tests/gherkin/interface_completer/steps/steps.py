@@ -0,0 +1,82 @@
+import json
+import os
+import subprocess
+from helpers.compilation_database import CompilationDatabase
+from helpers.file import File
+from helpers.tool_result import ToolResult
+from hamcrest import assert_that, equal_to, empty, has_length, starts_with
+import helpers.utils as utils
+
+
+@given('Header file with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    utils.create_file(path, context.text + "\n")
+
+
+@given('Translation unit with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text + "\n").create()
+    context.translation_units.append(path)
+
+
+def run_tool(context, pattern: str, options: list):
+    CompilationDatabase(context.working_directory).create_for_translation_units(
+        context.translation_units
+    )
+    tool_path = utils.get_tool_path(context)
+    current_file = os.path.join(context.working_directory, "main.cpp")
+    cmd = [
+        tool_path,
+        context.working_directory,
+        context.working_directory,
+        current_file,
+        pattern,
+    ]
+    cmd_result = subprocess.run(cmd + options, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@when('Interface names are completed for the pattern "{pattern}"')
+def step_impl(context, pattern: str):
+    run_tool(context, pattern, [])
+
+
+@when('Interface names are completed for the pattern "{pattern}" with "{options}"')
+def step_impl(context, pattern: str, options: str):
+    run_tool(context, pattern, options.split())
+
+
+@then("The candidates are")
+def step_impl(context):
+    result = utils.get_result(context)
+    candidates = json.loads(result.stdout)
+    expected = [
+        {
+            "qualified_name": row["qualified_name"],
+            "file": os.path.join(context.working_directory, row["file"]),
+            "line": int(row["line"]),
+        }
+        for row in context.table
+    ]
+    by_name = lambda candidate: candidate["qualified_name"]
+    assert_that(sorted(candidates, key=by_name), equal_to(sorted(expected, key=by_name)))
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("{count:d} candidate is returned")
+def step_impl(context, count: int):
+    result = utils.get_result(context)
+    assert_that(json.loads(result.stdout), has_length(count))
+    assert_that(result.return_code, equal_to(0))
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
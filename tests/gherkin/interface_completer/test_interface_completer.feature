@@ -0,0 +1,58 @@
+Feature: Completes the names of the project interfaces
+
+  Background:
+
+    Given Header file with name "include/drawable.hpp" and content
+      """
+      namespace Graphics {
+      struct Drawable
+      {
+          virtual void draw() = 0;
+      };
+      struct DrawableText : Drawable
+      {
+          virtual void set_text() = 0;
+      };
+      struct Sprite : Drawable
+      {
+          void draw() override;
+      };
+      }
+      """
+    And Header file with name "include/runnable.hpp" and content
+      """
+      struct Runnable
+      {
+          virtual void run() = 0;
+      };
+      """
+    And Translation unit with name "main.cpp" and content
+      """
+      #include "include/drawable.hpp"
+      #include "include/runnable.hpp"
+      """
+
+  Scenario: Completes the interface names starting with the prefix
+
+    When Interface names are completed for the pattern "Draw"
+    Then The candidates are
+      | qualified_name         | file                 | line |
+      | Graphics::Drawable     | include/drawable.hpp | 2    |
+      | Graphics::DrawableText | include/drawable.hpp | 6    |
+
+  Scenario: Completes the interface names matching the fuzzy pattern
+
+    When Interface names are completed for the pattern "rnb" with "--fuzzy"
+    Then The candidates are
+      | qualified_name | file                 | line |
+      | Runnable       | include/runnable.hpp | 1    |
+
+  Scenario: Limits the number of the candidates
+
+    When Interface names are completed for the pattern "Draw" with "--max-results 1"
+    Then 1 candidate is returned
+
+  Scenario: Fails on an unknown option
+
+    When Interface names are completed for the pattern "Draw" with "--unknown"
+    Then Error is raised with return code 1
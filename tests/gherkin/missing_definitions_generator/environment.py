@@ -0,0 +1,14 @@
+import os
+import shutil
+from helpers.compilation_database import CompilationDatabase
+
+
+def before_scenario(context, scenario):
+    # The tool reports the canonical paths.
+    context.working_directory = os.path.realpath(os.path.join(os.getcwd(), "temp"))
+    os.mkdir(context.working_directory)
+    CompilationDatabase(context.working_directory).create()
+
+
+def after_scenario(context, scenario):
+    shutil.rmtree(context.working_directory)
@@ -0,0 +1,58 @@
+import json
+import os
+import subprocess
+from hamcrest import assert_that, equal_to, empty, starts_with
+from helpers.tool_result import ToolResult
+import helpers.utils as utils
+
+
+@given('File with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    utils.create_file(path, context.text + "\n")
+
+
+@when('Missing definitions are generated for headers "{header_names}"')
+def step_impl(context, header_names: str):
+    tool_path = utils.get_tool_path(context)
+    comp_db_dir = context.working_directory
+    root_dir = context.working_directory
+    header_paths = [
+        os.path.join(context.working_directory, name)
+        for name in header_names.split(",")
+    ]
+    cmd = [tool_path, comp_db_dir, root_dir] + header_paths
+    cmd_result = subprocess.run(cmd, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@then("Files are edited")
+def step_impl(context):
+    result = json.loads(utils.get_result(context).stdout)
+    expected_paths = [
+        os.path.join(context.working_directory, row["file"]) for row in context.table
+    ]
+    assert_that(sorted(result.keys()), equal_to(sorted(expected_paths)))
+
+
+@then('File "{file_name}" gets new content')
+def step_impl(context, file_name: str):
+    result = json.loads(utils.get_result(context).stdout)
+    path = os.path.join(context.working_directory, file_name)
+    assert_that(result[path], equal_to(context.text + "\n"))
+
+
+@then("No errors are emitted")
+def step_impl(context):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
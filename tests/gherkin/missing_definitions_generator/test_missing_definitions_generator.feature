@@ -0,0 +1,68 @@
+Feature: Generates the definitions of all the undefined functions declared within the headers
+
+  Scenario: Appends the definitions to the paired source, or creates a new one
+
+    Given File with name "include/foo.hpp" and content
+      """
+      struct Foo
+      {
+          Foo() = default;
+          void run();
+          int stop(unsigned timeout);
+          void inlined() {}
+          virtual void pure() = 0;
+      };
+      """
+    And File with name "foo.cpp" and content
+      """
+      #include "include/foo.hpp"
+
+      void Foo::run()
+      {
+      }
+      """
+    And File with name "include/bar.hpp" and content
+      """
+      struct Bar
+      {
+          void baz();
+      };
+      """
+    When Missing definitions are generated for headers "include/foo.hpp,include/bar.hpp"
+    Then Files are edited
+      | file            |
+      | foo.cpp         |
+      | include/bar.cpp |
+    And File "foo.cpp" gets new content
+      """
+      #include "include/foo.hpp"
+
+      void Foo::run()
+      {
+      }
+
+      int Foo::stop(unsigned int timeout)
+      {
+      }
+      """
+    And File "include/bar.cpp" gets new content
+      """
+      #include "bar.hpp"
+
+      void Bar::baz()
+      {
+      }
+      """
+    And No errors are emitted
+
+  Scenario: Fails when a header does not exist
+
+    Given File with name "include/foo.hpp" and content
+      """
+      struct Foo
+      {
+          void run();
+      };
+      """
+    When Missing definitions are generated for headers "include/foo.hpp,include/nonexistent.hpp"
+    Then Error is raised with return code 1
@@ -0,0 +1,83 @@
+import json
+import os
+import subprocess
+from helpers.compilation_database import CompilationDatabase
+from helpers.file import File
+from helpers.tool_result import ToolResult
+from hamcrest import assert_that, equal_to, empty, starts_with
+import helpers.utils as utils
+
+
+@given('Header file with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text).create()
+
+
+@given('Translation unit with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text).create()
+    context.translation_units.append(path)
+
+
+def run_tool(context, root_dir: str, interface_name: str):
+    CompilationDatabase(context.working_directory).create_for_translation_units(
+        context.translation_units
+    )
+    tool_path = utils.get_tool_path(context)
+    cmd = [tool_path, context.working_directory, root_dir, interface_name]
+    cmd_result = subprocess.run(cmd, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@when('Missing overrides are generated for interface "{interface_name}"')
+def step_impl(context, interface_name: str):
+    run_tool(context, context.working_directory, interface_name)
+
+
+@when(
+    'Missing overrides are generated for interface "{interface_name}" '
+    'within nonexistent directory "{directory}"'
+)
+def step_impl(context, interface_name: str, directory: str):
+    root_dir = os.path.join(context.working_directory, directory)
+    run_tool(context, root_dir, interface_name)
+
+
+@then('File "{file_name}" gets new content')
+def step_impl(context, file_name: str):
+    result = json.loads(utils.get_result(context).stdout)
+    path = os.path.join(context.working_directory, file_name)
+    assert_that(result[path], equal_to(context.text))
+
+
+@then("Files are edited")
+def step_impl(context):
+    result = json.loads(utils.get_result(context).stdout)
+    expected_paths = [
+        os.path.join(context.working_directory, row["file"]) for row in context.table
+    ]
+    assert_that(sorted(result.keys()), equal_to(sorted(expected_paths)))
+
+
+@then("No file is edited")
+def step_impl(context):
+    result = json.loads(utils.get_result(context).stdout)
+    assert_that(result, equal_to({}))
+
+
+@then("No errors are emitted")
+def step_impl(context):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
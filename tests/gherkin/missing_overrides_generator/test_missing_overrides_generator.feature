@@ -0,0 +1,90 @@
+Feature: Generates the missing overrides for all the implementors of an interface
+
+  Background:
+
+    Given Header file with name "shape.hpp" and content
+      """
+      struct Shape
+      {
+          virtual double area() const = 0;
+          virtual void draw() = 0;
+      };
+      """
+
+  Scenario: Adds the missing overrides to the incomplete implementors only
+
+    Given Header file with name "circle.hpp" and content
+      """
+      #include "shape.hpp"
+      struct Circle : Shape
+      {
+          double area() const override;
+      };
+      """
+    And Header file with name "dot.hpp" and content
+      """
+      #include "shape.hpp"
+      struct Dot : Shape
+      {
+          double area() const override { return 0.0; }
+          void draw() override {}
+      };
+      """
+    And Translation unit with name "first.cpp" and content
+      """
+      #include "circle.hpp"
+      #include "dot.hpp"
+      """
+    And Translation unit with name "second.cpp" and content
+      """
+      #include "circle.hpp"
+      """
+    When Missing overrides are generated for interface "Shape"
+    Then Files are edited
+      | file       |
+      | circle.hpp |
+    And File "circle.hpp" gets new content
+      """
+      #include "shape.hpp"
+      struct Circle : Shape
+      {
+          double area() const override;
+          void draw() override;
+      };
+      """
+    And No errors are emitted
+
+  Scenario: Leaves the intermediate bases and the extending interfaces alone
+
+    Given Header file with name "partial_shapes.hpp" and content
+      """
+      #include "shape.hpp"
+      struct PartialShape : Shape
+      {
+          double area() const override;
+      };
+      struct Triangle : PartialShape
+      {
+          void draw() override;
+      };
+      struct PrintableShape : Shape
+      {
+          virtual void print() = 0;
+      };
+      """
+    And Translation unit with name "partial_shapes.cpp" and content
+      """
+      #include "partial_shapes.hpp"
+      """
+    When Missing overrides are generated for interface "Shape"
+    Then No file is edited
+    And No errors are emitted
+
+  Scenario: Fails when the root directory does not exist
+
+    Given Translation unit with name "main.cpp" and content
+      """
+      #include "shape.hpp"
+      """
+    When Missing overrides are generated for interface "Shape" within nonexistent directory "nonexistent"
+    Then Error is raised with return code 1
@@ -0,0 +1,68 @@
+import json
+import os
+import subprocess
+from helpers.compilation_database import CompilationDatabase
+from helpers.file import File
+from helpers.tool_result import ToolResult
+from hamcrest import assert_that, equal_to, empty, starts_with
+import helpers.utils as utils
+
+
+@given('Header file with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    context.header = File(path, context.text + "\n")
+    context.header.create()
+
+
+@given('Paired source file with name "{file_name}" and content')
+def step_impl(context, file_name: str):
+    path = os.path.join(context.working_directory, file_name)
+    File(path, context.text + "\n").create()
+    context.translation_units.append(path)
+
+
+@when(
+    "Definitions are generated for the declarations at lines "
+    "{line_begin} to {line_end}"
+)
+def step_impl(context, line_begin: str, line_end: str):
+    CompilationDatabase(context.working_directory).create_for_translation_units(
+        context.translation_units
+    )
+    tool_path = utils.get_tool_path(context)
+    cmd = [
+        tool_path,
+        context.working_directory,
+        context.working_directory,
+        context.header.path,
+        context.header.content,
+        line_begin,
+        line_end,
+    ]
+    cmd_result = subprocess.run(cmd, capture_output=True)
+    context.result = ToolResult(
+        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
+    )
+
+
+@then('File "{file_name}" gets new content')
+def step_impl(context, file_name: str):
+    result = json.loads(utils.get_result(context).stdout)
+    path = os.path.join(context.working_directory, file_name)
+    assert_that(list(result.keys()), equal_to([path]))
+    assert_that(result[path], equal_to(context.text + "\n"))
+
+
+@then("No errors are emitted")
+def step_impl(context):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
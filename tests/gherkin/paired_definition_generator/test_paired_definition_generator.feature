@@ -0,0 +1,81 @@
+Feature: Generates the function definitions straight into the paired source file
+
+  Background:
+
+    Given Header file with name "foo.hpp" and content
+      """
+      struct Foo
+      {
+          void start();
+          void run();
+          int pause(unsigned timeout);
+          void stop();
+      };
+      void free_function(double value);
+      """
+    And Paired source file with name "foo.cpp" and content
+      """
+      #include "foo.hpp"
+
+      void Foo::start()
+      {
+      }
+
+      //! Stops the foo.
+      void Foo::stop()
+      {
+      }
+      """
+
+  Scenario: Places the definitions next to the definitions of their neighbours
+
+    When Definitions are generated for the declarations at lines 4 to 5
+    Then File "foo.cpp" gets new content
+      """
+      #include "foo.hpp"
+
+      void Foo::start()
+      {
+      }
+
+      void Foo::run()
+      {
+      }
+
+      int Foo::pause(unsigned int timeout)
+      {
+      }
+
+      //! Stops the foo.
+      void Foo::stop()
+      {
+      }
+      """
+    And No errors are emitted
+
+  Scenario: Appends the definition of the function declared after all the defined ones
+
+    When Definitions are generated for the declarations at lines 8 to 8
+    Then File "foo.cpp" gets new content
+      """
+      #include "foo.hpp"
+
+      void Foo::start()
+      {
+      }
+
+      //! Stops the foo.
+      void Foo::stop()
+      {
+      }
+
+      void free_function(double value)
+      {
+      }
+      """
+    And No errors are emitted
+
+  Scenario: Fails when the selected functions are defined already
+
+    When Definitions are generated for the declarations at lines 3 to 3
+    Then Error is raised with return code 1
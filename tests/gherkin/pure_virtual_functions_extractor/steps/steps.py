@@ -1,8 +1,9 @@
+import json
 import os
 import subprocess
 from helpers.file import File
 from helpers.tool_result import ToolResult
-from hamcrest import assert_that, equal_to, empty, not_
+from hamcrest import assert_that, equal_to, empty, not_, starts_with
 import helpers.utils as utils
 
 
@@ -23,33 +24,44 @@ def step_impl(context, file_name):
     File(path, file_content).create()
 
 
-@when(
-    "Pure virtual functions are extracted from "
-    'class "{class_name}" in file "{file_name}"'
-)
-def step_impl(context, class_name: str, file_name: str):
-    header_path = os.path.join(context.working_directory, file_name)
+def get_last_header_path(context):
+    count = context.unnamed_file_count - 1
+    fname = "header_{}.hpp".format(count)
+    return os.path.join(context.working_directory, fname)
+
+
+def run_tool(context, header_path: str, class_query: list):
     tool_path = utils.get_tool_path(context)
     comp_db_dir = context.working_directory
-    cmd = [tool_path, comp_db_dir, header_path, class_name]
+    cmd = [tool_path, comp_db_dir, header_path] + class_query
     cmd_result = subprocess.run(cmd, capture_output=True)
     context.result = ToolResult(
         cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
     )
 
 
+@when(
+    "Pure virtual functions are extracted from "
+    'class "{class_name}" in file "{file_name}"'
+)
+def step_impl(context, class_name: str, file_name: str):
+    header_path = os.path.join(context.working_directory, file_name)
+    run_tool(context, header_path, [class_name])
+
+
 @when('Pure virtual functions are extracted from class "{class_name}"')
 def step_impl(context, class_name: str):
-    count = context.unnamed_file_count - 1
-    fname = "header_{}.hpp".format(count)
-    header_path = os.path.join(context.working_directory, fname)
-    tool_path = utils.get_tool_path(context)
-    comp_db_dir = context.working_directory
-    cmd = [tool_path, comp_db_dir, header_path, class_name]
-    cmd_result = subprocess.run(cmd, capture_output=True)
-    context.result = ToolResult(
-        cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
-    )
+    run_tool(context, get_last_header_path(context), [class_name])
+
+
+@when('Pure virtual functions are extracted from classes "{class_names}"')
+def step_impl(context, class_names: str):
+    run_tool(context, get_last_header_path(context), class_names.split(","))
+
+
+@when("Pure virtual functions are extracted from all the classes")
+def step_impl(context):
+    run_tool(context, get_last_header_path(context), ["--all"])
 
 
 @then("Stdout contains")
@@ -64,3 +76,18 @@ def step_impl(context):
     result = utils.get_result(context)
     assert_that(result.return_code, equal_to(0))
     assert_that(result.stderr, empty())
+
+
+@then("The JSON result is")
+def step_impl(context):
+    result = utils.get_result(context)
+    assert_that(json.loads(result.stdout), equal_to(json.loads(context.text)))
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
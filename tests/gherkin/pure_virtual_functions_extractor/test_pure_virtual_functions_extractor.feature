@@ -166,3 +166,61 @@ Feature: Extracts pure virtual functions from abstract class and converts them t
       """
     And No errors are emitted
 
+
+  Scenario: Extracts the pure virtual functions from many classes at once
+
+    Given Header file with content
+      """
+      struct Runnable
+      {
+          virtual void run(unsigned int) = 0;
+      };
+      struct Printable
+      {
+          virtual void print() const = 0;
+          virtual int width() = 0;
+      };
+      """
+    When Pure virtual functions are extracted from classes "Runnable,Printable"
+    Then The JSON result is
+      """
+      {
+        "Runnable": ["void run(unsigned int) override;"],
+        "Printable": ["void print() const override;", "int width() override;"]
+      }
+      """
+
+  Scenario: Extracts the pure virtual functions from all the abstract classes defined within the header
+
+    Given Header file with content
+      """
+      namespace Shapes {
+      struct Shape
+      {
+          virtual double area() const = 0;
+      };
+      struct Circle : Shape
+      {
+          double area() const override;
+      };
+      }
+      """
+    When Pure virtual functions are extracted from all the classes
+    Then The JSON result is
+      """
+      {
+        "Shapes::Shape": ["double area() const override;"]
+      }
+      """
+
+  Scenario: Fails for a class without pure virtual functions
+
+    Given Header file with content
+      """
+      struct Concrete
+      {
+          void run();
+      };
+      """
+    When Pure virtual functions are extracted from class "Concrete"
+    Then Error is raised with return code 1
@@ -1,8 +1,9 @@
+import json
 import os
 import subprocess
 from helpers.file import File
 from helpers.tool_result import ToolResult
-from hamcrest import assert_that, equal_to, empty, not_
+from hamcrest import assert_that, equal_to, empty, not_, starts_with
 import helpers.utils as utils
 
 
@@ -13,18 +14,32 @@ def step_impl(context):
     File(header, file_content).create()
 
 
-@when('Suitable place in class is searched for class "{class_name}"')
-def step_impl(context, class_name: str):
+def run_tool(context, class_query: list):
     header_path = os.path.join(context.working_directory, "header.hpp")
     tool_path = utils.get_tool_path(context)
     comp_db_dir = context.working_directory
-    cmd = [tool_path, comp_db_dir, header_path, class_name]
+    cmd = [tool_path, comp_db_dir, header_path] + class_query
     cmd_result = subprocess.run(cmd, capture_output=True)
     context.result = ToolResult(
         cmd_result.stdout, cmd_result.stderr, cmd_result.returncode
     )
 
 
+@when('Suitable place in class is searched for class "{class_name}"')
+def step_impl(context, class_name: str):
+    run_tool(context, [class_name])
+
+
+@when('Suitable places in classes are searched for classes "{class_names}"')
+def step_impl(context, class_names: str):
+    run_tool(context, class_names.split(","))
+
+
+@when("Suitable places in classes are searched for all the classes")
+def step_impl(context):
+    run_tool(context, ["--all"])
+
+
 @then(
     "Line number {line_number} is returned with indication of inserting a"
     " public section"
@@ -44,3 +59,18 @@ def step_impl(context, line_number: str):
     assert_that(stdout, equal_to(line_number))
     assert_that(result.return_code, equal_to(0))
     assert_that(result.stderr, empty())
+
+
+@then("The JSON result is")
+def step_impl(context):
+    result = utils.get_result(context)
+    assert_that(json.loads(result.stdout), equal_to(json.loads(context.text)))
+    assert_that(result.return_code, equal_to(0))
+    assert_that(result.stderr, empty())
+
+
+@then("Error is raised with return code {return_code:d}")
+def step_impl(context, return_code: int):
+    result = utils.get_result(context)
+    assert_that(result.return_code, equal_to(return_code))
+    assert_that(result.stderr, starts_with("ERROR: "))
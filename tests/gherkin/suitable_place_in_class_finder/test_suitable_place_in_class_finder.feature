@@ -150,3 +150,58 @@ Feature: Finds suitable place in classes to put a new public function declaratio
         """
         When Suitable place in class is searched for class "Yolo"
         Then Line number 3 is returned with indication of inserting a public section
+
+    Scenario: In many classes at once
+        Given Header file with content
+        """
+        class Yolo
+        {
+        public:
+            Yolo() = default;
+            void gimme();
+        };
+        class Maka
+        {
+        private:
+            void gimme();
+            void sijek();
+        };
+        """
+        When Suitable places in classes are searched for classes "Yolo,Maka"
+        Then The JSON result is
+        """
+        {
+          "Yolo": {"line": 5, "is_public_section_needed": false},
+          "Maka": {"line": 8, "is_public_section_needed": true}
+        }
+        """
+
+    Scenario: In all the classes defined within the header
+        Given Header file with content
+        """
+        namespace Space {
+        class Yolo
+        {
+        public:
+            Yolo() = default;
+            void gimme();
+        };
+        }
+        """
+        When Suitable places in classes are searched for all the classes
+        Then The JSON result is
+        """
+        {
+          "Space::Yolo": {"line": 6, "is_public_section_needed": false}
+        }
+        """
+
+    Scenario: In an unknown class
+        Given Header file with content
+        """
+        class Yolo
+        {
+        };
+        """
+        When Suitable place in class is searched for class "Unknown"
+        Then Error is raised with return code 1